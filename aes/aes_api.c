@@ -27,6 +27,94 @@ static void aes_ciph_undef(uint8_t * d, const uint8_t * s, const uint32_t * rk)
 	rvkat_info("undefined pointer: aes_ciph_undef()");
 }
 
+//	default multi-block versions just loop over the single-block pointers
+
+static void aes128_enc_ecbn_loop(uint8_t * ct, const uint8_t * pt, size_t n,
+								 const uint32_t * rk)
+{
+	for (; n > 0; n--, ct += 16, pt += 16)
+		aes128_enc_ecb(ct, pt, rk);
+}
+
+static void aes192_enc_ecbn_loop(uint8_t * ct, const uint8_t * pt, size_t n,
+								 const uint32_t * rk)
+{
+	for (; n > 0; n--, ct += 16, pt += 16)
+		aes192_enc_ecb(ct, pt, rk);
+}
+
+static void aes256_enc_ecbn_loop(uint8_t * ct, const uint8_t * pt, size_t n,
+								 const uint32_t * rk)
+{
+	for (; n > 0; n--, ct += 16, pt += 16)
+		aes256_enc_ecb(ct, pt, rk);
+}
+
+static void aes128_dec_ecbn_loop(uint8_t * pt, const uint8_t * ct, size_t n,
+								 const uint32_t * rk)
+{
+	for (; n > 0; n--, pt += 16, ct += 16)
+		aes128_dec_ecb(pt, ct, rk);
+}
+
+static void aes192_dec_ecbn_loop(uint8_t * pt, const uint8_t * ct, size_t n,
+								 const uint32_t * rk)
+{
+	for (; n > 0; n--, pt += 16, ct += 16)
+		aes192_dec_ecb(pt, ct, rk);
+}
+
+static void aes256_dec_ecbn_loop(uint8_t * pt, const uint8_t * ct, size_t n,
+								 const uint32_t * rk)
+{
+	for (; n > 0; n--, pt += 16, ct += 16)
+		aes256_dec_ecb(pt, ct, rk);
+}
+
+//	default combined and batched key schedules use the single-key pointers
+
+static void aes128_encdec_key_loop(uint32_t * erk, uint32_t * drk,
+								   const uint8_t * key)
+{
+	aes128_enc_key(erk, key);
+	aes128_dec_key(drk, key);
+}
+
+static void aes192_encdec_key_loop(uint32_t * erk, uint32_t * drk,
+								   const uint8_t * key)
+{
+	aes192_enc_key(erk, key);
+	aes192_dec_key(drk, key);
+}
+
+static void aes256_encdec_key_loop(uint32_t * erk, uint32_t * drk,
+								   const uint8_t * key)
+{
+	aes256_enc_key(erk, key);
+	aes256_dec_key(drk, key);
+}
+
+static void aes128_enc_key_n_loop(uint32_t * rk, const uint8_t * key,
+								  size_t n)
+{
+	for (; n > 0; n--, rk += AES128_RK_WORDS, key += 16)
+		aes128_enc_key(rk, key);
+}
+
+static void aes192_enc_key_n_loop(uint32_t * rk, const uint8_t * key,
+								  size_t n)
+{
+	for (; n > 0; n--, rk += AES192_RK_WORDS, key += 24)
+		aes192_enc_key(rk, key);
+}
+
+static void aes256_enc_key_n_loop(uint32_t * rk, const uint8_t * key,
+								  size_t n)
+{
+	for (; n > 0; n--, rk += AES256_RK_WORDS, key += 32)
+		aes256_enc_key(rk, key);
+}
+
 //	== Externally visible pointers ==
 
 //	Set encryption key
@@ -52,6 +140,20 @@ void (*aes192_enc_ecb)(uint8_t ct[16], const uint8_t pt[16],
 void (*aes256_enc_ecb)(uint8_t ct[16], const uint8_t pt[16],
 					   const uint32_t rk[AES256_RK_WORDS]) = aes_ciph_undef;
 
+//	Encrypt n blocks
+
+void (*aes128_enc_ecbn)(uint8_t * ct, const uint8_t * pt, size_t n,
+						const uint32_t rk[AES128_RK_WORDS]) =
+	aes128_enc_ecbn_loop;
+
+void (*aes192_enc_ecbn)(uint8_t * ct, const uint8_t * pt, size_t n,
+						const uint32_t rk[AES192_RK_WORDS]) =
+	aes192_enc_ecbn_loop;
+
+void (*aes256_enc_ecbn)(uint8_t * ct, const uint8_t * pt, size_t n,
+						const uint32_t rk[AES256_RK_WORDS]) =
+	aes256_enc_ecbn_loop;
+
 //	Set decryption key
 
 void (*aes128_dec_key)(uint32_t rk[AES128_RK_WORDS],
@@ -71,3 +173,114 @@ void (*aes192_dec_ecb)(uint8_t pt[16], const uint8_t ct[16],
 
 void (*aes256_dec_ecb)(uint8_t pt[16], const uint8_t ct[16],
 					   const uint32_t rk[AES256_RK_WORDS]) = aes_ciph_undef;
+
+//	Decrypt n blocks
+
+void (*aes128_dec_ecbn)(uint8_t * pt, const uint8_t * ct, size_t n,
+						const uint32_t rk[AES128_RK_WORDS]) =
+	aes128_dec_ecbn_loop;
+
+void (*aes192_dec_ecbn)(uint8_t * pt, const uint8_t * ct, size_t n,
+						const uint32_t rk[AES192_RK_WORDS]) =
+	aes192_dec_ecbn_loop;
+
+void (*aes256_dec_ecbn)(uint8_t * pt, const uint8_t * ct, size_t n,
+						const uint32_t rk[AES256_RK_WORDS]) =
+	aes256_dec_ecbn_loop;
+
+//	Set encryption and decryption keys together
+
+void (*aes128_encdec_key)(uint32_t erk[AES128_RK_WORDS],
+						  uint32_t drk[AES128_RK_WORDS],
+						  const uint8_t key[16]) = aes128_encdec_key_loop;
+
+void (*aes192_encdec_key)(uint32_t erk[AES192_RK_WORDS],
+						  uint32_t drk[AES192_RK_WORDS],
+						  const uint8_t key[24]) = aes192_encdec_key_loop;
+
+void (*aes256_encdec_key)(uint32_t erk[AES256_RK_WORDS],
+						  uint32_t drk[AES256_RK_WORDS],
+						  const uint8_t key[32]) = aes256_encdec_key_loop;
+
+//	Set n encryption keys
+
+void (*aes128_enc_key_n)(uint32_t * rk, const uint8_t * key, size_t n) =
+	aes128_enc_key_n_loop;
+
+void (*aes192_enc_key_n)(uint32_t * rk, const uint8_t * key, size_t n) =
+	aes192_enc_key_n_loop;
+
+void (*aes256_enc_key_n)(uint32_t * rk, const uint8_t * key, size_t n) =
+	aes256_enc_key_n_loop;
+
+//	== Key objects ==
+
+int aes_enc_key_init(aes_key_t * k, const uint8_t * key, size_t klen)
+{
+	switch (klen) {
+		case 16:
+			aes128_enc_key(k->rk, key);
+			k->nr = AES128_ROUNDS;
+			return 0;
+		case 24:
+			aes192_enc_key(k->rk, key);
+			k->nr = AES192_ROUNDS;
+			return 0;
+		case 32:
+			aes256_enc_key(k->rk, key);
+			k->nr = AES256_ROUNDS;
+			return 0;
+	}
+	return -1;
+}
+
+int aes_dec_key_init(aes_key_t * k, const uint8_t * key, size_t klen)
+{
+	switch (klen) {
+		case 16:
+			aes128_dec_key(k->rk, key);
+			k->nr = AES128_ROUNDS;
+			return 0;
+		case 24:
+			aes192_dec_key(k->rk, key);
+			k->nr = AES192_ROUNDS;
+			return 0;
+		case 32:
+			aes256_dec_key(k->rk, key);
+			k->nr = AES256_ROUNDS;
+			return 0;
+	}
+	return -1;
+}
+
+void aes_enc_ecbn_key(uint8_t * ct, const uint8_t * pt, size_t n,
+					  const aes_key_t * k)
+{
+	switch (k->nr) {
+		case AES128_ROUNDS:
+			aes128_enc_ecbn(ct, pt, n, k->rk);
+			break;
+		case AES192_ROUNDS:
+			aes192_enc_ecbn(ct, pt, n, k->rk);
+			break;
+		case AES256_ROUNDS:
+			aes256_enc_ecbn(ct, pt, n, k->rk);
+			break;
+	}
+}
+
+void aes_dec_ecbn_key(uint8_t * pt, const uint8_t * ct, size_t n,
+					  const aes_key_t * k)
+{
+	switch (k->nr) {
+		case AES128_ROUNDS:
+			aes128_dec_ecbn(pt, ct, n, k->rk);
+			break;
+		case AES192_ROUNDS:
+			aes192_dec_ecbn(pt, ct, n, k->rk);
+			break;
+		case AES256_ROUNDS:
+			aes256_dec_ecbn(pt, ct, n, k->rk);
+			break;
+	}
+}
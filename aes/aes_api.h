@@ -13,6 +13,8 @@ extern "C" {
 #endif
 
 #include <stdint.h>
+#include <stddef.h>
+#include "rvk_align.h"
 
 //	number of rounds
 #define AES128_ROUNDS 10
@@ -47,6 +49,18 @@ extern void (*aes192_enc_ecb)(uint8_t ct[16], const uint8_t pt[16],
 extern void (*aes256_enc_ecb)(uint8_t ct[16], const uint8_t pt[16],
 							  const uint32_t rk[AES256_RK_WORDS]);
 
+//	Encrypt n consecutive blocks (ECB). The default implementation loops
+//	over the single-block pointers; backends can interleave several blocks.
+
+extern void (*aes128_enc_ecbn)(uint8_t * ct, const uint8_t * pt, size_t n,
+							   const uint32_t rk[AES128_RK_WORDS]);
+
+extern void (*aes192_enc_ecbn)(uint8_t * ct, const uint8_t * pt, size_t n,
+							   const uint32_t rk[AES192_RK_WORDS]);
+
+extern void (*aes256_enc_ecbn)(uint8_t * ct, const uint8_t * pt, size_t n,
+							   const uint32_t rk[AES256_RK_WORDS]);
+
 //	Set decryption key
 
 extern void (*aes128_dec_key)(uint32_t rk[AES128_RK_WORDS],
@@ -67,6 +81,65 @@ extern void (*aes192_dec_ecb)(uint8_t pt[16], const uint8_t ct[16],
 extern void (*aes256_dec_ecb)(uint8_t pt[16], const uint8_t ct[16],
 							  const uint32_t rk[AES256_RK_WORDS]);
 
+//	Decrypt n consecutive blocks (ECB)
+
+extern void (*aes128_dec_ecbn)(uint8_t * pt, const uint8_t * ct, size_t n,
+							   const uint32_t rk[AES128_RK_WORDS]);
+
+extern void (*aes192_dec_ecbn)(uint8_t * pt, const uint8_t * ct, size_t n,
+							   const uint32_t rk[AES192_RK_WORDS]);
+
+extern void (*aes256_dec_ecbn)(uint8_t * pt, const uint8_t * ct, size_t n,
+							   const uint32_t rk[AES256_RK_WORDS]);
+
+//	Set encryption and decryption keys together. The default sets them
+//	separately; backends derive both schedules in one pass.
+
+extern void (*aes128_encdec_key)(uint32_t erk[AES128_RK_WORDS],
+								 uint32_t drk[AES128_RK_WORDS],
+								 const uint8_t key[16]);
+
+extern void (*aes192_encdec_key)(uint32_t erk[AES192_RK_WORDS],
+								 uint32_t drk[AES192_RK_WORDS],
+								 const uint8_t key[24]);
+
+extern void (*aes256_encdec_key)(uint32_t erk[AES256_RK_WORDS],
+								 uint32_t drk[AES256_RK_WORDS],
+								 const uint8_t key[32]);
+
+//	Set n encryption keys: key holds n consecutive keys and rk receives
+//	n consecutive expanded keys (n * AESxxx_RK_WORDS words).
+
+extern void (*aes128_enc_key_n)(uint32_t * rk, const uint8_t * key,
+								size_t n);
+
+extern void (*aes192_enc_key_n)(uint32_t * rk, const uint8_t * key,
+								size_t n);
+
+extern void (*aes256_enc_key_n)(uint32_t * rk, const uint8_t * key,
+								size_t n);
+
+//	Key object: round keys first, on whole cache lines (four for AES-256,
+//	three of them hot for AES-128). Set up with aes_enc_key_init() or
+//	aes_dec_key_init(); these return nonzero if klen is not 16, 24, or 32.
+
+typedef struct {
+	uint32_t rk[AES256_RK_WORDS];			//	round keys
+	int nr;									//	number of rounds
+} RVK_ALIGNED aes_key_t;
+
+int aes_enc_key_init(aes_key_t * k, const uint8_t * key, size_t klen);
+
+int aes_dec_key_init(aes_key_t * k, const uint8_t * key, size_t klen);
+
+//	Encrypt / decrypt n consecutive blocks (ECB) with a key object
+
+void aes_enc_ecbn_key(uint8_t * ct, const uint8_t * pt, size_t n,
+					  const aes_key_t * k);
+
+void aes_dec_ecbn_key(uint8_t * pt, const uint8_t * ct, size_t n,
+					  const aes_key_t * k);
+
 #ifdef __cplusplus
 }
 #endif
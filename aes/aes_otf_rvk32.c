@@ -0,0 +1,497 @@
+//	aes_otf_rvk32.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	AES Encryption and Decryption with on-the-fly key expansion (RV32)
+
+#include "riscv_crypto.h"
+#ifdef RVKINTRIN_RV32
+
+#include "aes_api.h"
+#include "aes_rvk32.h"
+#include "aes_otf_rvk32.h"
+#include "rv_endian.h"
+#include <stddef.h>
+
+//	AES Round Constants
+
+static const uint8_t aes_rcon[] = {
+	0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36
+};
+
+//	One AES32 round as a macro: 16 instructions. u is preloaded with key.
+
+#define SAES32_ENC_ROUND(fn, u0, u1, u2, u3, t0, t1, t2, t3) {	\
+	u0 = fn(u0, t0, 0);		\
+	u0 = fn(u0, t1, 1);		\
+	u0 = fn(u0, t2, 2);		\
+	u0 = fn(u0, t3, 3);		\
+	u1 = fn(u1, t1, 0);		\
+	u1 = fn(u1, t2, 1);		\
+	u1 = fn(u1, t3, 2);		\
+	u1 = fn(u1, t0, 3);		\
+	u2 = fn(u2, t2, 0);		\
+	u2 = fn(u2, t3, 1);		\
+	u2 = fn(u2, t0, 2);		\
+	u2 = fn(u2, t1, 3);		\
+	u3 = fn(u3, t3, 0);		\
+	u3 = fn(u3, t0, 1);		\
+	u3 = fn(u3, t1, 2);		\
+	u3 = fn(u3, t2, 3);		}
+
+#define SAES32_DEC_ROUND(fn, u0, u1, u2, u3, t0, t1, t2, t3) {	\
+	u0 = fn(u0, t0, 0);		\
+	u0 = fn(u0, t3, 1);		\
+	u0 = fn(u0, t2, 2);		\
+	u0 = fn(u0, t1, 3);		\
+	u1 = fn(u1, t1, 0);		\
+	u1 = fn(u1, t0, 1);		\
+	u1 = fn(u1, t3, 2);		\
+	u1 = fn(u1, t2, 3);		\
+	u2 = fn(u2, t2, 0);		\
+	u2 = fn(u2, t1, 1);		\
+	u2 = fn(u2, t0, 2);		\
+	u2 = fn(u2, t3, 3);		\
+	u3 = fn(u3, t3, 0);		\
+	u3 = fn(u3, t2, 1);		\
+	u3 = fn(u3, t1, 2);		\
+	u3 = fn(u3, t0, 3);		}
+
+//	SubWord(RotWord(x)) ^ rcon into k; 4 x AES32ESI
+
+#define SAES32_KS_ROT(k, x, rc) {		\
+	k ^= (uint32_t) (rc);			\
+	tr = _rv32_ror(x, 8);			\
+	k = _rv32_aes32esi(k, tr, 0);	\
+	k = _rv32_aes32esi(k, tr, 1);	\
+	k = _rv32_aes32esi(k, tr, 2);	\
+	k = _rv32_aes32esi(k, tr, 3);	}
+
+//	SubWord(x) into k (AES-256 odd subkeys); 4 x AES32ESI
+
+#define SAES32_KS_SUB(k, x) {			\
+	k = _rv32_aes32esi(k, x, 0);	\
+	k = _rv32_aes32esi(k, x, 1);	\
+	k = _rv32_aes32esi(k, x, 2);	\
+	k = _rv32_aes32esi(k, x, 3);	}
+
+//	Forward and inverse key schedule steps. XOR chains are inverted by
+//	running them the other way; SubWord() input is the restored last word.
+
+#define SAES32_KEY128_FWD(rc) {		\
+	SAES32_KS_ROT(k0, k3, rc);		\
+	k1 ^= k0;						\
+	k2 ^= k1;						\
+	k3 ^= k2;						}
+
+#define SAES32_KEY128_INV(rc) {		\
+	k3 ^= k2;						\
+	k2 ^= k1;						\
+	k1 ^= k0;						\
+	SAES32_KS_ROT(k0, k3, rc);		}
+
+#define SAES32_KEY192_FWD(rc) {		\
+	SAES32_KS_ROT(k0, k5, rc);		\
+	k1 ^= k0;						\
+	k2 ^= k1;						\
+	k3 ^= k2;						\
+	k4 ^= k3;						\
+	k5 ^= k4;						}
+
+#define SAES32_KEY192_INV(rc) {		\
+	k5 ^= k4;						\
+	k4 ^= k3;						\
+	k3 ^= k2;						\
+	k2 ^= k1;						\
+	k1 ^= k0;						\
+	SAES32_KS_ROT(k0, k5, rc);		}
+
+#define SAES32_KEY256_FWDA(rc) {		\
+	SAES32_KS_ROT(k0, k7, rc);		\
+	k1 ^= k0;						\
+	k2 ^= k1;						\
+	k3 ^= k2;						}
+
+#define SAES32_KEY256_FWDB {			\
+	SAES32_KS_SUB(k4, k3);			\
+	k5 ^= k4;						\
+	k6 ^= k5;						\
+	k7 ^= k6;						}
+
+#define SAES32_KEY256_INVA(rc) {		\
+	k3 ^= k2;						\
+	k2 ^= k1;						\
+	k1 ^= k0;						\
+	SAES32_KS_ROT(k0, k7, rc);		}
+
+#define SAES32_KEY256_INVB {			\
+	k7 ^= k6;						\
+	k6 ^= k5;						\
+	k5 ^= k4;						\
+	SAES32_KS_SUB(k4, k3);			}
+
+#define SAES32_LOAD_IMC(u0, u1, u2, u3, x0, x1, x2, x3) {	\
+	u0 = rvk32_invmc1(x0);			\
+	u1 = rvk32_invmc1(x1);			\
+	u2 = rvk32_invmc1(x2);			\
+	u3 = rvk32_invmc1(x3);			}
+
+//	=== AES-128 ===
+
+void aes128_enc_otf_rvk32(uint8_t ct[16], const uint8_t pt[16],
+						   const uint32_t * rk)
+{
+	uint32_t t0, t1, t2, t3, u0, u1, u2, u3;
+	uint32_t k0, k1, k2, k3, tr;
+	const uint8_t *rc = aes_rcon;
+
+	k0 = rk[0];								//	load key
+	k1 = rk[1];
+	k2 = rk[2];
+	k3 = rk[3];
+
+	t0 = k0 ^ get32u_le(pt);				//	xor with plaintext block
+	t1 = k1 ^ get32u_le(pt + 4);
+	t2 = k2 ^ get32u_le(pt + 8);
+	t3 = k3 ^ get32u_le(pt + 12);
+
+	while (1) {								//	double round
+
+		SAES32_KEY128_FWD(*rc++);
+		u0 = k0;
+		u1 = k1;
+		u2 = k2;
+		u3 = k3;
+		SAES32_ENC_ROUND(_rv32_aes32esmi, u0, u1, u2, u3, t0, t1, t2, t3);
+
+		SAES32_KEY128_FWD(*rc++);
+		t0 = k0;
+		t1 = k1;
+		t2 = k2;
+		t3 = k3;
+		if (rc == aes_rcon + 10)			//	final round ?
+			break;
+		SAES32_ENC_ROUND(_rv32_aes32esmi, t0, t1, t2, t3, u0, u1, u2, u3);
+	}
+	SAES32_ENC_ROUND(_rv32_aes32esi, t0, t1, t2, t3, u0, u1, u2, u3);
+
+	put32u_le(ct, t0);						//	write ciphertext block
+	put32u_le(ct + 4, t1);
+	put32u_le(ct + 8, t2);
+	put32u_le(ct + 12, t3);
+}
+
+void aes128_dec_otf_key_rvk32(uint32_t rk[4], const uint8_t key[16])
+{
+	uint32_t k0, k1, k2, k3, tr;
+	const uint8_t *rc;
+
+	k0 = get32u_le(key);					//	load secret key
+	k1 = get32u_le(key + 4);
+	k2 = get32u_le(key + 8);
+	k3 = get32u_le(key + 12);
+
+	for (rc = aes_rcon; rc < aes_rcon + 10; rc++)
+		SAES32_KEY128_FWD(*rc);
+
+	rk[0] = k0;								//	last subkey only
+	rk[1] = k1;
+	rk[2] = k2;
+	rk[3] = k3;
+}
+
+void aes128_dec_otf_rvk32(uint8_t pt[16], const uint8_t ct[16],
+						   const uint32_t * rk)
+{
+	uint32_t t0, t1, t2, t3, u0, u1, u2, u3;
+	uint32_t k0, k1, k2, k3, tr;
+	const uint8_t *rc = aes_rcon + 10;
+
+	k0 = rk[0];								//	load last subkey
+	k1 = rk[1];
+	k2 = rk[2];
+	k3 = rk[3];
+
+	t0 = k0 ^ get32u_le(ct);				//	xor with ciphertext block
+	t1 = k1 ^ get32u_le(ct + 4);
+	t2 = k2 ^ get32u_le(ct + 8);
+	t3 = k3 ^ get32u_le(ct + 12);
+
+	while (1) {								//	double round
+
+		SAES32_KEY128_INV(*--rc);
+		SAES32_LOAD_IMC(u0, u1, u2, u3, k0, k1, k2, k3);
+		SAES32_DEC_ROUND(_rv32_aes32dsmi, u0, u1, u2, u3, t0, t1, t2, t3);
+
+		SAES32_KEY128_INV(*--rc);
+		if (rc == aes_rcon)					//	final round ?
+			break;
+		SAES32_LOAD_IMC(t0, t1, t2, t3, k0, k1, k2, k3);
+		SAES32_DEC_ROUND(_rv32_aes32dsmi, t0, t1, t2, t3, u0, u1, u2, u3);
+	}
+	t0 = k0;								//	first subkey
+	t1 = k1;
+	t2 = k2;
+	t3 = k3;
+	SAES32_DEC_ROUND(_rv32_aes32dsi, t0, t1, t2, t3, u0, u1, u2, u3);
+
+	put32u_le(pt, t0);						//	write plaintext block
+	put32u_le(pt + 4, t1);
+	put32u_le(pt + 8, t2);
+	put32u_le(pt + 12, t3);
+}
+
+//	=== AES-192 ===
+
+//	Three rounds consume two 6-word key schedule steps.
+
+void aes192_enc_otf_rvk32(uint8_t ct[16], const uint8_t pt[16],
+						   const uint32_t * rk)
+{
+	uint32_t t0, t1, t2, t3, u0, u1, u2, u3, v0, v1, v2, v3;
+	uint32_t k0, k1, k2, k3, k4, k5, tr;
+	const uint8_t *rc = aes_rcon;
+
+	k0 = rk[0];								//	load key
+	k1 = rk[1];
+	k2 = rk[2];
+	k3 = rk[3];
+	k4 = rk[4];
+	k5 = rk[5];
+
+	t0 = k0 ^ get32u_le(pt);				//	xor with plaintext block
+	t1 = k1 ^ get32u_le(pt + 4);
+	t2 = k2 ^ get32u_le(pt + 8);
+	t3 = k3 ^ get32u_le(pt + 12);
+
+	while (1) {								//	triple round
+
+		u0 = k4;							//	straddles two steps
+		u1 = k5;
+		SAES32_KEY192_FWD(*rc++);
+		u2 = k0;
+		u3 = k1;
+		SAES32_ENC_ROUND(_rv32_aes32esmi, u0, u1, u2, u3, t0, t1, t2, t3);
+
+		v0 = k2;
+		v1 = k3;
+		v2 = k4;
+		v3 = k5;
+		SAES32_ENC_ROUND(_rv32_aes32esmi, v0, v1, v2, v3, u0, u1, u2, u3);
+
+		SAES32_KEY192_FWD(*rc++);
+		t0 = k0;
+		t1 = k1;
+		t2 = k2;
+		t3 = k3;
+		if (rc == aes_rcon + 8)				//	final round ?
+			break;
+		SAES32_ENC_ROUND(_rv32_aes32esmi, t0, t1, t2, t3, v0, v1, v2, v3);
+	}
+	SAES32_ENC_ROUND(_rv32_aes32esi, t0, t1, t2, t3, v0, v1, v2, v3);
+
+	put32u_le(ct, t0);						//	write ciphertext block
+	put32u_le(ct + 4, t1);
+	put32u_le(ct + 8, t2);
+	put32u_le(ct + 12, t3);
+}
+
+void aes192_dec_otf_key_rvk32(uint32_t rk[6], const uint8_t key[24])
+{
+	uint32_t k0, k1, k2, k3, k4, k5, tr;
+	const uint8_t *rc;
+
+	k0 = get32u_le(key);					//	load secret key
+	k1 = get32u_le(key + 4);
+	k2 = get32u_le(key + 8);
+	k3 = get32u_le(key + 12);
+	k4 = get32u_le(key + 16);
+	k5 = get32u_le(key + 20);
+
+	for (rc = aes_rcon; rc < aes_rcon + 7; rc++)
+		SAES32_KEY192_FWD(*rc);
+
+	rk[0] = k4;								//	words 46, 47
+	rk[1] = k5;
+	SAES32_KEY192_FWD(*rc);
+	rk[2] = k0;								//	words 48 .. 51
+	rk[3] = k1;
+	rk[4] = k2;
+	rk[5] = k3;
+}
+
+void aes192_dec_otf_rvk32(uint8_t pt[16], const uint8_t ct[16],
+						   const uint32_t * rk)
+{
+	uint32_t t0, t1, t2, t3, u0, u1, u2, u3, v0, v1, v2, v3;
+	uint32_t k0, k1, k2, k3, k4, k5, s0, s1, tr;
+	const uint8_t *rc = aes_rcon + 8;
+
+	k0 = rk[2];								//	load last subkey
+	k1 = rk[3];
+	k2 = rk[4];
+	k3 = rk[5];
+	k4 = rk[0] ^ k3;						//	words 52, 53 complete the
+	k5 = rk[1] ^ k4;						//	last 6-word step
+
+	t0 = k0 ^ get32u_le(ct);				//	xor with ciphertext block
+	t1 = k1 ^ get32u_le(ct + 4);
+	t2 = k2 ^ get32u_le(ct + 8);
+	t3 = k3 ^ get32u_le(ct + 12);
+
+	while (1) {								//	triple round
+
+		SAES32_KEY192_INV(*--rc);
+		SAES32_LOAD_IMC(u0, u1, u2, u3, k2, k3, k4, k5);
+		SAES32_DEC_ROUND(_rv32_aes32dsmi, u0, u1, u2, u3, t0, t1, t2, t3);
+
+		s0 = k0;							//	straddles two steps
+		s1 = k1;
+		SAES32_KEY192_INV(*--rc);
+		SAES32_LOAD_IMC(v0, v1, v2, v3, k4, k5, s0, s1);
+		SAES32_DEC_ROUND(_rv32_aes32dsmi, v0, v1, v2, v3, u0, u1, u2, u3);
+
+		if (rc == aes_rcon)					//	final round ?
+			break;
+		SAES32_LOAD_IMC(t0, t1, t2, t3, k0, k1, k2, k3);
+		SAES32_DEC_ROUND(_rv32_aes32dsmi, t0, t1, t2, t3, v0, v1, v2, v3);
+	}
+	t0 = k0;								//	first subkey
+	t1 = k1;
+	t2 = k2;
+	t3 = k3;
+	SAES32_DEC_ROUND(_rv32_aes32dsi, t0, t1, t2, t3, v0, v1, v2, v3);
+
+	put32u_le(pt, t0);						//	write plaintext block
+	put32u_le(pt + 4, t1);
+	put32u_le(pt + 8, t2);
+	put32u_le(pt + 12, t3);
+}
+
+//	=== AES-256 ===
+
+void aes256_enc_otf_rvk32(uint8_t ct[16], const uint8_t pt[16],
+						   const uint32_t * rk)
+{
+	uint32_t t0, t1, t2, t3, u0, u1, u2, u3;
+	uint32_t k0, k1, k2, k3, k4, k5, k6, k7, tr;
+	const uint8_t *rc = aes_rcon;
+
+	k0 = rk[0];								//	load key
+	k1 = rk[1];
+	k2 = rk[2];
+	k3 = rk[3];
+	k4 = rk[4];
+	k5 = rk[5];
+	k6 = rk[6];
+	k7 = rk[7];
+
+	t0 = k0 ^ get32u_le(pt);				//	xor with plaintext block
+	t1 = k1 ^ get32u_le(pt + 4);
+	t2 = k2 ^ get32u_le(pt + 8);
+	t3 = k3 ^ get32u_le(pt + 12);
+
+	while (1) {								//	double round
+
+		u0 = k4;							//	odd subkey
+		u1 = k5;
+		u2 = k6;
+		u3 = k7;
+		SAES32_ENC_ROUND(_rv32_aes32esmi, u0, u1, u2, u3, t0, t1, t2, t3);
+
+		SAES32_KEY256_FWDA(*rc++);			//	even subkey
+		t0 = k0;
+		t1 = k1;
+		t2 = k2;
+		t3 = k3;
+		if (rc == aes_rcon + 7)				//	final round ?
+			break;
+		SAES32_ENC_ROUND(_rv32_aes32esmi, t0, t1, t2, t3, u0, u1, u2, u3);
+
+		SAES32_KEY256_FWDB;
+	}
+	SAES32_ENC_ROUND(_rv32_aes32esi, t0, t1, t2, t3, u0, u1, u2, u3);
+
+	put32u_le(ct, t0);						//	write ciphertext block
+	put32u_le(ct + 4, t1);
+	put32u_le(ct + 8, t2);
+	put32u_le(ct + 12, t3);
+}
+
+void aes256_dec_otf_key_rvk32(uint32_t rk[8], const uint8_t key[32])
+{
+	uint32_t k0, k1, k2, k3, k4, k5, k6, k7, tr;
+	const uint8_t *rc;
+
+	k0 = get32u_le(key);					//	load secret key
+	k1 = get32u_le(key + 4);
+	k2 = get32u_le(key + 8);
+	k3 = get32u_le(key + 12);
+	k4 = get32u_le(key + 16);
+	k5 = get32u_le(key + 20);
+	k6 = get32u_le(key + 24);
+	k7 = get32u_le(key + 28);
+
+	for (rc = aes_rcon; rc < aes_rcon + 6; rc++) {
+		SAES32_KEY256_FWDA(*rc);
+		SAES32_KEY256_FWDB;
+	}
+	SAES32_KEY256_FWDA(*rc);
+
+	rk[0] = k4;								//	second-to-last subkey
+	rk[1] = k5;
+	rk[2] = k6;
+	rk[3] = k7;
+	rk[4] = k0;								//	last subkey
+	rk[5] = k1;
+	rk[6] = k2;
+	rk[7] = k3;
+}
+
+void aes256_dec_otf_rvk32(uint8_t pt[16], const uint8_t ct[16],
+						   const uint32_t * rk)
+{
+	uint32_t t0, t1, t2, t3, u0, u1, u2, u3;
+	uint32_t k0, k1, k2, k3, k4, k5, k6, k7, tr;
+	const uint8_t *rc = aes_rcon + 7;
+
+	k4 = rk[0];								//	second-to-last subkey
+	k5 = rk[1];
+	k6 = rk[2];
+	k7 = rk[3];
+	k0 = rk[4];								//	last subkey
+	k1 = rk[5];
+	k2 = rk[6];
+	k3 = rk[7];
+
+	t0 = k0 ^ get32u_le(ct);				//	xor with ciphertext block
+	t1 = k1 ^ get32u_le(ct + 4);
+	t2 = k2 ^ get32u_le(ct + 8);
+	t3 = k3 ^ get32u_le(ct + 12);
+
+	while (1) {								//	double round
+
+		SAES32_LOAD_IMC(u0, u1, u2, u3, k4, k5, k6, k7);
+		SAES32_DEC_ROUND(_rv32_aes32dsmi, u0, u1, u2, u3, t0, t1, t2, t3);
+
+		SAES32_KEY256_INVA(*--rc);			//	even subkey
+		if (rc == aes_rcon)					//	final round ?
+			break;
+		SAES32_LOAD_IMC(t0, t1, t2, t3, k0, k1, k2, k3);
+		SAES32_DEC_ROUND(_rv32_aes32dsmi, t0, t1, t2, t3, u0, u1, u2, u3);
+
+		SAES32_KEY256_INVB;					//	odd subkey
+	}
+	t0 = k0;								//	first subkey
+	t1 = k1;
+	t2 = k2;
+	t3 = k3;
+	SAES32_DEC_ROUND(_rv32_aes32dsi, t0, t1, t2, t3, u0, u1, u2, u3);
+
+	put32u_le(pt, t0);						//	write plaintext block
+	put32u_le(pt + 4, t1);
+	put32u_le(pt + 8, t2);
+	put32u_le(pt + 12, t3);
+}
+
+#endif	//	RVKINTRIN_RV32
@@ -0,0 +1,51 @@
+//	aes_otf_rvk32.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	AES Encryption and Decryption with on-the-fly key expansion (RV32).
+//	For encryption *rk can point to expanded key or just the key.
+//	For decryption *rk points to the last 4/6/8 words of the expanded
+//	encryption key, as set up by aesxxx_dec_otf_key_rvk32().
+
+#ifndef _AES_OTF_RVK32_H_
+#define _AES_OTF_RVK32_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+void aes128_enc_otf_rvk32(uint8_t ct[16], const uint8_t pt[16],
+						   const uint32_t * rk);
+
+void aes192_enc_otf_rvk32(uint8_t ct[16], const uint8_t pt[16],
+						   const uint32_t * rk);
+
+void aes256_enc_otf_rvk32(uint8_t ct[16], const uint8_t pt[16],
+						   const uint32_t * rk);
+
+//	Set decryption key: just the tail of the key schedule
+
+void aes128_dec_otf_key_rvk32(uint32_t rk[4], const uint8_t key[16]);
+
+void aes192_dec_otf_key_rvk32(uint32_t rk[6], const uint8_t key[24]);
+
+void aes256_dec_otf_key_rvk32(uint32_t rk[8], const uint8_t key[32]);
+
+//	Decrypt a block, stepping the key schedule backwards
+
+void aes128_dec_otf_rvk32(uint8_t pt[16], const uint8_t ct[16],
+						   const uint32_t * rk);
+
+void aes192_dec_otf_rvk32(uint8_t pt[16], const uint8_t ct[16],
+						   const uint32_t * rk);
+
+void aes256_dec_otf_rvk32(uint8_t pt[16], const uint8_t ct[16],
+						   const uint32_t * rk);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	//	_AES_OTF_RVK32_H_
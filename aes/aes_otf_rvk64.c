@@ -2,12 +2,15 @@
 //	2020-05-06	Markku-Juhani O. Saarinen <mjos@pqhsield.com>
 //	Copyright (c) 2020, PQShield Ltd. All rights reserved.
 
-//	AES Encryption with on-the-fly key expansion
+//	AES Encryption and Decryption with on-the-fly key expansion
 
 #include "riscv_crypto.h"
 #ifdef RVKINTRIN_RV64
 
 #include "aes_api.h"
+#include "rvk_align.h"
+#include "aes_otf_rvk64.h"
+#include "rv_endian.h"
 #include <stddef.h>
 
 //	=== AES-128 round with on-the-fly key schedule ===
@@ -40,8 +43,7 @@ void aes128_enc_otf_rvk64(uint8_t ct[16], const uint8_t pt[16],
 	k0 = ((const uint64_t *) rk)[0];		//	load key
 	k1 = ((const uint64_t *) rk)[1];
 
-	t0 = ((const uint64_t *) pt)[0];		//	get plaintext
-	t1 = ((const uint64_t *) pt)[1];
+	RVK_GET64X2(t0, t1, pt);				//	get plaintext
 
 	t0 = t0 ^ k0;
 	t1 = t1 ^ k1;
@@ -63,8 +65,7 @@ void aes128_enc_otf_rvk64(uint8_t ct[16], const uint8_t pt[16],
 	t0 = t0 ^ k0;
 	t1 = t1 ^ k1;
 
-	((uint64_t *) ct)[0] = t0;				//	store ciphertext
-	((uint64_t *) ct)[1] = t1;
+	RVK_PUT64X2(ct, t0, t1);				//	store ciphertext
 }
 
 //	=== AES-192 round with on-the-fly key schedule ===
@@ -106,8 +107,7 @@ void aes192_enc_otf_rvk64(uint8_t ct[16], const uint8_t pt[16],
 	k1 = ((const uint64_t *) rk)[1];
 	k2 = ((const uint64_t *) rk)[2];
 
-	t0 = ((const uint64_t *) pt)[0];		//	get plaintext
-	t1 = ((const uint64_t *) pt)[1];
+	RVK_GET64X2(t0, t1, pt);				//	get plaintext
 
 	SAES64_OTF192A;							//	first round
 	SAES64_OTF192B(0);						//	# 2
@@ -131,8 +131,7 @@ void aes192_enc_otf_rvk64(uint8_t ct[16], const uint8_t pt[16],
 	t0 = t0 ^ k0;							//	final AddRoundKey
 	t1 = t1 ^ k1;
 
-	((uint64_t *) ct)[0] = t0;				//	store ciphertext
-	((uint64_t *) ct)[1] = t1;
+	RVK_PUT64X2(ct, t0, t1);				//	store ciphertext
 }
 
 
@@ -169,8 +168,7 @@ void aes256_enc_otf_rvk64(uint8_t ct[16], const uint8_t pt[16],
 	k2 = ((const uint64_t *) rk)[2];
 	k3 = ((const uint64_t *) rk)[3];
 
-	t0 = ((const uint64_t *) pt)[0];		//	get plaintext
-	t1 = ((const uint64_t *) pt)[1];
+	RVK_GET64X2(t0, t1, pt);				//	get plaintext
 
 	t0 = t0 ^ k0;
 	t1 = t1 ^ k1;
@@ -193,8 +191,230 @@ void aes256_enc_otf_rvk64(uint8_t ct[16], const uint8_t pt[16],
 	t0 = t0 ^ k0;
 	t1 = t1 ^ k1;
 
-	((uint64_t *) ct)[0] = t0;				//	store ciphertext
-	((uint64_t *) ct)[1] = t1;
+	RVK_PUT64X2(ct, t0, t1);				//	store ciphertext
+}
+
+
+//	=== Decryption: key schedule stepping backwards ===
+
+//	Inverse of the KS1/KS2 steps. For a forward k0' = KS2(KS1(x), k0),
+//	k1' = KS2(k0', k1) the old values are k1 = k1' ^ (k1' << 32 | k0' >> 32)
+//	and k0 = k0' ^ (k0' << 32 | T) where T is the low half of KS1(x).
+
+#define SAES64_INV2(a, b) (a ^ ((a << 32) | (b >> 32)))
+#define SAES64_INVK(a, x, i) \
+	(a ^ ((a << 32) | (uint32_t) _rv64_aes64ks1i(x, i)))
+
+//	Equivalent inverse cipher round: 2 x DECSM, 2 x IM, 2 x XOR
+
+#define SAES64_DEC_OTF(r0, r1, s0, s1, k0, k1) {		\
+	r0 = _rv64_aes64dsm(s0, s1) ^ (uint64_t) _rv64_aes64im(k0);	\
+	r1 = _rv64_aes64dsm(s1, s0) ^ (uint64_t) _rv64_aes64im(k1);	}
+
+//	AES-128
+
+#define SAES64_INV128(i) {				\
+	k1 = SAES64_INV2(k1, k0);		\
+	k0 = SAES64_INVK(k0, k1, i);	}
+
+void aes128_dec_otf_key_rvk64(uint32_t rk[4], const uint8_t key[16])
+{
+	uint64_t k0, k1, ks;
+	int i;
+
+	k0 = get64u_le(key);					//	load secret key
+	k1 = get64u_le(key + 8);
+	for (i = 0; i < 10; i++) {
+		ks = _rv64_aes64ks1i(k1, i);
+		k0 = _rv64_aes64ks2(ks, k0);
+		k1 = _rv64_aes64ks2(k0, k1);
+	}
+	((uint64_t *) rk)[0] = k0;				//	last round key only
+	((uint64_t *) rk)[1] = k1;
+}
+
+void aes128_dec_otf_rvk64(uint8_t pt[16], const uint8_t ct[16],
+						   const uint32_t * rk)
+{
+	uint64_t t0, t1, u0, u1, k0, k1;
+
+	k0 = ((const uint64_t *) rk)[0];		//	load last round key
+	k1 = ((const uint64_t *) rk)[1];
+
+	RVK_GET64X2(t0, t1, ct);				//	get ciphertext
+
+	t0 = t0 ^ k0;
+	t1 = t1 ^ k1;
+
+	SAES64_INV128(9);						//	first round
+	SAES64_DEC_OTF(u0, u1, t0, t1, k0, k1);
+	SAES64_INV128(8);						//	# 2
+	SAES64_DEC_OTF(t0, t1, u0, u1, k0, k1);
+	SAES64_INV128(7);						//	# 3
+	SAES64_DEC_OTF(u0, u1, t0, t1, k0, k1);
+	SAES64_INV128(6);						//	# 4
+	SAES64_DEC_OTF(t0, t1, u0, u1, k0, k1);
+	SAES64_INV128(5);						//	# 5
+	SAES64_DEC_OTF(u0, u1, t0, t1, k0, k1);
+	SAES64_INV128(4);						//	# 6
+	SAES64_DEC_OTF(t0, t1, u0, u1, k0, k1);
+	SAES64_INV128(3);						//	# 7
+	SAES64_DEC_OTF(u0, u1, t0, t1, k0, k1);
+	SAES64_INV128(2);						//	# 8
+	SAES64_DEC_OTF(t0, t1, u0, u1, k0, k1);
+	SAES64_INV128(1);						//	# 9
+	SAES64_DEC_OTF(u0, u1, t0, t1, k0, k1);
+	SAES64_INV128(0);						//	last round
+	t0 = _rv64_aes64ds(u0, u1) ^ k0;		//	DECS instead of DECSM
+	t1 = _rv64_aes64ds(u1, u0) ^ k1;
+
+	RVK_PUT64X2(pt, t0, t1);				//	store plaintext
+}
+
+//	AES-192; three rounds consume two steps of the 6-word schedule
+
+#define SAES64_INV192(i) {				\
+	k2 = SAES64_INV2(k2, k1);		\
+	k1 = SAES64_INV2(k1, k0);		\
+	k0 = SAES64_INVK(k0, k2, i);	}
+
+#define SAES64_DEC_OTF192(j) {			\
+	SAES64_INV192(2 * j + 1);		\
+	SAES64_DEC_OTF(u0, u1, t0, t1, k1, k2);		\
+	ks = k0;						\
+	SAES64_INV192(2 * j);			\
+	SAES64_DEC_OTF(v0, v1, u0, u1, k2, ks);		}
+
+void aes192_dec_otf_key_rvk64(uint32_t rk[6], const uint8_t key[24])
+{
+	uint64_t k0, k1, k2, ks;
+	int i;
+
+	k0 = get64u_le(key);					//	load secret key
+	k1 = get64u_le(key + 8);
+	k2 = get64u_le(key + 16);
+	for (i = 0; i < 7; i++) {
+		ks = _rv64_aes64ks1i(k2, i);
+		k0 = _rv64_aes64ks2(ks, k0);
+		k1 = _rv64_aes64ks2(k0, k1);
+		k2 = _rv64_aes64ks2(k1, k2);
+	}
+	((uint64_t *) rk)[0] = k2;				//	words 46, 47
+	ks = _rv64_aes64ks1i(k2, 7);
+	k0 = _rv64_aes64ks2(ks, k0);
+	k1 = _rv64_aes64ks2(k0, k1);
+	((uint64_t *) rk)[1] = k0;				//	words 48 .. 51
+	((uint64_t *) rk)[2] = k1;
+}
+
+void aes192_dec_otf_rvk64(uint8_t pt[16], const uint8_t ct[16],
+						   const uint32_t * rk)
+{
+	uint64_t t0, t1, u0, u1, v0, v1, k0, k1, k2, ks;
+
+	k0 = ((const uint64_t *) rk)[1];		//	load last round key
+	k1 = ((const uint64_t *) rk)[2];
+	ks = ((const uint64_t *) rk)[0] ^ (k1 >> 32);
+	k2 = ks ^ (ks << 32);					//	words 52, 53 complete step
+
+	RVK_GET64X2(t0, t1, ct);				//	get ciphertext
+
+	t0 = t0 ^ k0;
+	t1 = t1 ^ k1;
+
+	SAES64_DEC_OTF192(3);					//	# 1, 2
+	SAES64_DEC_OTF(t0, t1, v0, v1, k0, k1);	//	# 3
+	SAES64_DEC_OTF192(2);					//	# 4, 5
+	SAES64_DEC_OTF(t0, t1, v0, v1, k0, k1);	//	# 6
+	SAES64_DEC_OTF192(1);					//	# 7, 8
+	SAES64_DEC_OTF(t0, t1, v0, v1, k0, k1);	//	# 9
+	SAES64_DEC_OTF192(0);					//	# 10, 11
+	t0 = _rv64_aes64ds(v0, v1) ^ k0;		//	last round
+	t1 = _rv64_aes64ds(v1, v0) ^ k1;
+
+	RVK_PUT64X2(pt, t0, t1);				//	store plaintext
+}
+
+//	AES-256; even round keys in k0, k1 and odd ones in k2, k3
+
+#define SAES64_INV256A(i) {				\
+	k1 = SAES64_INV2(k1, k0);		\
+	k0 = SAES64_INVK(k0, k3, i);	}
+
+#define SAES64_INV256B {				\
+	k3 = SAES64_INV2(k3, k2);		\
+	k2 = SAES64_INVK(k2, k1, 10);	}
+
+void aes256_dec_otf_key_rvk64(uint32_t rk[8], const uint8_t key[32])
+{
+	uint64_t k0, k1, k2, k3, ks;
+	int i;
+
+	k0 = get64u_le(key);					//	load secret key
+	k1 = get64u_le(key + 8);
+	k2 = get64u_le(key + 16);
+	k3 = get64u_le(key + 24);
+	for (i = 0; i < 7; i++) {
+		ks = _rv64_aes64ks1i(k3, i);
+		k0 = _rv64_aes64ks2(ks, k0);
+		k1 = _rv64_aes64ks2(k0, k1);
+		if (i == 6)
+			break;
+		ks = _rv64_aes64ks1i(k1, 10);
+		k2 = _rv64_aes64ks2(ks, k2);
+		k3 = _rv64_aes64ks2(k2, k3);
+	}
+	((uint64_t *) rk)[0] = k2;				//	second-to-last round key
+	((uint64_t *) rk)[1] = k3;
+	((uint64_t *) rk)[2] = k0;				//	last round key
+	((uint64_t *) rk)[3] = k1;
+}
+
+void aes256_dec_otf_rvk64(uint8_t pt[16], const uint8_t ct[16],
+						   const uint32_t * rk)
+{
+	uint64_t t0, t1, u0, u1, k0, k1, k2, k3;
+
+	k2 = ((const uint64_t *) rk)[0];		//	load last two round keys
+	k3 = ((const uint64_t *) rk)[1];
+	k0 = ((const uint64_t *) rk)[2];
+	k1 = ((const uint64_t *) rk)[3];
+
+	RVK_GET64X2(t0, t1, ct);				//	get ciphertext
+
+	t0 = t0 ^ k0;
+	t1 = t1 ^ k1;
+
+	SAES64_DEC_OTF(u0, u1, t0, t1, k2, k3);	//	first round
+	SAES64_INV256A(6);						//	# 2
+	SAES64_DEC_OTF(t0, t1, u0, u1, k0, k1);
+	SAES64_INV256B;							//	# 3
+	SAES64_DEC_OTF(u0, u1, t0, t1, k2, k3);
+	SAES64_INV256A(5);						//	# 4
+	SAES64_DEC_OTF(t0, t1, u0, u1, k0, k1);
+	SAES64_INV256B;							//	# 5
+	SAES64_DEC_OTF(u0, u1, t0, t1, k2, k3);
+	SAES64_INV256A(4);						//	# 6
+	SAES64_DEC_OTF(t0, t1, u0, u1, k0, k1);
+	SAES64_INV256B;							//	# 7
+	SAES64_DEC_OTF(u0, u1, t0, t1, k2, k3);
+	SAES64_INV256A(3);						//	# 8
+	SAES64_DEC_OTF(t0, t1, u0, u1, k0, k1);
+	SAES64_INV256B;							//	# 9
+	SAES64_DEC_OTF(u0, u1, t0, t1, k2, k3);
+	SAES64_INV256A(2);						//	# 10
+	SAES64_DEC_OTF(t0, t1, u0, u1, k0, k1);
+	SAES64_INV256B;							//	# 11
+	SAES64_DEC_OTF(u0, u1, t0, t1, k2, k3);
+	SAES64_INV256A(1);						//	# 12
+	SAES64_DEC_OTF(t0, t1, u0, u1, k0, k1);
+	SAES64_INV256B;							//	# 13
+	SAES64_DEC_OTF(u0, u1, t0, t1, k2, k3);
+	SAES64_INV256A(0);						//	last round
+	t0 = _rv64_aes64ds(u0, u1) ^ k0;
+	t1 = _rv64_aes64ds(u1, u0) ^ k1;
+
+	RVK_PUT64X2(pt, t0, t1);				//	store plaintext
 }
 
 #endif	//	RVKINTRIN_RV64
@@ -4,6 +4,8 @@
 
 //	AES Encryption with on-the-fly key expansion.
 //	*rk can point to expanded key or just the key.
+//	For decryption *rk points to the last 4/6/8 words of the expanded
+//	encryption key, as set up by aesxxx_dec_otf_key_rvk64().
 
 #ifndef _AES_OTF_RVK64_H_
 #define _AES_OTF_RVK64_H_
@@ -23,6 +25,25 @@ void aes192_enc_otf_rvk64(uint8_t ct[16], const uint8_t pt[16],
 void aes256_enc_otf_rvk64(uint8_t ct[16], const uint8_t pt[16],
 						   const uint32_t * rk);
 
+//	Set decryption key: just the tail of the key schedule
+
+void aes128_dec_otf_key_rvk64(uint32_t rk[4], const uint8_t key[16]);
+
+void aes192_dec_otf_key_rvk64(uint32_t rk[6], const uint8_t key[24]);
+
+void aes256_dec_otf_key_rvk64(uint32_t rk[8], const uint8_t key[32]);
+
+//	Decrypt a block, stepping the key schedule backwards
+
+void aes128_dec_otf_rvk64(uint8_t pt[16], const uint8_t ct[16],
+						   const uint32_t * rk);
+
+void aes192_dec_otf_rvk64(uint8_t pt[16], const uint8_t ct[16],
+						   const uint32_t * rk);
+
+void aes256_dec_otf_rvk64(uint8_t pt[16], const uint8_t ct[16],
+						   const uint32_t * rk);
+
 #ifdef __cplusplus
 }
 #endif
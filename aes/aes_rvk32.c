@@ -9,6 +9,7 @@
 #ifdef RVKINTRIN_RV32
 
 #include "aes_api.h"
+#include "aes_rvk32.h"
 #include "rv_endian.h"
 #include <stddef.h>
 
@@ -116,6 +117,93 @@ void aes_enc_rounds_rvk32(uint8_t ct[16], const uint8_t pt[16],
 	put32u_le(ct + 12, t3);
 }
 
+//	Two interleaved blocks. One AES32 round as a macro: 16 instructions
+
+#define SAES32_ENC_ROUND(fn, u0, u1, u2, u3, t0, t1, t2, t3) {	\
+	u0 = fn(u0, t0, 0);		\
+	u0 = fn(u0, t1, 1);		\
+	u0 = fn(u0, t2, 2);		\
+	u0 = fn(u0, t3, 3);		\
+	u1 = fn(u1, t1, 0);		\
+	u1 = fn(u1, t2, 1);		\
+	u1 = fn(u1, t3, 2);		\
+	u1 = fn(u1, t0, 3);		\
+	u2 = fn(u2, t2, 0);		\
+	u2 = fn(u2, t3, 1);		\
+	u2 = fn(u2, t0, 2);		\
+	u2 = fn(u2, t1, 3);		\
+	u3 = fn(u3, t3, 0);		\
+	u3 = fn(u3, t0, 1);		\
+	u3 = fn(u3, t1, 2);		\
+	u3 = fn(u3, t2, 3);		}
+
+void aes_enc_rounds2_rvk32(uint8_t ct[32], const uint8_t pt[32],
+						   const uint32_t rk[], int nr)
+{
+	uint32_t t0, t1, t2, t3, t4, t5, t6, t7;	//	even round state
+	uint32_t u0, u1, u2, u3, u4, u5, u6, u7;	//	odd round state
+	const uint32_t *kp = &rk[4 * nr];		//	key pointer as loop condition
+
+	t0 = rk[0] ^ get32u_le(pt);				//	xor with plaintext blocks
+	t1 = rk[1] ^ get32u_le(pt + 4);
+	t2 = rk[2] ^ get32u_le(pt + 8);
+	t3 = rk[3] ^ get32u_le(pt + 12);
+	t4 = rk[0] ^ get32u_le(pt + 16);
+	t5 = rk[1] ^ get32u_le(pt + 20);
+	t6 = rk[2] ^ get32u_le(pt + 24);
+	t7 = rk[3] ^ get32u_le(pt + 28);
+
+	while (1) {								//	double round
+
+		u0 = u4 = rk[4];					//	fetch odd subkey
+		u1 = u5 = rk[5];
+		u2 = u6 = rk[6];
+		u3 = u7 = rk[7];
+
+		SAES32_ENC_ROUND(_rv32_aes32esmi, u0, u1, u2, u3, t0, t1, t2, t3);
+		SAES32_ENC_ROUND(_rv32_aes32esmi, u4, u5, u6, u7, t4, t5, t6, t7);
+
+		t0 = t4 = rk[8];					//	fetch even subkey
+		t1 = t5 = rk[9];
+		t2 = t6 = rk[10];
+		t3 = t7 = rk[11];
+
+		rk += 8;							//	step key pointer
+		if (rk == kp)						//	final round ?
+			break;
+
+		SAES32_ENC_ROUND(_rv32_aes32esmi, t0, t1, t2, t3, u0, u1, u2, u3);
+		SAES32_ENC_ROUND(_rv32_aes32esmi, t4, t5, t6, t7, u4, u5, u6, u7);
+	}
+
+	SAES32_ENC_ROUND(_rv32_aes32esi, t0, t1, t2, t3, u0, u1, u2, u3);
+	SAES32_ENC_ROUND(_rv32_aes32esi, t4, t5, t6, t7, u4, u5, u6, u7);
+
+	put32u_le(ct, t0);						//	write ciphertext blocks
+	put32u_le(ct + 4, t1);
+	put32u_le(ct + 8, t2);
+	put32u_le(ct + 12, t3);
+	put32u_le(ct + 16, t4);
+	put32u_le(ct + 20, t5);
+	put32u_le(ct + 24, t6);
+	put32u_le(ct + 28, t7);
+}
+
+//	Encrypt n blocks, two at a time
+
+void aes_enc_blocks_rvk32(uint8_t * ct, const uint8_t * pt, size_t n,
+						   const uint32_t rk[], int nr)
+{
+	while (n >= 2) {
+		aes_enc_rounds2_rvk32(ct, pt, rk, nr);
+		ct += 32;
+		pt += 32;
+		n -= 2;
+	}
+	if (n > 0)
+		aes_enc_rounds_rvk32(ct, pt, rk, nr);
+}
+
 //	Wrappers
 
 void aes128_enc_ecb_rvk32(uint8_t ct[16], const uint8_t pt[16],
@@ -136,6 +224,24 @@ void aes256_enc_ecb_rvk32(uint8_t ct[16], const uint8_t pt[16],
 	aes_enc_rounds_rvk32(ct, pt, rk, AES256_ROUNDS);
 }
 
+void aes128_enc_ecbn_rvk32(uint8_t * ct, const uint8_t * pt, size_t n,
+						   const uint32_t rk[AES128_RK_WORDS])
+{
+	aes_enc_blocks_rvk32(ct, pt, n, rk, AES128_ROUNDS);
+}
+
+void aes192_enc_ecbn_rvk32(uint8_t * ct, const uint8_t * pt, size_t n,
+						   const uint32_t rk[AES192_RK_WORDS])
+{
+	aes_enc_blocks_rvk32(ct, pt, n, rk, AES192_ROUNDS);
+}
+
+void aes256_enc_ecbn_rvk32(uint8_t * ct, const uint8_t * pt, size_t n,
+						   const uint32_t rk[AES256_RK_WORDS])
+{
+	aes_enc_blocks_rvk32(ct, pt, n, rk, AES256_ROUNDS);
+}
+
 //	Key schedule for AES-128 Encryption.
 
 void aes128_enc_key_rvk32(uint32_t rk[44], const uint8_t key[16])
@@ -390,6 +496,93 @@ void aes_dec_rounds_rvk32(uint8_t pt[16], const uint8_t ct[16],
 	put32u_le(pt + 12, t3);
 }
 
+//	Two interleaved blocks. One AES32 decryption round: 16 instructions
+
+#define SAES32_DEC_ROUND(fn, u0, u1, u2, u3, t0, t1, t2, t3) {	\
+	u0 = fn(u0, t0, 0);		\
+	u0 = fn(u0, t3, 1);		\
+	u0 = fn(u0, t2, 2);		\
+	u0 = fn(u0, t1, 3);		\
+	u1 = fn(u1, t1, 0);		\
+	u1 = fn(u1, t0, 1);		\
+	u1 = fn(u1, t3, 2);		\
+	u1 = fn(u1, t2, 3);		\
+	u2 = fn(u2, t2, 0);		\
+	u2 = fn(u2, t1, 1);		\
+	u2 = fn(u2, t0, 2);		\
+	u2 = fn(u2, t3, 3);		\
+	u3 = fn(u3, t3, 0);		\
+	u3 = fn(u3, t2, 1);		\
+	u3 = fn(u3, t1, 2);		\
+	u3 = fn(u3, t0, 3);		}
+
+void aes_dec_rounds2_rvk32(uint8_t pt[32], const uint8_t ct[32],
+						   const uint32_t rk[], int nr)
+{
+	uint32_t t0, t1, t2, t3, t4, t5, t6, t7;	//	even round state
+	uint32_t u0, u1, u2, u3, u4, u5, u6, u7;	//	odd round state
+	const uint32_t *kp = &rk[4 * nr];		//	key pointer
+
+	t0 = kp[0] ^ get32u_le(ct);				//	xor with ciphertext blocks
+	t1 = kp[1] ^ get32u_le(ct + 4);
+	t2 = kp[2] ^ get32u_le(ct + 8);
+	t3 = kp[3] ^ get32u_le(ct + 12);
+	t4 = kp[0] ^ get32u_le(ct + 16);
+	t5 = kp[1] ^ get32u_le(ct + 20);
+	t6 = kp[2] ^ get32u_le(ct + 24);
+	t7 = kp[3] ^ get32u_le(ct + 28);
+	kp -= 8;
+
+	while (1) {
+		u0 = u4 = kp[4];					//	fetch odd subkey
+		u1 = u5 = kp[5];
+		u2 = u6 = kp[6];
+		u3 = u7 = kp[7];
+
+		SAES32_DEC_ROUND(_rv32_aes32dsmi, u0, u1, u2, u3, t0, t1, t2, t3);
+		SAES32_DEC_ROUND(_rv32_aes32dsmi, u4, u5, u6, u7, t4, t5, t6, t7);
+
+		t0 = t4 = kp[0];					//	fetch even subkey
+		t1 = t5 = kp[1];
+		t2 = t6 = kp[2];
+		t3 = t7 = kp[3];
+
+		if (kp == rk)						//	final round
+			break;
+		kp -= 8;
+
+		SAES32_DEC_ROUND(_rv32_aes32dsmi, t0, t1, t2, t3, u0, u1, u2, u3);
+		SAES32_DEC_ROUND(_rv32_aes32dsmi, t4, t5, t6, t7, u4, u5, u6, u7);
+	}
+
+	SAES32_DEC_ROUND(_rv32_aes32dsi, t0, t1, t2, t3, u0, u1, u2, u3);
+	SAES32_DEC_ROUND(_rv32_aes32dsi, t4, t5, t6, t7, u4, u5, u6, u7);
+
+	put32u_le(pt, t0);						//	write plaintext blocks
+	put32u_le(pt + 4, t1);
+	put32u_le(pt + 8, t2);
+	put32u_le(pt + 12, t3);
+	put32u_le(pt + 16, t4);
+	put32u_le(pt + 20, t5);
+	put32u_le(pt + 24, t6);
+	put32u_le(pt + 28, t7);
+}
+
+//	Decrypt n blocks, two at a time
+
+void aes_dec_blocks_rvk32(uint8_t * pt, const uint8_t * ct, size_t n,
+						   const uint32_t rk[], int nr)
+{
+	while (n >= 2) {
+		aes_dec_rounds2_rvk32(pt, ct, rk, nr);
+		pt += 32;
+		ct += 32;
+		n -= 2;
+	}
+	if (n > 0)
+		aes_dec_rounds_rvk32(pt, ct, rk, nr);
+}
+
 //	Wrappers
 
 void aes128_dec_ecb_rvk32(uint8_t pt[16], const uint8_t ct[16],
@@ -410,27 +603,32 @@ void aes256_dec_ecb_rvk32(uint8_t pt[16], const uint8_t ct[16],
 	aes_dec_rounds_rvk32(pt, ct, rk, AES256_ROUNDS);
 }
 
+void aes128_dec_ecbn_rvk32(uint8_t * pt, const uint8_t * ct, size_t n,
+						   const uint32_t rk[AES128_RK_WORDS])
+{
+	aes_dec_blocks_rvk32(pt, ct, n, rk, AES128_ROUNDS);
+}
+
+void aes192_dec_ecbn_rvk32(uint8_t * pt, const uint8_t * ct, size_t n,
+						   const uint32_t rk[AES192_RK_WORDS])
+{
+	aes_dec_blocks_rvk32(pt, ct, n, rk, AES192_ROUNDS);
+}
+
+void aes256_dec_ecbn_rvk32(uint8_t * pt, const uint8_t * ct, size_t n,
+						   const uint32_t rk[AES256_RK_WORDS])
+{
+	aes_dec_blocks_rvk32(pt, ct, n, rk, AES256_ROUNDS);
+}
+
 //	Helper: apply inverse mixcolumns to a vector
 
 void rvk32_dec_invmc(uint32_t * v, size_t len)
 {
 	size_t i;
-	uint32_t x, y;
 
 	for (i = 0; i < len; i++) {
-		x = v[i];
-
-		y = _rv32_aes32esi(0, x, 0);			//	SubWord()
-		y = _rv32_aes32esi(y, x, 1);
-		y = _rv32_aes32esi(y, x, 2);
-		y = _rv32_aes32esi(y, x, 3);
-
-		x = _rv32_aes32dsmi(0, y, 0);			//	Just want inv MixCol()
-		x = _rv32_aes32dsmi(x, y, 1);
-		x = _rv32_aes32dsmi(x, y, 2);
-		x = _rv32_aes32dsmi(x, y, 3);
-
-		v[i] = x;
+		v[i] = rvk32_invmc1(v[i]);
 	}
 }
 
@@ -461,4 +659,182 @@ void aes256_dec_key_rvk32(uint32_t rk[60], const uint8_t key[32])
 	rvk32_dec_invmc(rk + 4, AES256_RK_WORDS - 8);
 }
 
+
+//	=== COMBINED KEY SCHEDULE ===
+
+//	Encryption and decryption subkeys in one pass; each middle subkey gets
+//	its inverse mixcolumns while it is still in a register.
+
+#define RVK32_STORE_ED(ek, dk, t0, t1, t2, t3) { \
+	ek[0] = t0;							\
+	ek[1] = t1;							\
+	ek[2] = t2;							\
+	ek[3] = t3;							\
+	dk[0] = rvk32_invmc1(t0);			\
+	dk[1] = rvk32_invmc1(t1);			\
+	dk[2] = rvk32_invmc1(t2);			\
+	dk[3] = rvk32_invmc1(t3);			}
+
+#define RVK32_STORE_2(ek, dk, t0, t1, t2, t3) { \
+	ek[0] = dk[0] = t0;					\
+	ek[1] = dk[1] = t1;					\
+	ek[2] = dk[2] = t2;					\
+	ek[3] = dk[3] = t3;					}
+
+//	Combined key schedule for AES-128.
+
+void aes128_encdec_key_rvk32(uint32_t erk[44], uint32_t drk[44],
+							 const uint8_t key[16])
+{
+	//	AES Round Constants
+	const uint8_t aes_rcon[] = {
+		0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36
+	};
+
+	uint32_t t0, t1, t2, t3, tr;			//	subkey registers
+	const uint32_t *rke = &erk[44 - 4];		//	end pointer
+	const uint8_t *rc = aes_rcon;			//	round constants
+
+	t0 = get32u_le(key);					//	load secret key
+	t1 = get32u_le(key + 4);
+	t2 = get32u_le(key + 8);
+	t3 = get32u_le(key + 12);
+
+	RVK32_STORE_2(erk, drk, t0, t1, t2, t3);	//	first subkey as is
+
+	while (1) {
+
+		erk += 4;							//	step pointers by one subkey
+		drk += 4;
+
+		t0 ^= (uint32_t) * rc++;			//	round constant
+		tr = _rv32_ror(t3, 8);				//	rotate 8 bits (little endian!)
+		t0 = _rv32_aes32esi(t0, tr, 0);		//	SubWord()
+		t0 = _rv32_aes32esi(t0, tr, 1);
+		t0 = _rv32_aes32esi(t0, tr, 2);
+		t0 = _rv32_aes32esi(t0, tr, 3);
+		t1 ^= t0;
+		t2 ^= t1;
+		t3 ^= t2;
+
+		if (erk == rke) {					//	last subkey as is
+			RVK32_STORE_2(erk, drk, t0, t1, t2, t3);
+			return;
+		}
+		RVK32_STORE_ED(erk, drk, t0, t1, t2, t3);
+	}
+}
+
+//	Combined key schedule for AES-192.
+
+void aes192_encdec_key_rvk32(uint32_t erk[52], uint32_t drk[52],
+							 const uint8_t key[24])
+{
+	//	AES Round Constants
+	const uint8_t aes_rcon[] = {
+		0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36
+	};
+
+	uint32_t t0, t1, t2, t3, t4, t5, tr;	//	subkey registers
+	const uint32_t *rke = &erk[52 - 4];		//	end pointer
+	const uint8_t *rc = aes_rcon;			//	round constants
+
+	t0 = get32u_le(key);					//	load secret key
+	t1 = get32u_le(key + 4);
+	t2 = get32u_le(key + 8);
+	t3 = get32u_le(key + 12);
+	t4 = get32u_le(key + 16);
+	t5 = get32u_le(key + 20);
+
+	RVK32_STORE_2(erk, drk, t0, t1, t2, t3);	//	first subkey as is
+
+	while (1) {
+
+		erk[4] = t4;						//	second half of a subkey
+		erk[5] = t5;
+		drk[4] = rvk32_invmc1(t4);
+		drk[5] = rvk32_invmc1(t5);
+		erk += 6;							//	step pointers by 1.5 subkeys
+		drk += 6;
+
+		t0 ^= (uint32_t) * rc++;			//	round constant
+		tr = _rv32_ror(t5, 8);				//	rotate 8 bits (little endian!)
+		t0 = _rv32_aes32esi(t0, tr, 0);		//	SubWord()
+		t0 = _rv32_aes32esi(t0, tr, 1);
+		t0 = _rv32_aes32esi(t0, tr, 2);
+		t0 = _rv32_aes32esi(t0, tr, 3);
+
+		t1 ^= t0;
+		t2 ^= t1;
+		t3 ^= t2;
+		t4 ^= t3;
+		t5 ^= t4;
+
+		if (erk == rke) {					//	last subkey as is
+			RVK32_STORE_2(erk, drk, t0, t1, t2, t3);
+			return;
+		}
+		RVK32_STORE_ED(erk, drk, t0, t1, t2, t3);
+	}
+}
+
+//	Combined key schedule for AES-256.
+
+void aes256_encdec_key_rvk32(uint32_t erk[60], uint32_t drk[60],
+							 const uint8_t key[32])
+{
+	//	AES Round Constants
+	const uint8_t aes_rcon[] = {
+		0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36
+	};
+
+	uint32_t t0, t1, t2, t3, t4, t5, t6, t7, tr;	// subkey registers
+	const uint32_t *rke = &erk[60 - 4];		//	end pointer
+	const uint8_t *rc = aes_rcon;			//	round constants
+
+	t0 = get32u_le(key);
+	t1 = get32u_le(key + 4);
+	t2 = get32u_le(key + 8);
+	t3 = get32u_le(key + 12);
+	t4 = get32u_le(key + 16);
+	t5 = get32u_le(key + 20);
+	t6 = get32u_le(key + 24);
+	t7 = get32u_le(key + 28);
+
+	RVK32_STORE_2(erk, drk, t0, t1, t2, t3);	//	first subkey as is
+
+	while (1) {
+
+		erk += 4;							//	odd subkey
+		drk += 4;
+		RVK32_STORE_ED(erk, drk, t4, t5, t6, t7);
+		erk += 4;
+		drk += 4;
+
+		t0 ^= (uint32_t) * rc++;			//	round constant
+		tr = _rv32_ror(t7, 8);				//	rotate 8 bits (little endian!)
+		t0 = _rv32_aes32esi(t0, tr, 0);		//	SubWord()
+		t0 = _rv32_aes32esi(t0, tr, 1);
+		t0 = _rv32_aes32esi(t0, tr, 2);
+		t0 = _rv32_aes32esi(t0, tr, 3);
+		t1 ^= t0;
+		t2 ^= t1;
+		t3 ^= t2;
+
+		if (erk == rke) {					//	last subkey as is
+			RVK32_STORE_2(erk, drk, t0, t1, t2, t3);
+			return;
+		}
+		RVK32_STORE_ED(erk, drk, t0, t1, t2, t3);
+
+		t4 = _rv32_aes32esi(t4, t3, 0);		//	SubWord() - NO rotation
+		t4 = _rv32_aes32esi(t4, t3, 1);
+		t4 = _rv32_aes32esi(t4, t3, 2);
+		t4 = _rv32_aes32esi(t4, t3, 3);
+		t5 ^= t4;
+		t6 ^= t5;
+		t7 ^= t6;
+	}
+}
+
 #endif	//	RVKINTRIN_RV32
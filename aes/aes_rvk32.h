@@ -12,6 +12,8 @@ extern "C" {
 #endif
 
 #include <stdint.h>
+#include <stddef.h>
+#include "riscv_crypto.h"
 
 //	Set encryption key
 
@@ -35,6 +37,17 @@ void aes192_enc_ecb_rvk32(uint8_t ct[16], const uint8_t pt[16],
 void aes256_enc_ecb_rvk32(uint8_t ct[16], const uint8_t pt[16],
 						   const uint32_t rk[AES256_RK_WORDS]);
 
+//	Encrypt n blocks
+
+void aes128_enc_ecbn_rvk32(uint8_t * ct, const uint8_t * pt, size_t n,
+						   const uint32_t rk[AES128_RK_WORDS]);
+
+void aes192_enc_ecbn_rvk32(uint8_t * ct, const uint8_t * pt, size_t n,
+						   const uint32_t rk[AES192_RK_WORDS]);
+
+void aes256_enc_ecbn_rvk32(uint8_t * ct, const uint8_t * pt, size_t n,
+						   const uint32_t rk[AES256_RK_WORDS]);
+
 
 //	Set decryption key
 
@@ -58,6 +71,55 @@ void aes192_dec_ecb_rvk32(uint8_t pt[16], const uint8_t ct[16],
 void aes256_dec_ecb_rvk32(uint8_t pt[16], const uint8_t ct[16],
 						   const uint32_t rk[AES256_RK_WORDS]);
 
+//	Decrypt n blocks
+
+void aes128_dec_ecbn_rvk32(uint8_t * pt, const uint8_t * ct, size_t n,
+						   const uint32_t rk[AES128_RK_WORDS]);
+
+void aes192_dec_ecbn_rvk32(uint8_t * pt, const uint8_t * ct, size_t n,
+						   const uint32_t rk[AES192_RK_WORDS]);
+
+void aes256_dec_ecbn_rvk32(uint8_t * pt, const uint8_t * ct, size_t n,
+						   const uint32_t rk[AES256_RK_WORDS]);
+
+//	Set encryption and decryption keys in one pass
+
+void aes128_encdec_key_rvk32(uint32_t erk[AES128_RK_WORDS],
+							 uint32_t drk[AES128_RK_WORDS],
+							 const uint8_t key[16]);
+
+void aes192_encdec_key_rvk32(uint32_t erk[AES192_RK_WORDS],
+							 uint32_t drk[AES192_RK_WORDS],
+							 const uint8_t key[24]);
+
+void aes256_encdec_key_rvk32(uint32_t erk[AES256_RK_WORDS],
+							 uint32_t drk[AES256_RK_WORDS],
+							 const uint8_t key[32]);
+
+#ifdef RVKINTRIN_RV32
+
+//	Inverse MixColumns of a single subkey word, for the equivalent inverse
+//	cipher. RV32 has no AES64IM, so this is 8 instructions per word.
+
+static inline uint32_t rvk32_invmc1(uint32_t x)
+{
+	uint32_t y;
+
+	y = _rv32_aes32esi(0, x, 0);				//	SubWord()
+	y = _rv32_aes32esi(y, x, 1);
+	y = _rv32_aes32esi(y, x, 2);
+	y = _rv32_aes32esi(y, x, 3);
+
+	x = _rv32_aes32dsmi(0, y, 0);				//	Just want inv MixCol()
+	x = _rv32_aes32dsmi(x, y, 1);
+	x = _rv32_aes32dsmi(x, y, 2);
+	x = _rv32_aes32dsmi(x, y, 3);
+
+	return x;
+}
+
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -9,9 +9,15 @@
 #ifdef RVKINTRIN_RV64
 
 #include "aes_api.h"
+#include "rvk_align.h"
 #include "rv_endian.h"
 #include <stddef.h>
 
+//	misaligned bulk data is processed in batches of this many blocks
+#ifndef AES64_UA_BLKS
+#define AES64_UA_BLKS 16
+#endif
+
 //	Encrypt rounds. Implements AES-128/192/256 depending on nr = {10,12,14}
 
 //	Per round: 2 * ENCSM, 2 * load, 2 * XOR
@@ -32,8 +38,7 @@ void aes_enc_rounds_rvk64(uint8_t ct[16], const uint8_t pt[16],
 
 	uint64_t t0, t1, u0, u1, k0, k1;
 
-	t0 = ((const uint64_t *) pt)[0];		//	get plaintext
-	t1 = ((const uint64_t *) pt)[1];
+	RVK_GET64X2(t0, t1, pt);				//	get plaintext
 
 	k0 = kp[0];								//	load first round
 	k1 = kp[1];
@@ -74,8 +79,171 @@ void aes_enc_rounds_rvk64(uint8_t ct[16], const uint8_t pt[16],
 	t0 = t0 ^ k0;							//	last round key
 	t1 = t1 ^ k1;
 
-	((uint64_t *) ct)[0] = t0;				//	store ciphertext
-	((uint64_t *) ct)[1] = t1;
+	RVK_PUT64X2(ct, t0, t1);				//	store ciphertext
+}
+
+//	Four interleaved blocks, so that the round instructions of independent
+//	blocks can issue back-to-back. Per round: 8 * ENCSM, 2 * load, 8 * XOR.
+//	"pt" and "ct" must be 8-byte aligned.
+
+#define SAES64_ENC_ROUND4(r, s, kp) {		\
+	k0 = kp[0];								\
+	k1 = kp[1];								\
+	r##0 = _rv64_aes64esm(s##0, s##1) ^ k0;	\
+	r##1 = _rv64_aes64esm(s##1, s##0) ^ k1;	\
+	r##2 = _rv64_aes64esm(s##2, s##3) ^ k0;	\
+	r##3 = _rv64_aes64esm(s##3, s##2) ^ k1;	\
+	r##4 = _rv64_aes64esm(s##4, s##5) ^ k0;	\
+	r##5 = _rv64_aes64esm(s##5, s##4) ^ k1;	\
+	r##6 = _rv64_aes64esm(s##6, s##7) ^ k0;	\
+	r##7 = _rv64_aes64esm(s##7, s##6) ^ k1;	}
+
+void aes_enc_rounds4_rvk64(uint8_t ct[64], const uint8_t pt[64],
+						   const uint32_t rk[], int nr)
+{
+	const uint64_t *kp = (const uint64_t *) rk;
+	const uint64_t *ke = kp + 2 * nr;		//	last round key
+	const uint64_t *vp = (const uint64_t *) pt;
+	uint64_t *wp = (uint64_t *) ct;
+
+	uint64_t t0, t1, t2, t3, t4, t5, t6, t7;
+	uint64_t u0, u1, u2, u3, u4, u5, u6, u7, k0, k1;
+
+	k0 = kp[0];								//	first round key
+	k1 = kp[1];
+	t0 = vp[0] ^ k0;						//	get plaintext
+	t1 = vp[1] ^ k1;
+	t2 = vp[2] ^ k0;
+	t3 = vp[3] ^ k1;
+	t4 = vp[4] ^ k0;
+	t5 = vp[5] ^ k1;
+	t6 = vp[6] ^ k0;
+	t7 = vp[7] ^ k1;
+
+	while (1) {								//	double round
+		kp += 2;
+		SAES64_ENC_ROUND4(u, t, kp);
+		kp += 2;
+		if (kp == ke)						//	final round ?
+			break;
+		SAES64_ENC_ROUND4(t, u, kp);
+	}
+
+	k0 = ke[0];								//	last round key
+	k1 = ke[1];
+	t0 = _rv64_aes64es(u0, u1) ^ k0;		//	Final round; ENCS not ENCSM
+	t1 = _rv64_aes64es(u1, u0) ^ k1;
+	t2 = _rv64_aes64es(u2, u3) ^ k0;
+	t3 = _rv64_aes64es(u3, u2) ^ k1;
+	t4 = _rv64_aes64es(u4, u5) ^ k0;
+	t5 = _rv64_aes64es(u5, u4) ^ k1;
+	t6 = _rv64_aes64es(u6, u7) ^ k0;
+	t7 = _rv64_aes64es(u7, u6) ^ k1;
+
+	wp[0] = t0;								//	store ciphertext
+	wp[1] = t1;
+	wp[2] = t2;
+	wp[3] = t3;
+	wp[4] = t4;
+	wp[5] = t5;
+	wp[6] = t6;
+	wp[7] = t7;
+}
+
+//	Two interleaved blocks, for the 2- and 3-block tails (e.g. the CCM
+//	MAC and CTR pair). "pt" and "ct" must be 8-byte aligned.
+//	Per round: 4 * ENCSM, 2 * load, 4 * XOR
+
+#define SAES64_ENC_ROUND2(r, s, kp) {		\
+	k0 = kp[0];								\
+	k1 = kp[1];								\
+	r##0 = _rv64_aes64esm(s##0, s##1) ^ k0;	\
+	r##1 = _rv64_aes64esm(s##1, s##0) ^ k1;	\
+	r##2 = _rv64_aes64esm(s##2, s##3) ^ k0;	\
+	r##3 = _rv64_aes64esm(s##3, s##2) ^ k1;	}
+
+void aes_enc_rounds2_rvk64(uint8_t ct[32], const uint8_t pt[32],
+						   const uint32_t rk[], int nr)
+{
+	const uint64_t *kp = (const uint64_t *) rk;
+	const uint64_t *ke = kp + 2 * nr;		//	last round key
+	const uint64_t *vp = (const uint64_t *) pt;
+	uint64_t *wp = (uint64_t *) ct;
+
+	uint64_t t0, t1, t2, t3, u0, u1, u2, u3, k0, k1;
+
+	k0 = kp[0];								//	first round key
+	k1 = kp[1];
+	t0 = vp[0] ^ k0;						//	get plaintext
+	t1 = vp[1] ^ k1;
+	t2 = vp[2] ^ k0;
+	t3 = vp[3] ^ k1;
+
+	while (1) {								//	double round
+		kp += 2;
+		SAES64_ENC_ROUND2(u, t, kp);
+		kp += 2;
+		if (kp == ke)						//	final round ?
+			break;
+		SAES64_ENC_ROUND2(t, u, kp);
+	}
+
+	k0 = ke[0];								//	last round key
+	k1 = ke[1];
+	t0 = _rv64_aes64es(u0, u1) ^ k0;		//	Final round; ENCS not ENCSM
+	t1 = _rv64_aes64es(u1, u0) ^ k1;
+	t2 = _rv64_aes64es(u2, u3) ^ k0;
+	t3 = _rv64_aes64es(u3, u2) ^ k1;
+
+	wp[0] = t0;								//	store ciphertext
+	wp[1] = t1;
+	wp[2] = t2;
+	wp[3] = t3;
+}
+
+//	Encrypt n blocks, four at a time; "ct" and "pt" are 8-byte aligned
+
+static inline void aes_enc_blocks_a64(uint8_t * ct, const uint8_t * pt,
+									  size_t n, const uint32_t rk[], int nr)
+{
+	while (n >= 4) {
+		aes_enc_rounds4_rvk64(ct, pt, rk, nr);
+		ct += 64;
+		pt += 64;
+		n -= 4;
+	}
+	if (n >= 2) {
+		aes_enc_rounds2_rvk64(ct, pt, rk, nr);
+		ct += 32;
+		pt += 32;
+		n -= 2;
+	}
+	if (n > 0)
+		aes_enc_rounds_rvk64(ct, pt, rk, nr);
+}
+
+//	Misaligned buffers are assembled into aligned words AES64_UA_BLKS blocks
+//	at a time, so the cost of the partial words at the ends is amortized.
+
+void aes_enc_blocks_rvk64(uint8_t * ct, const uint8_t * pt, size_t n,
+						   const uint32_t rk[], int nr)
+{
+	uint64_t w[2 * AES64_UA_BLKS];
+	size_t l;
+
+	if (RVK_IS_ALIGNED(ct, 8) && RVK_IS_ALIGNED(pt, 8)) {
+		aes_enc_blocks_a64(ct, pt, n, rk, nr);
+		return;
+	}
+	while (n > 0) {
+		l = n < AES64_UA_BLKS ? n : AES64_UA_BLKS;
+		rvk_load64_ua(w, pt, 2 * l);
+		aes_enc_blocks_a64((uint8_t *) w, (const uint8_t *) w, l, rk, nr);
+		rvk_store64_ua(ct, w, 2 * l);
+		ct += 16 * l;
+		pt += 16 * l;
+		n -= l;
+	}
 }
 
 //	Wrappers
@@ -98,6 +266,24 @@ void aes256_enc_ecb_rvk64(uint8_t ct[16], const uint8_t pt[16],
 	aes_enc_rounds_rvk64(ct, pt, rk, AES256_ROUNDS);
 }
 
+void aes128_enc_ecbn_rvk64(uint8_t * ct, const uint8_t * pt, size_t n,
+						   const uint32_t rk[AES128_RK_WORDS])
+{
+	aes_enc_blocks_rvk64(ct, pt, n, rk, AES128_ROUNDS);
+}
+
+void aes192_enc_ecbn_rvk64(uint8_t * ct, const uint8_t * pt, size_t n,
+						   const uint32_t rk[AES192_RK_WORDS])
+{
+	aes_enc_blocks_rvk64(ct, pt, n, rk, AES192_ROUNDS);
+}
+
+void aes256_enc_ecbn_rvk64(uint8_t * ct, const uint8_t * pt, size_t n,
+						   const uint32_t rk[AES256_RK_WORDS])
+{
+	aes_enc_blocks_rvk64(ct, pt, n, rk, AES256_ROUNDS);
+}
+
 //	Key schedule for AES-128 Encryption.
 //	For each round 1 * SAES64.KS1, 2 * SAES64.KS2 and 2 * store
 
@@ -228,8 +414,7 @@ void aes_dec_rounds_rvk64(uint8_t pt[16], const uint8_t ct[16],
 
 	uint64_t t0, t1, u0, u1, k0, k1;
 
-	t0 = ((const uint64_t *) ct)[0];		//	get ciphertext
-	t1 = ((const uint64_t *) ct)[1];
+	RVK_GET64X2(t0, t1, ct);				//	get ciphertext
 
 	//	In reality we would entirely inline these for all 128/192/256 versions
 
@@ -263,13 +448,137 @@ void aes_dec_rounds_rvk64(uint8_t pt[16], const uint8_t ct[16],
 	t0 = t0 ^ k0;
 	t1 = t1 ^ k1;
 
-	((uint64_t *) pt)[0] = t0;				//	store plaintext
-	((uint64_t *) pt)[1] = t1;
+	RVK_PUT64X2(pt, t0, t1);				//	store plaintext
 
 	return;
 
 }
 
+//	Four interleaved blocks. Per round: 2 * load, 8 * XOR, 8 * DECSM
+
+#define SAES64_DEC_ROUND4(r, s, kp) {		\
+	k0 = kp[0];								\
+	k1 = kp[1];								\
+	s##0 = s##0 ^ k0;						\
+	s##1 = s##1 ^ k1;						\
+	s##2 = s##2 ^ k0;						\
+	s##3 = s##3 ^ k1;						\
+	s##4 = s##4 ^ k0;						\
+	s##5 = s##5 ^ k1;						\
+	s##6 = s##6 ^ k0;						\
+	s##7 = s##7 ^ k1;						\
+	r##0 = _rv64_aes64dsm(s##0, s##1);		\
+	r##1 = _rv64_aes64dsm(s##1, s##0);		\
+	r##2 = _rv64_aes64dsm(s##2, s##3);		\
+	r##3 = _rv64_aes64dsm(s##3, s##2);		\
+	r##4 = _rv64_aes64dsm(s##4, s##5);		\
+	r##5 = _rv64_aes64dsm(s##5, s##4);		\
+	r##6 = _rv64_aes64dsm(s##6, s##7);		\
+	r##7 = _rv64_aes64dsm(s##7, s##6);		}
+
+void aes_dec_rounds4_rvk64(uint8_t pt[64], const uint8_t ct[64],
+						   const uint32_t rk[], int nr)
+{
+	const uint64_t *kp = ((const uint64_t *) rk) + 2 * nr;
+	const uint64_t *ke = ((const uint64_t *) rk) + 2;
+	const uint64_t *vp = (const uint64_t *) ct;
+	uint64_t *wp = (uint64_t *) pt;
+
+	uint64_t t0, t1, t2, t3, t4, t5, t6, t7;
+	uint64_t u0, u1, u2, u3, u4, u5, u6, u7, k0, k1;
+
+	t0 = vp[0];								//	get ciphertext
+	t1 = vp[1];
+	t2 = vp[2];
+	t3 = vp[3];
+	t4 = vp[4];
+	t5 = vp[5];
+	t6 = vp[6];
+	t7 = vp[7];
+
+	while (1) {								//	double round
+		SAES64_DEC_ROUND4(u, t, kp);
+		kp -= 2;
+		if (kp == ke)						//	final round ?
+			break;
+		SAES64_DEC_ROUND4(t, u, kp);
+		kp -= 2;
+	}
+
+	k0 = ke[0];								//	final decrypt round
+	k1 = ke[1];
+	u0 = u0 ^ k0;
+	u1 = u1 ^ k1;
+	u2 = u2 ^ k0;
+	u3 = u3 ^ k1;
+	u4 = u4 ^ k0;
+	u5 = u5 ^ k1;
+	u6 = u6 ^ k0;
+	u7 = u7 ^ k1;
+	k0 = ke[-2];							//	first round key
+	k1 = ke[-1];
+	t0 = _rv64_aes64ds(u0, u1) ^ k0;		//	DECS instead of DECSM
+	t1 = _rv64_aes64ds(u1, u0) ^ k1;
+	t2 = _rv64_aes64ds(u2, u3) ^ k0;
+	t3 = _rv64_aes64ds(u3, u2) ^ k1;
+	t4 = _rv64_aes64ds(u4, u5) ^ k0;
+	t5 = _rv64_aes64ds(u5, u4) ^ k1;
+	t6 = _rv64_aes64ds(u6, u7) ^ k0;
+	t7 = _rv64_aes64ds(u7, u6) ^ k1;
+
+	wp[0] = t0;								//	store plaintext
+	wp[1] = t1;
+	wp[2] = t2;
+	wp[3] = t3;
+	wp[4] = t4;
+	wp[5] = t5;
+	wp[6] = t6;
+	wp[7] = t7;
+}
+
+//	Decrypt n blocks, four at a time; "pt" and "ct" are 8-byte aligned
+
+static inline void aes_dec_blocks_a64(uint8_t * pt, const uint8_t * ct,
+									  size_t n, const uint32_t rk[], int nr)
+{
+	while (n >= 4) {
+		aes_dec_rounds4_rvk64(pt, ct, rk, nr);
+		pt += 64;
+		ct += 64;
+		n -= 4;
+	}
+	while (n > 0) {
+		aes_dec_rounds_rvk64(pt, ct, rk, nr);
+		pt += 16;
+		ct += 16;
+		n--;
+	}
+}
+
+//	Misaligned buffers are assembled into aligned words AES64_UA_BLKS blocks
+//	at a time, so the cost of the partial words at the ends is amortized.
+
+void aes_dec_blocks_rvk64(uint8_t * pt, const uint8_t * ct, size_t n,
+						   const uint32_t rk[], int nr)
+{
+	uint64_t w[2 * AES64_UA_BLKS];
+	size_t l;
+
+	if (RVK_IS_ALIGNED(pt, 8) && RVK_IS_ALIGNED(ct, 8)) {
+		aes_dec_blocks_a64(pt, ct, n, rk, nr);
+		return;
+	}
+	while (n > 0) {
+		l = n < AES64_UA_BLKS ? n : AES64_UA_BLKS;
+		rvk_load64_ua(w, ct, 2 * l);
+		aes_dec_blocks_a64((uint8_t *) w, (const uint8_t *) w, l, rk, nr);
+		rvk_store64_ua(pt, w, 2 * l);
+		pt += 16 * l;
+		ct += 16 * l;
+		n -= l;
+	}
+}
+
 //	Wrappers
 
 void aes128_dec_ecb_rvk64(uint8_t pt[16], const uint8_t ct[16],
@@ -290,6 +599,24 @@ void aes256_dec_ecb_rvk64(uint8_t pt[16], const uint8_t ct[16],
 	aes_dec_rounds_rvk64(pt, ct, rk, AES256_ROUNDS);
 }
 
+void aes128_dec_ecbn_rvk64(uint8_t * pt, const uint8_t * ct, size_t n,
+						   const uint32_t rk[AES128_RK_WORDS])
+{
+	aes_dec_blocks_rvk64(pt, ct, n, rk, AES128_ROUNDS);
+}
+
+void aes192_dec_ecbn_rvk64(uint8_t * pt, const uint8_t * ct, size_t n,
+						   const uint32_t rk[AES192_RK_WORDS])
+{
+	aes_dec_blocks_rvk64(pt, ct, n, rk, AES192_ROUNDS);
+}
+
+void aes256_dec_ecbn_rvk64(uint8_t * pt, const uint8_t * ct, size_t n,
+						   const uint32_t rk[AES256_RK_WORDS])
+{
+	aes_dec_blocks_rvk64(pt, ct, n, rk, AES256_ROUNDS);
+}
+
 //	Helper: apply inverse mixcolumns to a vector
 
 static inline void rvk64_dec_invmc(uint64_t * v, size_t len)
@@ -328,5 +655,253 @@ void aes256_dec_key_rvk64(uint32_t rk[60], const uint8_t key[32])
 	rvk64_dec_invmc(((uint64_t *) rk) + 2, AES256_RK_WORDS / 2 - 4);
 }
 
+
+//	=== COMBINED KEY SCHEDULE ===
+
+//	Encryption and decryption subkeys in one pass. Word w of an expanded
+//	key with nw words is a middle-round word unless w < 2 or w >= nw - 2;
+//	in the fully unrolled schedules below w is a constant and the test
+//	folds away.
+
+static inline void rvk64_store_ed(uint64_t * ep, uint64_t * dp, int w,
+								  int nw, uint64_t k)
+{
+	ep[w] = k;
+	dp[w] = (w < 2 || w >= nw - 2) ? k : (uint64_t) _rv64_aes64im(k);
+}
+
+#define SAES64_KEY128_ED_STEP(i) {		\
+	rvk64_store_ed(kp, dp, 2 * i, 22, k0);		\
+	rvk64_store_ed(kp, dp, 2 * i + 1, 22, k1);	\
+	ks = _rv64_aes64ks1i(k1, i);		\
+	k0 = _rv64_aes64ks2(ks, k0);	\
+	k1 = _rv64_aes64ks2(k0, k1);	}
+
+void aes128_encdec_key_rvk64(uint32_t erk[44], uint32_t drk[44],
+							 const uint8_t key[16])
+{
+	uint64_t *kp = (uint64_t *) erk;		//	key pointers
+	uint64_t *dp = (uint64_t *) drk;
+	uint64_t k0, k1, ks;
+
+	k0 = get64u_le(key);					//	load secret key
+	k1 = get64u_le(key + 8);
+	SAES64_KEY128_ED_STEP(0);				//	+2 * IM per step
+	SAES64_KEY128_ED_STEP(1);
+	SAES64_KEY128_ED_STEP(2);
+	SAES64_KEY128_ED_STEP(3);
+	SAES64_KEY128_ED_STEP(4);
+	SAES64_KEY128_ED_STEP(5);
+	SAES64_KEY128_ED_STEP(6);
+	SAES64_KEY128_ED_STEP(7);
+	SAES64_KEY128_ED_STEP(8);
+	SAES64_KEY128_ED_STEP(9);
+	kp[20] = dp[20] = k0;					//	last round key
+	kp[21] = dp[21] = k1;
+}
+
+#define SAES64_KEY192_ED_STEP(i) {		\
+	rvk64_store_ed(kp, dp, 3 * i, 26, k0);		\
+	rvk64_store_ed(kp, dp, 3 * i + 1, 26, k1);	\
+	rvk64_store_ed(kp, dp, 3 * i + 2, 26, k2);	\
+	ks = _rv64_aes64ks1i(k2, i);		\
+	k0 = _rv64_aes64ks2(ks, k0);	\
+	k1 = _rv64_aes64ks2(k0, k1);	\
+	k2 = _rv64_aes64ks2(k1, k2);	}
+
+void aes192_encdec_key_rvk64(uint32_t erk[52], uint32_t drk[52],
+							 const uint8_t key[24])
+{
+	uint64_t *kp = (uint64_t *) erk;		//	key pointers
+	uint64_t *dp = (uint64_t *) drk;
+	uint64_t k0, k1, k2, ks;
+
+	k0 = get64u_le(key);					//	load secret key
+	k1 = get64u_le(key + 8);
+	k2 = get64u_le(key + 16);
+	SAES64_KEY192_ED_STEP(0);
+	SAES64_KEY192_ED_STEP(1);
+	SAES64_KEY192_ED_STEP(2);
+	SAES64_KEY192_ED_STEP(3);
+	SAES64_KEY192_ED_STEP(4);
+	SAES64_KEY192_ED_STEP(5);
+	SAES64_KEY192_ED_STEP(6);
+	rvk64_store_ed(kp, dp, 21, 26, k0);		//	last full state
+	rvk64_store_ed(kp, dp, 22, 26, k1);
+	rvk64_store_ed(kp, dp, 23, 26, k2);
+	ks = _rv64_aes64ks1i(k2, 7);
+	k0 = _rv64_aes64ks2(ks, k0);
+	k1 = _rv64_aes64ks2(k0, k1);
+	kp[24] = dp[24] = k0;					//	last round key
+	kp[25] = dp[25] = k1;
+}
+
+#define SAES64_KEY256_ED_STEP(i) {		\
+	rvk64_store_ed(kp, dp, 4 * i, 30, k0);		\
+	rvk64_store_ed(kp, dp, 4 * i + 1, 30, k1);	\
+	rvk64_store_ed(kp, dp, 4 * i + 2, 30, k2);	\
+	rvk64_store_ed(kp, dp, 4 * i + 3, 30, k3);	\
+	ks = _rv64_aes64ks1i(k3, i);		\
+	k0 = _rv64_aes64ks2(ks, k0);	\
+	k1 = _rv64_aes64ks2(k0, k1);	\
+	ks = _rv64_aes64ks1i(k1, 10);	\
+	k2 = _rv64_aes64ks2(ks, k2);	\
+	k3 = _rv64_aes64ks2(k2, k3);	}
+
+void aes256_encdec_key_rvk64(uint32_t erk[60], uint32_t drk[60],
+							 const uint8_t key[32])
+{
+	uint64_t *kp = (uint64_t *) erk;		//	key pointers
+	uint64_t *dp = (uint64_t *) drk;
+	uint64_t k0, k1, k2, k3, ks;
+
+	k0 = get64u_le(key);					//	load secret key
+	k1 = get64u_le(key + 8);
+	k2 = get64u_le(key + 16);
+	k3 = get64u_le(key + 24);
+	SAES64_KEY256_ED_STEP(0);
+	SAES64_KEY256_ED_STEP(1);
+	SAES64_KEY256_ED_STEP(2);
+	SAES64_KEY256_ED_STEP(3);
+	SAES64_KEY256_ED_STEP(4);
+	SAES64_KEY256_ED_STEP(5);
+	rvk64_store_ed(kp, dp, 24, 30, k0);		//	last full state
+	rvk64_store_ed(kp, dp, 25, 30, k1);
+	rvk64_store_ed(kp, dp, 26, 30, k2);
+	rvk64_store_ed(kp, dp, 27, 30, k3);
+	ks = _rv64_aes64ks1i(k3, 6);
+	k0 = _rv64_aes64ks2(ks, k0);
+	k1 = _rv64_aes64ks2(k0, k1);
+	kp[28] = dp[28] = k0;					//	last round key
+	kp[29] = dp[29] = k1;
+}
+
+//	=== BATCHED KEY SCHEDULE ===
+
+//	Two independent keys per pass so that the KS1/KS2 dependency chains
+//	of one key fill the latency slots of the other.
+
+#define SAES64_KEY128_STEP2(i) {		\
+	kp[2 * i] = k0;					\
+	kp[2 * i + 1] = k1;				\
+	kq[2 * i] = j0;					\
+	kq[2 * i + 1] = j1;				\
+	ks = _rv64_aes64ks1i(k1, i);	\
+	js = _rv64_aes64ks1i(j1, i);	\
+	k0 = _rv64_aes64ks2(ks, k0);	\
+	j0 = _rv64_aes64ks2(js, j0);	\
+	k1 = _rv64_aes64ks2(k0, k1);	\
+	j1 = _rv64_aes64ks2(j0, j1);	}
+
+void aes128_enc_key_n_rvk64(uint32_t * rk, const uint8_t * key, size_t n)
+{
+	uint64_t *kp, *kq;
+	uint64_t k0, k1, j0, j1, ks, js;
+
+	while (n >= 2) {
+		kp = (uint64_t *) rk;
+		kq = (uint64_t *) (rk + AES128_RK_WORDS);
+		k0 = get64u_le(key);
+		k1 = get64u_le(key + 8);
+		j0 = get64u_le(key + 16);
+		j1 = get64u_le(key + 24);
+		SAES64_KEY128_STEP2(0);
+		SAES64_KEY128_STEP2(1);
+		SAES64_KEY128_STEP2(2);
+		SAES64_KEY128_STEP2(3);
+		SAES64_KEY128_STEP2(4);
+		SAES64_KEY128_STEP2(5);
+		SAES64_KEY128_STEP2(6);
+		SAES64_KEY128_STEP2(7);
+		SAES64_KEY128_STEP2(8);
+		SAES64_KEY128_STEP2(9);
+		kp[20] = k0;
+		kp[21] = k1;
+		kq[20] = j0;
+		kq[21] = j1;
+		rk += 2 * AES128_RK_WORDS;
+		key += 2 * 16;
+		n -= 2;
+	}
+	if (n > 0)
+		aes128_enc_key_rvk64(rk, key);
+}
+
+void aes192_enc_key_n_rvk64(uint32_t * rk, const uint8_t * key, size_t n)
+{
+	for (; n > 0; n--, rk += AES192_RK_WORDS, key += 24)
+		aes192_enc_key_rvk64(rk, key);
+}
+
+#define SAES64_KEY256_STEP2(i) {		\
+	kp[4 * i] = k0;					\
+	kp[4 * i + 1] = k1;				\
+	kp[4 * i + 2] = k2;				\
+	kp[4 * i + 3] = k3;				\
+	kq[4 * i] = j0;					\
+	kq[4 * i + 1] = j1;				\
+	kq[4 * i + 2] = j2;				\
+	kq[4 * i + 3] = j3;				\
+	ks = _rv64_aes64ks1i(k3, i);	\
+	js = _rv64_aes64ks1i(j3, i);	\
+	k0 = _rv64_aes64ks2(ks, k0);	\
+	j0 = _rv64_aes64ks2(js, j0);	\
+	k1 = _rv64_aes64ks2(k0, k1);	\
+	j1 = _rv64_aes64ks2(j0, j1);	\
+	ks = _rv64_aes64ks1i(k1, 10);	\
+	js = _rv64_aes64ks1i(j1, 10);	\
+	k2 = _rv64_aes64ks2(ks, k2);	\
+	j2 = _rv64_aes64ks2(js, j2);	\
+	k3 = _rv64_aes64ks2(k2, k3);	\
+	j3 = _rv64_aes64ks2(j2, j3);	}
+
+void aes256_enc_key_n_rvk64(uint32_t * rk, const uint8_t * key, size_t n)
+{
+	uint64_t *kp, *kq;
+	uint64_t k0, k1, k2, k3, j0, j1, j2, j3, ks, js;
+
+	while (n >= 2) {
+		kp = (uint64_t *) rk;
+		kq = (uint64_t *) (rk + AES256_RK_WORDS);
+		k0 = get64u_le(key);
+		k1 = get64u_le(key + 8);
+		k2 = get64u_le(key + 16);
+		k3 = get64u_le(key + 24);
+		j0 = get64u_le(key + 32);
+		j1 = get64u_le(key + 40);
+		j2 = get64u_le(key + 48);
+		j3 = get64u_le(key + 56);
+		SAES64_KEY256_STEP2(0);
+		SAES64_KEY256_STEP2(1);
+		SAES64_KEY256_STEP2(2);
+		SAES64_KEY256_STEP2(3);
+		SAES64_KEY256_STEP2(4);
+		SAES64_KEY256_STEP2(5);
+		kp[24] = k0;
+		kp[25] = k1;
+		kp[26] = k2;
+		kp[27] = k3;
+		kq[24] = j0;
+		kq[25] = j1;
+		kq[26] = j2;
+		kq[27] = j3;
+		ks = _rv64_aes64ks1i(k3, 6);
+		js = _rv64_aes64ks1i(j3, 6);
+		k0 = _rv64_aes64ks2(ks, k0);
+		j0 = _rv64_aes64ks2(js, j0);
+		k1 = _rv64_aes64ks2(k0, k1);
+		j1 = _rv64_aes64ks2(j0, j1);
+		kp[28] = k0;
+		kp[29] = k1;
+		kq[28] = j0;
+		kq[29] = j1;
+		rk += 2 * AES256_RK_WORDS;
+		key += 2 * 32;
+		n -= 2;
+	}
+	if (n > 0)
+		aes256_enc_key_rvk64(rk, key);
+}
+
 #endif	//	RVKINTRIN_RV64
 
@@ -12,6 +12,7 @@ extern "C" {
 #endif
 
 #include <stdint.h>
+#include <stddef.h>
 
 //	Set encryption key
 
@@ -35,6 +36,17 @@ void aes192_enc_ecb_rvk64(uint8_t ct[16], const uint8_t pt[16],
 void aes256_enc_ecb_rvk64(uint8_t ct[16], const uint8_t pt[16],
 						   const uint32_t rk[AES256_RK_WORDS]);
 
+//	Encrypt n blocks
+
+void aes128_enc_ecbn_rvk64(uint8_t * ct, const uint8_t * pt, size_t n,
+						   const uint32_t rk[AES128_RK_WORDS]);
+
+void aes192_enc_ecbn_rvk64(uint8_t * ct, const uint8_t * pt, size_t n,
+						   const uint32_t rk[AES192_RK_WORDS]);
+
+void aes256_enc_ecbn_rvk64(uint8_t * ct, const uint8_t * pt, size_t n,
+						   const uint32_t rk[AES256_RK_WORDS]);
+
 
 //	Set decryption key
 
@@ -58,6 +70,39 @@ void aes192_dec_ecb_rvk64(uint8_t pt[16], const uint8_t ct[16],
 void aes256_dec_ecb_rvk64(uint8_t pt[16], const uint8_t ct[16],
 						   const uint32_t rk[AES256_RK_WORDS]);
 
+//	Decrypt n blocks
+
+void aes128_dec_ecbn_rvk64(uint8_t * pt, const uint8_t * ct, size_t n,
+						   const uint32_t rk[AES128_RK_WORDS]);
+
+void aes192_dec_ecbn_rvk64(uint8_t * pt, const uint8_t * ct, size_t n,
+						   const uint32_t rk[AES192_RK_WORDS]);
+
+void aes256_dec_ecbn_rvk64(uint8_t * pt, const uint8_t * ct, size_t n,
+						   const uint32_t rk[AES256_RK_WORDS]);
+
+//	Set encryption and decryption keys in one pass
+
+void aes128_encdec_key_rvk64(uint32_t erk[AES128_RK_WORDS],
+							 uint32_t drk[AES128_RK_WORDS],
+							 const uint8_t key[16]);
+
+void aes192_encdec_key_rvk64(uint32_t erk[AES192_RK_WORDS],
+							 uint32_t drk[AES192_RK_WORDS],
+							 const uint8_t key[24]);
+
+void aes256_encdec_key_rvk64(uint32_t erk[AES256_RK_WORDS],
+							 uint32_t drk[AES256_RK_WORDS],
+							 const uint8_t key[32]);
+
+//	Set n consecutive encryption keys
+
+void aes128_enc_key_n_rvk64(uint32_t * rk, const uint8_t * key, size_t n);
+
+void aes192_enc_key_n_rvk64(uint32_t * rk, const uint8_t * key, size_t n);
+
+void aes256_enc_key_n_rvk64(uint32_t * rk, const uint8_t * key, size_t n);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,278 @@
+//	ccm_api.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	AES-CCM on top of the multi-block AES pointers. The CBC-MAC chain is
+//	inherently serial, but CTR blocks are not: each CBC-MAC step is given
+//	to the multi-block cipher together with the next keystream block, so
+//	the two dependency chains are interleaved in the same call.
+
+#include <string.h>
+
+#include "rv_endian.h"
+#include "rvk_mem.h"
+#include "aes/aes_api.h"
+#include "gcm/gcm_gfmul.h"
+#include "ccm_api.h"
+
+typedef void (*ccm_ecbn_t)(uint8_t * d, const uint8_t * s, size_t n,
+						   const uint32_t * rk);
+
+//	check parameters; q = 15 - nlen is the size of the length field
+
+static int ccm_param(size_t len, size_t nlen, size_t tlen)
+{
+	size_t q;
+
+	if (nlen < 7 || nlen > 13 || tlen < 4 || tlen > 16 || (tlen & 1))
+		return -1;
+	q = 15 - nlen;
+	if (q < sizeof(size_t) && (len >> (8 * q)) != 0)
+		return -1;
+
+	return 0;
+}
+
+//	store "x" as a big-endian q-byte field at the end of block "b"
+
+static inline void ccm_setq(gf128_t * b, size_t q, size_t x)
+{
+	size_t i;
+
+	for (i = 15; i >= 16 - q; i--) {
+		b->b[i] = x;
+		x >>= 8;
+	}
+}
+
+//	xor "l" <= 16 bytes of "p" into the CBC-MAC state (implicit zero pad)
+
+static inline void ccm_xor(gf128_t * x, const uint8_t * p, size_t l)
+{
+	gf128_t b;
+
+	if (l == 16) {
+		memcpy(b.b, p, 16);
+		x->d[0] ^= b.d[0];
+		x->d[1] ^= b.d[1];
+	} else {
+		while (l > 0) {
+			l--;
+			x->b[l] ^= p[l];
+		}
+	}
+}
+
+//	the same "body" for encryption/decryption and various key lengths.
+//	blk[0] is the CBC-MAC state and blk[1] the next keystream block, so
+//	that both can be handed to the multi-block cipher as a pair.
+
+static void aes_ccm_body(uint8_t * dst, uint8_t tag[16],
+						 const uint8_t * src, size_t len,
+						 const uint8_t * a, size_t alen,
+						 const uint8_t * n, size_t nlen, size_t tlen,
+						 const uint32_t rk[], ccm_ecbn_t ecbn, int enc_flag)
+{
+	size_t i, j, q, ctr;
+	uint8_t hdr[10];
+	gf128_t blk[3], ctr0, s0, p;
+
+	q = 15 - nlen;
+
+	//	B0, A1 (first keystream block) and A0 (for the tag) in one call
+
+	blk[0].b[0] = (alen > 0 ? 0x40 : 0x00) | ((tlen - 2) / 2) << 3 | (q - 1);
+	memcpy(blk[0].b + 1, n, nlen);
+	ccm_setq(&blk[0], q, len);
+
+	ctr0.b[0] = q - 1;
+	memcpy(ctr0.b + 1, n, nlen);
+	ccm_setq(&ctr0, q, 0);
+	blk[2] = ctr0;
+	ctr = 1;
+	blk[1] = ctr0;
+	ccm_setq(&blk[1], q, ctr);
+
+	ecbn(blk[0].b, blk[0].b, 3, rk);
+	s0 = blk[2];
+
+	//	associated data with its length encoding; serial CBC-MAC
+
+	if (alen > 0) {
+		if (alen < 0xFF00) {
+			put16u_be(hdr, alen);
+			j = 2;
+		} else if ((uint64_t) alen >> 32 == 0) {
+			put16u_be(hdr, 0xFFFE);
+			put32u_be(hdr + 2, alen);
+			j = 6;
+		} else {
+			put16u_be(hdr, 0xFFFF);
+			put64u_be(hdr + 2, alen);
+			j = 10;
+		}
+		ccm_xor(&blk[0], hdr, j);
+		i = 16 - j < alen ? 16 - j : alen;
+		memset(p.b, 0, 16);
+		memcpy(p.b + j, a, i);
+		ccm_xor(&blk[0], p.b, 16);
+		ecbn(blk[0].b, blk[0].b, 1, rk);
+		a += i;
+		alen -= i;
+
+		while (alen > 0) {
+			i = alen < 16 ? alen : 16;
+			ccm_xor(&blk[0], a, i);
+			ecbn(blk[0].b, blk[0].b, 1, rk);
+			a += i;
+			alen -= i;
+		}
+	}
+
+	//	payload: the CBC-MAC of block i runs alongside CTR block i + 1
+
+	while (len > 0) {
+
+		i = len < 16 ? len : 16;
+		p.d[0] = 0;
+		p.d[1] = 0;
+		memcpy(p.b, src, i);
+		if (enc_flag)						//	MAC input is plaintext
+			ccm_xor(&blk[0], p.b, 16);
+		p.d[0] ^= blk[1].d[0];
+		p.d[1] ^= blk[1].d[1];
+		memcpy(dst, p.b, i);
+		if (!enc_flag) {
+			memset(p.b + i, 0, 16 - i);
+			ccm_xor(&blk[0], p.b, 16);
+		}
+
+		src += i;
+		dst += i;
+		len -= i;
+
+		if (len > 0) {						//	MAC and CTR as a pair
+			blk[1] = ctr0;
+			ccm_setq(&blk[1], q, ++ctr);
+			ecbn(blk[0].b, blk[0].b, 2, rk);
+		} else {
+			ecbn(blk[0].b, blk[0].b, 1, rk);
+		}
+	}
+
+	blk[0].d[0] ^= s0.d[0];					//	T = X ^ S0
+	blk[0].d[1] ^= s0.d[1];
+	memcpy(tag, blk[0].b, 16);
+}
+
+//	encrypt and append tag
+
+static int aes_ccm_enc(uint8_t * c, const uint8_t * m, size_t mlen,
+					   const uint8_t * a, size_t alen,
+					   const uint8_t * n, size_t nlen, size_t tlen,
+					   const uint32_t rk[], ccm_ecbn_t ecbn)
+{
+	uint8_t tag[16];
+
+	if (ccm_param(mlen, nlen, tlen))
+		return -1;
+
+	aes_ccm_body(c, tag, m, mlen, a, alen, n, nlen, tlen, rk, ecbn, 1);
+	memcpy(c + mlen, tag, tlen);
+
+	return 0;
+}
+
+//	verify it
+
+static int aes_ccm_vfy(uint8_t * m, const uint8_t * c, size_t clen,
+					   const uint8_t * a, size_t alen,
+					   const uint8_t * n, size_t nlen, size_t tlen,
+					   const uint32_t rk[], ccm_ecbn_t ecbn)
+{
+	uint8_t tag[16];
+
+	if (clen < tlen || ccm_param(clen - tlen, nlen, tlen))
+		return -1;
+	clen -= tlen;
+
+	aes_ccm_body(m, tag, c, clen, a, alen, n, nlen, tlen, rk, ecbn, 0);
+	if (!rvk_memeq_ct(tag, c + clen, tlen)) {	//	no unverified plaintext
+		memset(m, 0, clen);
+		return 1;
+	}
+
+	return 0;
+}
+
+//	AES128-CCM
+
+int aes128_enc_ccm(uint8_t * c, const uint8_t * m, size_t mlen,
+				   const uint8_t * a, size_t alen, const uint8_t * key,
+				   const uint8_t * n, size_t nlen, size_t tlen)
+{
+	uint32_t rk[AES128_RK_WORDS];
+
+	aes128_enc_key(rk, key);
+	return aes_ccm_enc(c, m, mlen, a, alen, n, nlen, tlen,
+					   rk, aes128_enc_ecbn);
+}
+
+int aes128_dec_vfy_ccm(uint8_t * m, const uint8_t * c, size_t clen,
+					   const uint8_t * a, size_t alen, const uint8_t * key,
+					   const uint8_t * n, size_t nlen, size_t tlen)
+{
+	uint32_t rk[AES128_RK_WORDS];
+
+	aes128_enc_key(rk, key);
+	return aes_ccm_vfy(m, c, clen, a, alen, n, nlen, tlen,
+					   rk, aes128_enc_ecbn);
+}
+
+//	AES192-CCM
+
+int aes192_enc_ccm(uint8_t * c, const uint8_t * m, size_t mlen,
+				   const uint8_t * a, size_t alen, const uint8_t * key,
+				   const uint8_t * n, size_t nlen, size_t tlen)
+{
+	uint32_t rk[AES192_RK_WORDS];
+
+	aes192_enc_key(rk, key);
+	return aes_ccm_enc(c, m, mlen, a, alen, n, nlen, tlen,
+					   rk, aes192_enc_ecbn);
+}
+
+int aes192_dec_vfy_ccm(uint8_t * m, const uint8_t * c, size_t clen,
+					   const uint8_t * a, size_t alen, const uint8_t * key,
+					   const uint8_t * n, size_t nlen, size_t tlen)
+{
+	uint32_t rk[AES192_RK_WORDS];
+
+	aes192_enc_key(rk, key);
+	return aes_ccm_vfy(m, c, clen, a, alen, n, nlen, tlen,
+					   rk, aes192_enc_ecbn);
+}
+
+//	AES256-CCM
+
+int aes256_enc_ccm(uint8_t * c, const uint8_t * m, size_t mlen,
+				   const uint8_t * a, size_t alen, const uint8_t * key,
+				   const uint8_t * n, size_t nlen, size_t tlen)
+{
+	uint32_t rk[AES256_RK_WORDS];
+
+	aes256_enc_key(rk, key);
+	return aes_ccm_enc(c, m, mlen, a, alen, n, nlen, tlen,
+					   rk, aes256_enc_ecbn);
+}
+
+int aes256_dec_vfy_ccm(uint8_t * m, const uint8_t * c, size_t clen,
+					   const uint8_t * a, size_t alen, const uint8_t * key,
+					   const uint8_t * n, size_t nlen, size_t tlen)
+{
+	uint32_t rk[AES256_RK_WORDS];
+
+	aes256_enc_key(rk, key);
+	return aes_ccm_vfy(m, c, clen, a, alen, n, nlen, tlen,
+					   rk, aes256_enc_ecbn);
+}
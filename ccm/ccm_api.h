@@ -0,0 +1,51 @@
+//	ccm_api.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	AES-CCM (SP 800-38C, RFC 3610). Nonce length "nlen" is 7..13 bytes and
+//	tag length "tlen" is 4, 6, .. 16 bytes. Ciphertext is "tlen" bytes
+//	larger than plaintext; the tag is appended at the end. Routines return
+//	nonzero on invalid parameters or (aesxxx_dec_vfy_ccm) on failure.
+
+#ifndef _CCM_API_H_
+#define _CCM_API_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+//	AES-CCM-128 Encrypt / Decrypt & Verify
+
+int aes128_enc_ccm(uint8_t * c, const uint8_t * m, size_t mlen,
+				   const uint8_t * a, size_t alen, const uint8_t * key,
+				   const uint8_t * n, size_t nlen, size_t tlen);
+int aes128_dec_vfy_ccm(uint8_t * m, const uint8_t * c, size_t clen,
+					   const uint8_t * a, size_t alen, const uint8_t * key,
+					   const uint8_t * n, size_t nlen, size_t tlen);
+
+//	AES-CCM-192 Encrypt / Decrypt & Verify
+
+int aes192_enc_ccm(uint8_t * c, const uint8_t * m, size_t mlen,
+				   const uint8_t * a, size_t alen, const uint8_t * key,
+				   const uint8_t * n, size_t nlen, size_t tlen);
+int aes192_dec_vfy_ccm(uint8_t * m, const uint8_t * c, size_t clen,
+					   const uint8_t * a, size_t alen, const uint8_t * key,
+					   const uint8_t * n, size_t nlen, size_t tlen);
+
+//	AES-CCM-256 Encrypt / Decrypt & Verify
+
+int aes256_enc_ccm(uint8_t * c, const uint8_t * m, size_t mlen,
+				   const uint8_t * a, size_t alen, const uint8_t * key,
+				   const uint8_t * n, size_t nlen, size_t tlen);
+int aes256_dec_vfy_ccm(uint8_t * m, const uint8_t * c, size_t clen,
+					   const uint8_t * a, size_t alen, const uint8_t * key,
+					   const uint8_t * n, size_t nlen, size_t tlen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	//	_CCM_API_H_
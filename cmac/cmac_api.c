@@ -0,0 +1,93 @@
+//	cmac_api.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	AES-CMAC on top of the single-block AES pointers.
+
+#include <string.h>
+
+#include "rv_endian.h"
+#include "aes/aes_api.h"
+#include "gcm/gcm_gfmul.h"
+#include "cmac_api.h"
+
+//	subkey doubling in GF(2^128), big-endian convention of SP 800-38B
+
+static inline void cmac_dbl(gf128_t * k)
+{
+	uint64_t k0, k1;
+
+	k0 = get64u_be(k->b);
+	k1 = get64u_be(k->b + 8);
+	put64u_be(k->b, (k0 << 1) | (k1 >> 63));
+	put64u_be(k->b + 8, (k1 << 1) ^ (-(k0 >> 63) & 0x87));
+}
+
+//	the CBC-MAC chain is serial; a single block at a time
+
+static void aes_cmac_body(uint8_t tag[16], const uint8_t * m, size_t mlen,
+						  const uint32_t rk[],
+						  void (*enc_ecb)(uint8_t * ct, const uint8_t * pt,
+										  const uint32_t * rk))
+{
+	gf128_t k, x, b;
+
+	k.d[0] = 0;								//	L = AES_k(0)
+	k.d[1] = 0;
+	enc_ecb(k.b, k.b, rk);
+	cmac_dbl(&k);							//	K1
+
+	x.d[0] = 0;
+	x.d[1] = 0;
+
+	while (mlen > 16) {						//	all but the last block
+		memcpy(b.b, m, 16);
+		x.d[0] ^= b.d[0];
+		x.d[1] ^= b.d[1];
+		enc_ecb(x.b, x.b, rk);
+		m += 16;
+		mlen -= 16;
+	}
+
+	if (mlen > 0)							//	last block
+		memcpy(b.b, m, mlen);
+	if (mlen < 16) {
+		b.b[mlen] = 0x80;					//	padded: use K2
+		memset(b.b + mlen + 1, 0, 15 - mlen);
+		cmac_dbl(&k);
+	}
+	x.d[0] ^= b.d[0] ^ k.d[0];
+	x.d[1] ^= b.d[1] ^ k.d[1];
+	enc_ecb(x.b, x.b, rk);
+
+	memcpy(tag, x.b, 16);
+}
+
+//	AES-CMAC for each key size
+
+void aes128_cmac(uint8_t tag[16], const uint8_t * m, size_t mlen,
+				 const uint8_t * key)
+{
+	uint32_t rk[AES128_RK_WORDS];
+
+	aes128_enc_key(rk, key);
+	aes_cmac_body(tag, m, mlen, rk, aes128_enc_ecb);
+}
+
+void aes192_cmac(uint8_t tag[16], const uint8_t * m, size_t mlen,
+				 const uint8_t * key)
+{
+	uint32_t rk[AES192_RK_WORDS];
+
+	aes192_enc_key(rk, key);
+	aes_cmac_body(tag, m, mlen, rk, aes192_enc_ecb);
+}
+
+void aes256_cmac(uint8_t tag[16], const uint8_t * m, size_t mlen,
+				 const uint8_t * key)
+{
+	uint32_t rk[AES256_RK_WORDS];
+
+	aes256_enc_key(rk, key);
+	aes_cmac_body(tag, m, mlen, rk, aes256_enc_ecb);
+}
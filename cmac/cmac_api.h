@@ -0,0 +1,30 @@
+//	cmac_api.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	AES-CMAC (SP 800-38B, RFC 4493). Full 16-byte tag; truncate as needed.
+
+#ifndef _CMAC_API_H_
+#define _CMAC_API_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+//	Compute a 16-byte CMAC "tag" of "m" which has "mlen" bytes.
+
+void aes128_cmac(uint8_t tag[16], const uint8_t * m, size_t mlen,
+				 const uint8_t * key);
+void aes192_cmac(uint8_t tag[16], const uint8_t * m, size_t mlen,
+				 const uint8_t * key);
+void aes256_cmac(uint8_t tag[16], const uint8_t * m, size_t mlen,
+				 const uint8_t * key);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	//	_CMAC_API_H_
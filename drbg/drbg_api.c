@@ -0,0 +1,188 @@
+//	drbg_api.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	rvk_random(): a per-thread CTR_DRBG seeded from the entropy source,
+//	with a per-thread output cache for small requests.
+
+#include <string.h>
+
+#include "drbg_api.h"
+
+#if defined(__unix__) && !defined(RVK_NO_ATFORK)
+#define RVK_ATFORK
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+//	thread-local storage class
+
+#ifndef RVK_THREAD_LOCAL
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && \
+	!defined(__STDC_NO_THREADS__)
+#define RVK_THREAD_LOCAL _Thread_local
+#else
+#define RVK_THREAD_LOCAL __thread
+#endif
+#endif
+
+//	reseed after this many generate calls (well below the SP 800-90A limit)
+
+#ifndef RVK_RANDOM_RESEED
+#define RVK_RANDOM_RESEED (1 << 20)
+#endif
+
+//	per-thread state: the DRBG instance and its output cache
+
+typedef struct {
+	ctr_drbg_t drbg;
+	uint8_t buf[RVK_RANDOM_CACHE];			//	unserved output
+	size_t pos;								//	bytes served from buf
+	uint32_t gen;							//	fork generation at seeding
+	int ok;									//	instantiated?
+} rvk_random_t;
+
+static RVK_THREAD_LOCAL rvk_random_t rvk_rnd;
+
+//	bumped in the child after fork(); stale instances reseed themselves
+
+static volatile uint32_t rvk_fork_gen = 0;
+
+#ifdef RVK_ATFORK
+static pthread_once_t rvk_atfork_once = PTHREAD_ONCE_INIT;
+
+static void rvk_random_child(void)
+{
+	rvk_fork_gen++;
+}
+
+static void rvk_random_atfork_reg(void)
+{
+	pthread_atfork(NULL, NULL, rvk_random_child);
+}
+
+static void rvk_random_atfork(void)
+{
+	pthread_once(&rvk_atfork_once, rvk_random_atfork_reg);
+}
+#else
+#define rvk_random_atfork()
+#endif
+
+//	personalization / additional input: process id and fork generation.
+//	A reseed in a forked child draws fresh entropy; this also keeps the
+//	parent and its children apart should the source ever repeat itself.
+
+static size_t rvk_random_pers(uint8_t p[16])
+{
+	uint64_t x;
+
+#ifdef RVK_ATFORK
+	x = (uint64_t) getpid();
+#else
+	x = 0;
+#endif
+	memcpy(p, &x, 8);
+	x = rvk_fork_gen;
+	memcpy(p + 8, &x, 8);
+
+	return 16;
+}
+
+//	(re)seed this thread's instance and drop the cache
+
+static int rvk_random_seed(void)
+{
+	uint8_t ent[CTR_DRBG_SEEDLEN], pers[16];
+	size_t plen;
+	int r;
+
+	rvk_random_atfork();
+	plen = rvk_random_pers(pers);
+	r = es16_get_seed(ent, sizeof(ent));
+	if (r == 0) {
+		if (rvk_rnd.ok)
+			r = ctr_drbg_reseed(&rvk_rnd.drbg, ent, pers, plen);
+		else
+			r = ctr_drbg_instantiate(&rvk_rnd.drbg, ent, pers, plen);
+	}
+	rvk_rnd.ok = (r == 0);
+	if (!rvk_rnd.ok)
+		ctr_drbg_clear(&rvk_rnd.drbg);
+	rvk_rnd.gen = rvk_fork_gen;
+
+	memset(rvk_rnd.buf, 0x00, sizeof(rvk_rnd.buf));
+	rvk_rnd.pos = RVK_RANDOM_CACHE;			//	empty
+
+	memset(ent, 0x00, sizeof(ent));
+
+	return r;
+}
+
+//	one generate call, reseeding as necessary
+
+static int rvk_random_gen(uint8_t *out, size_t len)
+{
+	int r;
+
+	if (rvk_rnd.drbg.rc > RVK_RANDOM_RESEED && rvk_random_seed() != 0)
+		return -1;
+	r = ctr_drbg_generate(&rvk_rnd.drbg, out, len, NULL, 0);
+	if (r == 1) {
+		if (rvk_random_seed() != 0)
+			return -1;
+		r = ctr_drbg_generate(&rvk_rnd.drbg, out, len, NULL, 0);
+	}
+
+	return r == 0 ? 0 : -1;
+}
+
+int rvk_random(uint8_t *out, size_t len)
+{
+	size_t l;
+
+	if ((!rvk_rnd.ok || rvk_rnd.gen != rvk_fork_gen) &&
+		rvk_random_seed() != 0)
+		return -1;
+
+	//	small request: serve from the cache, wiping what was handed out
+
+	if (len <= RVK_RANDOM_SMALL) {
+		while (len > 0) {
+			if (rvk_rnd.pos >= RVK_RANDOM_CACHE) {
+				if (rvk_random_gen(rvk_rnd.buf, RVK_RANDOM_CACHE) != 0)
+					return -1;
+				rvk_rnd.pos = 0;
+			}
+			l = RVK_RANDOM_CACHE - rvk_rnd.pos;
+			l = len < l ? len : l;
+			memcpy(out, rvk_rnd.buf + rvk_rnd.pos, l);
+			memset(rvk_rnd.buf + rvk_rnd.pos, 0x00, l);
+			rvk_rnd.pos += l;
+			out += l;
+			len -= l;
+		}
+		return 0;
+	}
+
+	//	large request: straight from the DRBG
+
+	while (len > 0) {
+		l = len < CTR_DRBG_MAX_REQUEST ? len : CTR_DRBG_MAX_REQUEST;
+		if (rvk_random_gen(out, l) != 0)
+			return -1;
+		out += l;
+		len -= l;
+	}
+
+	return 0;
+}
+
+//	discard the cache and force a reseed on next use
+
+void rvk_random_reset(void)
+{
+	memset(rvk_rnd.buf, 0x00, sizeof(rvk_rnd.buf));
+	rvk_rnd.pos = RVK_RANDOM_CACHE;
+	rvk_rnd.gen = rvk_fork_gen - 1;
+}
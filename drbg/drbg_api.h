@@ -0,0 +1,124 @@
+//	drbg_api.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Entropy source (Zkr ES16) interface, SHA-256 conditioner, and
+//	SP 800-90A CTR_DRBG (AES-256, no derivation function) and Hash_DRBG
+//	(SHA-256) random bit generators. rvk_random() is the front end: a
+//	per-thread CTR_DRBG that seeds itself from the entropy source.
+
+#ifndef _DRBG_API_H_
+#define _DRBG_API_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include "aes/aes_api.h"
+
+//	=== Entropy source ===
+
+//	seed CSR status (OPST) in bits 31:30; ES16 carries 16 bits in 15:0
+#define ES16_BIST	0
+#define ES16_WAIT	1
+#define ES16_ES16	2
+#define ES16_DEAD	3
+
+//	raw ES16 samples per 256-bit conditioned output (8:1 oversampling)
+#ifndef ES16_SAMPLES
+#define ES16_SAMPLES 128
+#endif
+
+//	give up after this many consecutive BIST / WAIT polls
+#ifndef ES16_POLL_MAX
+#define ES16_POLL_MAX 0x10000
+#endif
+
+//	function pointer to the seed CSR read
+extern uint32_t (*es16_seed)(void);
+
+//	which is set to point to the first available one of:
+uint32_t es16_seed_zkr(void);				//	Zkr "seed" CSR (RVKINTRIN_ZKR)
+uint32_t es16_seed_emu(void);				//	RVK_ES16_EMU tests; NOT random
+uint32_t es16_seed_os(void);				//	getentropy() on POSIX hosts
+uint32_t es16_seed_none(void);				//	always DEAD: fail closed
+
+//	collect "n" 16-bit ES16 samples; nonzero on DEAD or poll timeout
+int es16_collect(uint16_t *buf, size_t n);
+
+//	"len" bytes of full-entropy seed material; each 32 bytes is a SHA-256
+//	of ES16_SAMPLES fresh samples. Returns nonzero on failure.
+int es16_get_seed(uint8_t *seed, size_t len);
+
+//	=== CTR_DRBG (AES-256, no derivation function) ===
+
+#define CTR_DRBG_SEEDLEN 48
+#define CTR_DRBG_MAX_REQUEST 0x10000		//	bytes (2^19 bits)
+#define CTR_DRBG_RESEED_INTERVAL (1ull << 48)
+
+typedef struct {
+	uint32_t rk[AES256_RK_WORDS];			//	expanded Key
+	uint8_t v[16];							//	V
+	uint64_t rc;							//	reseed_counter
+} ctr_drbg_t;
+
+//	entropy input is 48 bytes; "pers" and "add" are at most 48 bytes.
+//	routines return -1 on bad parameters; generate returns 1 if a reseed
+//	is required.
+int ctr_drbg_instantiate(ctr_drbg_t *d, const uint8_t ent[48],
+						 const uint8_t *pers, size_t plen);
+int ctr_drbg_reseed(ctr_drbg_t *d, const uint8_t ent[48],
+					const uint8_t *add, size_t alen);
+int ctr_drbg_generate(ctr_drbg_t *d, uint8_t *out, size_t len,
+					  const uint8_t *add, size_t alen);
+void ctr_drbg_clear(ctr_drbg_t *d);
+
+//	=== Hash_DRBG (SHA-256) ===
+
+#define HASH_DRBG_SEEDLEN 55
+#define HASH_DRBG_MAX_REQUEST 0x10000		//	bytes (2^19 bits)
+#define HASH_DRBG_RESEED_INTERVAL (1ull << 48)
+
+typedef struct {
+	uint8_t v[HASH_DRBG_SEEDLEN];			//	V
+	uint8_t c[HASH_DRBG_SEEDLEN];			//	C
+	uint64_t rc;							//	reseed_counter
+} hash_drbg_t;
+
+int hash_drbg_instantiate(hash_drbg_t *d, const uint8_t *ent, size_t elen,
+						  const uint8_t *nonce, size_t nlen,
+						  const uint8_t *pers, size_t plen);
+int hash_drbg_reseed(hash_drbg_t *d, const uint8_t *ent, size_t elen,
+					 const uint8_t *add, size_t alen);
+int hash_drbg_generate(hash_drbg_t *d, uint8_t *out, size_t len,
+					   const uint8_t *add, size_t alen);
+void hash_drbg_clear(hash_drbg_t *d);
+
+//	=== Front end ===
+
+//	per-thread output cache size, and the largest request served from it
+#ifndef RVK_RANDOM_CACHE
+#define RVK_RANDOM_CACHE 4096
+#endif
+#ifndef RVK_RANDOM_SMALL
+#define RVK_RANDOM_SMALL 256
+#endif
+
+//	"len" random bytes from the calling thread's CTR_DRBG instance, which
+//	is (re)seeded from the entropy source as needed. Requests of at most
+//	RVK_RANDOM_SMALL bytes come from a cache refilled RVK_RANDOM_CACHE
+//	bytes at a time. The instance reseeds in a forked child (POSIX) from
+//	fresh entropy, personalized with the process id and fork generation.
+//	Nonzero on failure.
+int rvk_random(uint8_t *out, size_t len);
+
+//	drop the calling thread's cache and reseed on next use
+void rvk_random_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	//	_DRBG_API_H_
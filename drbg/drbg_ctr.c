@@ -0,0 +1,163 @@
+//	drbg_ctr.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	SP 800-90A CTR_DRBG with AES-256 and no derivation function. Output
+//	blocks are produced through the multi-block AES pointer.
+
+#include <string.h>
+
+#include "rv_endian.h"
+#include "gcm/gcm_gfmul.h"
+#include "drbg_api.h"
+
+//	number of counter blocks given to the multi-block cipher at once
+
+#define CTR_DRBG_PAR 16
+
+//	load V as a 128-bit big-endian counter
+
+static inline void ctr_drbg_getv(uint64_t *h, uint64_t *l, const uint8_t v[16])
+{
+	*h = get64u_be(v);
+	*l = get64u_be(v + 8);
+}
+
+//	next counter block
+
+static inline void ctr_drbg_next(gf128_t * b, uint64_t *h, uint64_t *l)
+{
+	*l += 1;
+	*h += (*l == 0);
+	put64u_be(b->b, *h);
+	put64u_be(b->b + 8, *l);
+}
+
+//	CTR_DRBG_Update(provided_data); "pd" is 48 bytes or NULL for zeros
+
+static void ctr_drbg_update(ctr_drbg_t *d, const uint8_t *pd)
+{
+	size_t i;
+	uint64_t h, l;
+	gf128_t t[3], p;
+
+	ctr_drbg_getv(&h, &l, d->v);
+	for (i = 0; i < 3; i++)
+		ctr_drbg_next(&t[i], &h, &l);
+	aes256_enc_ecbn(t[0].b, t[0].b, 3, d->rk);
+
+	if (pd != NULL) {
+		for (i = 0; i < 3; i++) {
+			memcpy(p.b, pd + 16 * i, 16);
+			t[i].d[0] ^= p.d[0];
+			t[i].d[1] ^= p.d[1];
+		}
+	}
+
+	aes256_enc_key(d->rk, t[0].b);			//	Key = leftmost 256 bits
+	memcpy(d->v, t[2].b, 16);				//	V = rightmost 128 bits
+
+	memset(t, 0x00, sizeof(t));				//	clear it
+}
+
+//	zero-pad additional input or personalization string to 48 bytes
+
+static const uint8_t *ctr_drbg_pad(uint8_t buf[48],
+								   const uint8_t *in, size_t inlen)
+{
+	if (inlen == 0)
+		return NULL;
+	memset(buf, 0x00, 48);
+	memcpy(buf, in, inlen);
+	return buf;
+}
+
+//	instantiate: seed_material = entropy_input ^ personalization_string
+
+int ctr_drbg_instantiate(ctr_drbg_t *d, const uint8_t ent[48],
+						 const uint8_t *pers, size_t plen)
+{
+	uint8_t k[32];
+
+	if (plen > CTR_DRBG_SEEDLEN)
+		return -1;
+
+	memset(k, 0x00, sizeof(k));				//	Key = 0, V = 0
+	aes256_enc_key(d->rk, k);
+	memset(d->v, 0x00, sizeof(d->v));
+	d->rc = 0;
+
+	return ctr_drbg_reseed(d, ent, pers, plen);
+}
+
+//	reseed: seed_material = entropy_input ^ additional_input
+
+int ctr_drbg_reseed(ctr_drbg_t *d, const uint8_t ent[48],
+					const uint8_t *add, size_t alen)
+{
+	uint8_t sm[48];
+	size_t i;
+
+	if (alen > CTR_DRBG_SEEDLEN)
+		return -1;
+
+	memcpy(sm, ent, 48);
+	for (i = 0; i < alen; i++)
+		sm[i] ^= add[i];
+	ctr_drbg_update(d, sm);
+	d->rc = 1;
+
+	memset(sm, 0x00, sizeof(sm));
+
+	return 0;
+}
+
+//	generate "len" bytes
+
+int ctr_drbg_generate(ctr_drbg_t *d, uint8_t *out, size_t len,
+					  const uint8_t *add, size_t alen)
+{
+	size_t i, j, l;
+	uint64_t h, lo;
+	uint8_t ab[48];
+	const uint8_t *pd;
+	gf128_t b[CTR_DRBG_PAR];
+
+	if (len > CTR_DRBG_MAX_REQUEST || alen > CTR_DRBG_SEEDLEN)
+		return -1;
+	if (d->rc > CTR_DRBG_RESEED_INTERVAL)
+		return 1;
+
+	pd = ctr_drbg_pad(ab, add, alen);
+	if (pd != NULL)
+		ctr_drbg_update(d, pd);
+
+	ctr_drbg_getv(&h, &lo, d->v);
+	while (len > 0) {
+		l = len < 16 * CTR_DRBG_PAR ? len : 16 * CTR_DRBG_PAR;
+		j = (l + 15) / 16;
+		for (i = 0; i < j; i++)
+			ctr_drbg_next(&b[i], &h, &lo);
+		aes256_enc_ecbn(b[0].b, b[0].b, j, d->rk);
+		memcpy(out, b[0].b, l);
+		out += l;
+		len -= l;
+	}
+	put64u_be(d->v, h);
+	put64u_be(d->v + 8, lo);
+
+	ctr_drbg_update(d, pd);
+	d->rc++;
+
+	memset(b, 0x00, sizeof(b));				//	clear it
+	memset(ab, 0x00, sizeof(ab));
+
+	return 0;
+}
+
+//	uninstantiate
+
+void ctr_drbg_clear(ctr_drbg_t *d)
+{
+	memset(d, 0x00, sizeof(ctr_drbg_t));
+}
@@ -0,0 +1,138 @@
+//	drbg_es16.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Zkr entropy source polling and SHA-256 conditioning.
+
+#include <string.h>
+
+#include "riscv_crypto.h"
+#include "sha2/sha2_api.h"
+#include "drbg_api.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define ES16_OS
+#include <unistd.h>
+#ifdef __APPLE__
+#include <sys/random.h>
+#endif
+#endif
+
+//	read the seed CSR
+
+#ifdef RVKINTRIN_ZKR
+uint32_t es16_seed_zkr(void)
+{
+	uint32_t rd;
+
+	__asm__ __volatile__ ("csrrw %0, 0x015, x0" : "=r"(rd));
+	return rd;
+}
+#endif
+
+//	stand-in for hosted builds without Zkr: 16 bits from the operating
+//	system's entropy pool per poll. Reports DEAD if that fails.
+
+#ifdef ES16_OS
+uint32_t es16_seed_os(void)
+{
+	uint16_t x;
+
+	if (getentropy(&x, sizeof(x)) != 0)
+		return (uint32_t) ES16_DEAD << 30;
+
+	return ((uint32_t) ES16_ES16 << 30) | x;
+}
+#endif
+
+//	no entropy source at all: fail closed
+
+uint32_t es16_seed_none(void)
+{
+	return (uint32_t) ES16_DEAD << 30;
+}
+
+//	test-only opt-in (RVK_ES16_EMU): a SplitMix64 sequence that always
+//	reports ES16. It is deterministic, so anything seeded from it is
+//	predictable -- never use it for keys.
+
+#ifdef RVK_ES16_EMU
+uint32_t es16_seed_emu(void)
+{
+	static uint64_t x = 0;
+	uint64_t z;
+
+	z = __atomic_add_fetch(&x, 0x9E3779B97F4A7C15, __ATOMIC_RELAXED);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+	z = z ^ (z >> 31);
+
+	return ((uint32_t) ES16_ES16 << 30) | (z & 0xFFFF);
+}
+#endif
+
+//	function pointer is here
+
+#if defined(RVKINTRIN_ZKR)
+uint32_t (*es16_seed)(void) = es16_seed_zkr;
+#elif defined(RVK_ES16_EMU)
+uint32_t (*es16_seed)(void) = es16_seed_emu;
+#elif defined(ES16_OS)
+uint32_t (*es16_seed)(void) = es16_seed_os;
+#else
+uint32_t (*es16_seed)(void) = es16_seed_none;
+#endif
+
+//	collect "n" samples
+
+int es16_collect(uint16_t *buf, size_t n)
+{
+	size_t i, w;
+	uint32_t x;
+
+	w = 0;
+	i = 0;
+	while (i < n) {
+		x = es16_seed();
+		switch (x >> 30) {
+			case ES16_ES16:
+				buf[i++] = x & 0xFFFF;
+				w = 0;
+				break;
+			case ES16_DEAD:
+				return -1;
+			default:						//	BIST or WAIT
+				if (++w > ES16_POLL_MAX)
+					return -2;
+				break;
+		}
+	}
+
+	return 0;
+}
+
+//	seed material through the SHA-256 conditioner
+
+int es16_get_seed(uint8_t *seed, size_t len)
+{
+	uint16_t buf[ES16_SAMPLES];
+	uint8_t md[32];
+	size_t l;
+	int r = 0;
+
+	while (len > 0) {
+		r = es16_collect(buf, ES16_SAMPLES);
+		if (r != 0)
+			break;
+		sha2_256(md, buf, sizeof(buf));
+		l = len < 32 ? len : 32;
+		memcpy(seed, md, l);
+		seed += l;
+		len -= l;
+	}
+
+	memset(buf, 0x00, sizeof(buf));			//	clear it
+	memset(md, 0x00, sizeof(md));
+
+	return r;
+}
@@ -0,0 +1,161 @@
+//	drbg_hash.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	SP 800-90A Hash_DRBG with SHA-256 (seedlen = 440 bits).
+
+#include <string.h>
+
+#include "sha2/sha2_api.h"
+#include "drbg_api.h"
+
+//	Hash_df(p0 || p1 || p2 || p3, seedlen); p0 is a single prefix byte,
+//	or none if negative
+
+static void hash_df(uint8_t out[HASH_DRBG_SEEDLEN], int p0,
+					const uint8_t *p1, size_t l1,
+					const uint8_t *p2, size_t l2,
+					const uint8_t *p3, size_t l3)
+{
+	sha256_t sha;
+	uint8_t hd[5], md[32];
+	size_t i, l;
+
+	hd[0] = 1;								//	counter
+	hd[1] = 0x00;							//	no_of_bits_to_return
+	hd[2] = 0x00;
+	hd[3] = (8 * HASH_DRBG_SEEDLEN) >> 8;
+	hd[4] = (8 * HASH_DRBG_SEEDLEN) & 0xFF;
+
+	for (i = 0; i < HASH_DRBG_SEEDLEN; i += 32) {
+		sha256_init(&sha);
+		sha256_update(&sha, hd, 5);
+		if (p0 >= 0) {
+			md[0] = p0;
+			sha256_update(&sha, md, 1);
+		}
+		sha256_update(&sha, p1, l1);
+		sha256_update(&sha, p2, l2);
+		sha256_update(&sha, p3, l3);
+		sha256_final(&sha, md);
+		l = HASH_DRBG_SEEDLEN - i;
+		memcpy(out + i, md, l < 32 ? l : 32);
+		hd[0]++;
+	}
+
+	memset(&sha, 0x00, sizeof(sha));		//	clear it
+	memset(md, 0x00, sizeof(md));
+}
+
+//	x = (x + y) mod 2^(8*seedlen), big-endian; y is "ylen" bytes
+
+static void hash_drbg_add(uint8_t x[HASH_DRBG_SEEDLEN],
+						  const uint8_t *y, size_t ylen)
+{
+	size_t i;
+	uint32_t c;
+
+	c = 0;
+	for (i = 1; i <= HASH_DRBG_SEEDLEN; i++) {
+		c += x[HASH_DRBG_SEEDLEN - i];
+		if (i <= ylen)
+			c += y[ylen - i];
+		x[HASH_DRBG_SEEDLEN - i] = c;
+		c >>= 8;
+	}
+}
+
+//	instantiate
+
+int hash_drbg_instantiate(hash_drbg_t *d, const uint8_t *ent, size_t elen,
+						  const uint8_t *nonce, size_t nlen,
+						  const uint8_t *pers, size_t plen)
+{
+	hash_df(d->v, -1, ent, elen, nonce, nlen, pers, plen);
+	hash_df(d->c, 0x00, d->v, HASH_DRBG_SEEDLEN, NULL, 0, NULL, 0);
+	d->rc = 1;
+
+	return 0;
+}
+
+//	reseed
+
+int hash_drbg_reseed(hash_drbg_t *d, const uint8_t *ent, size_t elen,
+					 const uint8_t *add, size_t alen)
+{
+	uint8_t t[HASH_DRBG_SEEDLEN];
+
+	hash_df(t, 0x01, d->v, HASH_DRBG_SEEDLEN, ent, elen, add, alen);
+	memcpy(d->v, t, HASH_DRBG_SEEDLEN);
+	hash_df(d->c, 0x00, d->v, HASH_DRBG_SEEDLEN, NULL, 0, NULL, 0);
+	d->rc = 1;
+
+	memset(t, 0x00, sizeof(t));
+
+	return 0;
+}
+
+//	generate "len" bytes
+
+int hash_drbg_generate(hash_drbg_t *d, uint8_t *out, size_t len,
+					   const uint8_t *add, size_t alen)
+{
+	sha256_t sha;
+	uint8_t b, md[32], rc[8], data[HASH_DRBG_SEEDLEN];
+	size_t i, l;
+
+	if (len > HASH_DRBG_MAX_REQUEST)
+		return -1;
+	if (d->rc > HASH_DRBG_RESEED_INTERVAL)
+		return 1;
+
+	if (alen > 0) {							//	V = V + Hash(0x02 || V || add)
+		b = 0x02;
+		sha256_init(&sha);
+		sha256_update(&sha, &b, 1);
+		sha256_update(&sha, d->v, HASH_DRBG_SEEDLEN);
+		sha256_update(&sha, add, alen);
+		sha256_final(&sha, md);
+		hash_drbg_add(d->v, md, 32);
+	}
+
+	memcpy(data, d->v, HASH_DRBG_SEEDLEN);	//	Hashgen
+	b = 0x01;
+	while (len > 0) {
+		sha256_init(&sha);
+		sha256_update(&sha, data, HASH_DRBG_SEEDLEN);
+		sha256_final(&sha, md);
+		l = len < 32 ? len : 32;
+		memcpy(out, md, l);
+		out += l;
+		len -= l;
+		hash_drbg_add(data, &b, 1);
+	}
+
+	b = 0x03;								//	H = Hash(0x03 || V)
+	sha256_init(&sha);
+	sha256_update(&sha, &b, 1);
+	sha256_update(&sha, d->v, HASH_DRBG_SEEDLEN);
+	sha256_final(&sha, md);
+
+	for (i = 0; i < 8; i++)
+		rc[i] = d->rc >> (56 - 8 * i);
+
+	hash_drbg_add(d->v, md, 32);			//	V = V + H + C + reseed_counter
+	hash_drbg_add(d->v, d->c, HASH_DRBG_SEEDLEN);
+	hash_drbg_add(d->v, rc, 8);
+	d->rc++;
+
+	memset(&sha, 0x00, sizeof(sha));		//	clear it
+	memset(md, 0x00, sizeof(md));
+	memset(data, 0x00, sizeof(data));
+
+	return 0;
+}
+
+//	uninstantiate
+
+void hash_drbg_clear(hash_drbg_t *d)
+{
+	memset(d, 0x00, sizeof(hash_drbg_t));
+}
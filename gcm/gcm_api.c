@@ -9,6 +9,7 @@
 #include "riscv_crypto.h"
 #include "test_rvkat.h"
 #include "rv_endian.h"
+#include "rvk_mem.h"
 #include "aes/aes_api.h"
 #include "gcm_api.h"
 #include "gcm_gfmul.h"
@@ -27,28 +28,71 @@ static void ghash_mul_undef(gf128_t *x, const gf128_t *y, const gf128_t *z)
 	rvkat_info("undefined pointer: ghash_mul_undef()");
 }
 
+//	four blocks with four single-block multiplications
+
+void ghash_mul4_loop(gf128_t * z, const gf128_t x[4], const gf128_t h[4])
+{
+	ghash_mul(z, &x[0], &h[3]);
+	ghash_mul(z, &x[1], &h[3]);
+	ghash_mul(z, &x[2], &h[3]);
+	ghash_mul(z, &x[3], &h[3]);
+}
+
 //	function pointers are here
 
 void (*ghash_rev)(gf128_t *) = ghash_rev_undef;
 void (*ghash_mul)(gf128_t *, const gf128_t *, const gf128_t *) =
 	ghash_mul_undef;
+void (*ghash_mul4)(gf128_t *, const gf128_t *, const gf128_t *) =
+	ghash_mul4_loop;
 
 
 //	the same "body" for encryption/decryption and various key lengths
 
+typedef void (*gcm_ecb_t)(uint8_t * ct, const uint8_t * pt,
+						  const uint32_t * rk);
+
+typedef void (*gcm_ecbn_t)(uint8_t * d, const uint8_t * s, size_t n,
+						   const uint32_t * rk);
+
+//	h = AES_k(0) and its powers h4[] = { H^4, H^3, H^2, H }, bit-reversed
+
+static void aes_gcm_hpow(gf128_t h4[4], const uint32_t rk[], gcm_ecbn_t ecbn)
+{
+	int i;
+	gf128_t x, z;
+
+	h4[3].d[0] = 0;							//	h = AES_k(0)
+	h4[3].d[1] = 0;
+	ecbn(h4[3].b, h4[3].b, 1, rk);
+	ghash_rev(&h4[3]);
+
+	for (i = 3; i > 0; i--) {				//	H^2, H^3, H^4
+		z.d[0] = 0;
+		z.d[1] = 0;
+		x = h4[i];
+		ghash_rev(&x);
+		ghash_mul(&z, &x, &h4[3]);
+		h4[i - 1] = z;
+	}
+}
+
 static void aes_gcm_body(uint8_t * dst, uint8_t tag[16],
 						 const uint8_t * src, size_t len,
 						 const uint8_t iv[12], const uint32_t rk[],
-						 void (*enc_ecb)(uint8_t * ct, const uint8_t * pt,
-							const uint32_t * rk), int enc_flag)
+						 const gf128_t * hp, gcm_ecb_t enc_ecb, int enc_flag)
 {
 	size_t i, ctr;
 	gf128_t b, c, z, h, t, p;
 
-	h.d[0] = 0;								//	h = AES_k(0)
-	h.d[1] = 0;
-	enc_ecb(h.b, h.b, rk);
-	ghash_rev(&h);
+	if (hp != NULL) {						//	precomputed
+		h = *hp;
+	} else {
+		h.d[0] = 0;							//	h = AES_k(0)
+		h.d[1] = 0;
+		enc_ecb(h.b, h.b, rk);
+		ghash_rev(&h);
+	}
 
 	ctr = 0;								//	counter value
 	memcpy(p.b, iv, 12);					//	J0
@@ -123,27 +167,118 @@ static void aes_gcm_body(uint8_t * dst, uint8_t tag[16],
 	memcpy(tag, t.b, 16);					//	write tag
 }
 
-//	verify it
+//	verify, then decrypt: the ciphertext is GHASHed first and "m" is only
+//	written if the tag is valid. The CTR pass then runs backwards over
+//	GCM_TILE -sized tiles, so it starts with data the GHASH pass just
+//	touched. "m" and "c" may be the same or overlap in either direction.
+
+#ifndef GCM_TILE
+#define GCM_TILE 0x4000						//	bytes, multiple of 16
+#endif
+
+#define GCM_BLK 8							//	blocks per ecbn call
+
+//	CTR blocks [i0, i1) of "len" bytes; descending order if "down"
+
+static void aes_gcm_ctr_tile(uint8_t * m, const uint8_t * c, size_t len,
+							 size_t i0, size_t i1, const gf128_t * j0,
+							 const uint32_t rk[], gcm_ecbn_t ecbn, int down)
+{
+	size_t i, j, k, l, o;
+	gf128_t b[GCM_BLK], x;
+
+	for (k = 0; k < i1 - i0; k += GCM_BLK) {
+		l = i1 - i0 - k < GCM_BLK ? i1 - i0 - k : GCM_BLK;
+		o = down ? i1 - k - l : i0 + k;		//	first block of this group
+		for (j = 0; j < l; j++) {
+			b[j] = *j0;
+			b[j].w[3] = __builtin_bswap32(o + j + 2);
+		}
+		ecbn(b[0].b, b[0].b, l, rk);
+		for (j = 0; j < l; j++) {
+			i = down ? o + l - 1 - j : o + j;
+			x.d[0] = 0;
+			x.d[1] = 0;
+			memcpy(x.b, c + 16 * i, len - 16 * i < 16 ? len - 16 * i : 16);
+			b[i - o].d[0] ^= x.d[0];
+			b[i - o].d[1] ^= x.d[1];
+			memcpy(m + 16 * i, b[i - o].b,
+				   len - 16 * i < 16 ? len - 16 * i : 16);
+		}
+	}
+	rvk_memzero(b, sizeof(b));				//	clear keystream
+}
 
 static int aes_gcm_vfy(uint8_t * m,
 					   const uint8_t * c, size_t clen,
 					   const uint8_t iv[12], const uint32_t rk[],
-					   void (*enc_ecb)(uint8_t * ct, const uint8_t * pt,
-									   const uint32_t * rk))
+					   const gf128_t * hp, gcm_ecbn_t ecbn)
 {
-	size_t i;
-	uint8_t tag[16], x;
+	size_t i, n, len, nt, t;
+	int down;
+	gf128_t h4[4], x[4], z, t0, j0;
 
 	if (clen < 16)
 		return -1;
+	len = clen - 16;
+
+	if (hp != NULL)							//	precomputed powers
+		memcpy(h4, hp, sizeof(h4));
+	else
+		aes_gcm_hpow(h4, rk, ecbn);
 
-	aes_gcm_body(m, tag, c, clen - 16, iv, rk, enc_ecb, 0);
-	x = 0;
-	for (i = 0; i < 16; i++) {
-		x |= tag[i] ^ c[clen - 16 + i];
+	memcpy(j0.b, iv, 12);					//	J0
+	j0.w[3] = __builtin_bswap32(1);
+	t0 = j0;
+	ecbn(t0.b, t0.b, 1, rk);				//	AES_k(IV | 1) for tag
+
+	//	pass 1: GHASH
+
+	z.d[0] = 0;
+	z.d[1] = 0;
+	n = len / 16;
+	for (i = 0; i + 4 <= n; i += 4) {
+		memcpy(x, c + 16 * i, 64);
+		ghash_mul4(&z, x, h4);
 	}
+	for (; i < n; i++) {
+		memcpy(x[0].b, c + 16 * i, 16);
+		ghash_mul(&z, &x[0], &h4[3]);
+	}
+	if (len % 16 > 0) {						//	partial block
+		x[0].d[0] = 0;
+		x[0].d[1] = 0;
+		memcpy(x[0].b, c + 16 * n, len % 16);
+		ghash_mul(&z, &x[0], &h4[3]);
+		n++;
+	}
+	x[0].d[0] = 0;							//	pad with bit length
+	x[0].w[2] = __builtin_bswap32(len >> 29);
+	x[0].w[3] = __builtin_bswap32(len << 3);
+	ghash_mul(&z, &x[0], &h4[3]);
+	ghash_rev(&z);
+
+	t0.d[0] ^= z.d[0];
+	t0.d[1] ^= z.d[1];
+	if (!rvk_memeq_ct(t0.b, c + len, 16)) {	//	compare in constant time
+		rvk_memzero(h4, sizeof(h4));
+		return 1;
+	}
+
+	//	pass 2: CTR by tiles; forwards only if "m" overlaps "c" from below
 
-	return x == 0 ? 0 : 1;
+	down = !(m < c && m + len > c);
+	nt = GCM_TILE / 16;
+	for (t = 0; t < n; t += nt) {
+		i = n - t < nt ? n - t : nt;
+		if (down)
+			aes_gcm_ctr_tile(m, c, len, n - t - i, n - t, &j0, rk, ecbn, 1);
+		else
+			aes_gcm_ctr_tile(m, c, len, t, t + i, &j0, rk, ecbn, 0);
+	}
+	rvk_memzero(h4, sizeof(h4));
+
+	return 0;
 }
 
 //	AES128-GCM
@@ -154,7 +289,7 @@ void aes128_enc_gcm(uint8_t * c, const uint8_t * m, size_t mlen,
 	uint32_t rk[AES128_RK_WORDS];
 
 	aes128_enc_key(rk, key);
-	aes_gcm_body(c, c + mlen, m, mlen, iv, rk, aes128_enc_ecb, 1);
+	aes_gcm_body(c, c + mlen, m, mlen, iv, rk, NULL, aes128_enc_ecb, 1);
 }
 
 int aes128_dec_vfy_gcm(uint8_t * m, const uint8_t * c, size_t clen,
@@ -163,7 +298,7 @@ int aes128_dec_vfy_gcm(uint8_t * m, const uint8_t * c, size_t clen,
 	uint32_t rk[AES128_RK_WORDS];
 
 	aes128_enc_key(rk, key);
-	return aes_gcm_vfy(m, c, clen, iv, rk, aes128_enc_ecb);
+	return aes_gcm_vfy(m, c, clen, iv, rk, NULL, aes128_enc_ecbn);
 }
 
 
@@ -175,7 +310,7 @@ void aes192_enc_gcm(uint8_t * c, const uint8_t * m, size_t mlen,
 	uint32_t rk[AES192_RK_WORDS];
 
 	aes192_enc_key(rk, key);
-	aes_gcm_body(c, c + mlen, m, mlen, iv, rk, aes192_enc_ecb, 1);
+	aes_gcm_body(c, c + mlen, m, mlen, iv, rk, NULL, aes192_enc_ecb, 1);
 }
 
 int aes192_dec_vfy_gcm(uint8_t * m, const uint8_t * c, size_t clen,
@@ -184,7 +319,7 @@ int aes192_dec_vfy_gcm(uint8_t * m, const uint8_t * c, size_t clen,
 	uint32_t rk[AES192_RK_WORDS];
 
 	aes192_enc_key(rk, key);
-	return aes_gcm_vfy(m, c, clen, iv, rk, aes192_enc_ecb);
+	return aes_gcm_vfy(m, c, clen, iv, rk, NULL, aes192_enc_ecbn);
 }
 
 //	AES256-GCM
@@ -195,7 +330,7 @@ void aes256_enc_gcm(uint8_t * c, const uint8_t * m, size_t mlen,
 	uint32_t rk[AES256_RK_WORDS];
 
 	aes256_enc_key(rk, key);
-	aes_gcm_body(c, c + mlen, m, mlen, iv, rk, aes256_enc_ecb, 1);
+	aes_gcm_body(c, c + mlen, m, mlen, iv, rk, NULL, aes256_enc_ecb, 1);
 }
 
 int aes256_dec_vfy_gcm(uint8_t * m, const uint8_t * c, size_t clen,
@@ -204,5 +339,228 @@ int aes256_dec_vfy_gcm(uint8_t * m, const uint8_t * c, size_t clen,
 	uint32_t rk[AES256_RK_WORDS];
 
 	aes256_enc_key(rk, key);
-	return aes_gcm_vfy(m, c, clen, iv, rk, aes256_enc_ecb);
+	return aes_gcm_vfy(m, c, clen, iv, rk, NULL, aes256_enc_ecbn);
+}
+
+//	AES-GCM with a key object
+
+int aes_gcm_key_init(gcm_key_t * gk, const uint8_t * key, size_t klen)
+{
+	switch (klen) {
+		case 16:
+			aes128_enc_key(gk->rk, key);
+			gk->nr = AES128_ROUNDS;
+			aes_gcm_hpow(gk->h, gk->rk, aes128_enc_ecbn);
+			return 0;
+		case 24:
+			aes192_enc_key(gk->rk, key);
+			gk->nr = AES192_ROUNDS;
+			aes_gcm_hpow(gk->h, gk->rk, aes192_enc_ecbn);
+			return 0;
+		case 32:
+			aes256_enc_key(gk->rk, key);
+			gk->nr = AES256_ROUNDS;
+			aes_gcm_hpow(gk->h, gk->rk, aes256_enc_ecbn);
+			return 0;
+	}
+	return -1;
+}
+
+void aes_enc_gcm_key(uint8_t * c, const uint8_t * m, size_t mlen,
+					 const gcm_key_t * gk, const uint8_t iv[12])
+{
+	gcm_ecb_t ecb;
+
+	ecb = gk->nr == AES128_ROUNDS ? aes128_enc_ecb :
+		gk->nr == AES192_ROUNDS ? aes192_enc_ecb : aes256_enc_ecb;
+	aes_gcm_body(c, c + mlen, m, mlen, iv, gk->rk, &gk->h[3], ecb, 1);
+}
+
+int aes_dec_vfy_gcm_key(uint8_t * m, const uint8_t * c, size_t clen,
+						const gcm_key_t * gk, const uint8_t iv[12])
+{
+	gcm_ecbn_t ecbn;
+
+	ecbn = gk->nr == AES128_ROUNDS ? aes128_enc_ecbn :
+		gk->nr == AES192_ROUNDS ? aes192_enc_ecbn : aes256_enc_ecbn;
+	return aes_gcm_vfy(m, c, clen, iv, gk->rk, gk->h, ecbn);
+}
+
+//	scatter-gather "body"; "pos" bytes of the current keystream block "k"
+//	are used and the GHASH input so far of that block is collected in "c".
+//	Encryption is GCM_V_CTR | GCM_V_HASH_OUT; verification is a
+//	GCM_V_HASH_IN pass, then a GCM_V_CTR pass if the tag is good.
+
+#define GCM_V_CTR		1					//	write src ^ keystream
+#define GCM_V_HASH_IN	2					//	GHASH the input
+#define GCM_V_HASH_OUT	4					//	GHASH the output
+
+static void aes_gcm_body_v(const struct iovec *dv, uint8_t tag[16],
+						   const struct iovec *sv, size_t n,
+						   const uint8_t iv[12], const uint32_t rk[],
+						   void (*enc_ecb)(uint8_t * ct, const uint8_t * pt,
+							  const uint32_t * rk), int mode)
+{
+	size_t i, j, l, len, pos, ctr;
+	uint8_t *dst, x;
+	const uint8_t *src;
+	gf128_t b, c, k, z, h, t, p;
+
+	h.d[0] = 0;								//	h = AES_k(0)
+	h.d[1] = 0;
+	enc_ecb(h.b, h.b, rk);
+	ghash_rev(&h);
+
+	ctr = 0;								//	counter value
+	memcpy(p.b, iv, 12);					//	J0
+	p.w[3] = __builtin_bswap32(++ctr);
+	enc_ecb(t.b, p.b, rk);					//	AES_k(IV | 1) for tag
+
+	z.d[0] = 0;
+	z.d[1] = 0;
+	k.d[0] = 0;								//	no keystream in GHASH-only mode
+	k.d[1] = 0;
+	len = 0;
+	pos = 0;
+
+	for (i = 0; i < n; i++) {
+		src = (const uint8_t *) sv[i].iov_base;
+		dst = (uint8_t *) dv[i].iov_base;
+		l = sv[i].iov_len;
+		len += l;
+
+		while (l > 0) {
+			if (pos == 0 && (mode & GCM_V_CTR)) {
+				p.w[3] = __builtin_bswap32(++ctr);
+				enc_ecb(k.b, p.b, rk);
+			}
+			if (pos == 0 && l >= 16) {		//	aligned full block
+				memcpy(b.b, src, 16);
+				if (mode & GCM_V_HASH_IN)
+					ghash_mul(&z, &b, &h);
+				b.d[0] ^= k.d[0];
+				b.d[1] ^= k.d[1];
+				if (mode & GCM_V_HASH_OUT)
+					ghash_mul(&z, &b, &h);
+				if (mode & GCM_V_CTR)
+					memcpy(dst, b.b, 16);
+				src += 16;
+				dst += 16;
+				l -= 16;
+				continue;
+			}
+			j = 16 - pos;					//	block straddles segments
+			j = l < j ? l : j;
+			l -= j;
+			while (j--) {
+				x = *src++;
+				c.b[pos] = (mode & GCM_V_HASH_OUT) ? x ^ k.b[pos] : x;
+				if (mode & GCM_V_CTR)
+					*dst++ = x ^ k.b[pos];
+				pos++;
+			}
+			if (pos == 16) {
+				if (mode & (GCM_V_HASH_IN | GCM_V_HASH_OUT))
+					ghash_mul(&z, &c, &h);
+				pos = 0;
+			}
+		}
+	}
+
+	if (pos > 0 && (mode & (GCM_V_HASH_IN | GCM_V_HASH_OUT))) {
+		memset(&c.b[pos], 0, 16 - pos);		//	partial last block
+		ghash_mul(&z, &c, &h);
+	}
+
+	c.d[0] = 0;								//	pad with bit length
+	c.w[2] = __builtin_bswap32(len >> 29);
+	c.w[3] = __builtin_bswap32(len << 3);
+	ghash_mul(&z, &c, &h);
+	ghash_rev(&z);
+	t.d[0] = t.d[0] ^ z.d[0];
+	t.d[1] = t.d[1] ^ z.d[1];
+	memcpy(tag, t.b, 16);
+	rvk_memzero(&k, sizeof(k));				//	clear keystream
+}
+
+//	verify first; "m" is only written if the tag is valid
+
+static int aes_gcm_vfy_v(const struct iovec *m, const struct iovec *c,
+						 size_t n, const uint8_t tag[16],
+						 const uint8_t iv[12], const uint32_t rk[],
+						 void (*enc_ecb)(uint8_t * ct, const uint8_t * pt,
+										 const uint32_t * rk))
+{
+	uint8_t t[16];
+
+	aes_gcm_body_v(m, t, c, n, iv, rk, enc_ecb, GCM_V_HASH_IN);
+	if (!rvk_memeq_ct(t, tag, 16))
+		return 1;
+
+	aes_gcm_body_v(m, t, c, n, iv, rk, enc_ecb, GCM_V_CTR);
+
+	return 0;
+}
+
+void aes128_enc_gcm_v(const struct iovec *c, const struct iovec *m, size_t n,
+					  uint8_t tag[16],
+					  const uint8_t * key, const uint8_t iv[12])
+{
+	uint32_t rk[AES128_RK_WORDS];
+
+	aes128_enc_key(rk, key);
+	aes_gcm_body_v(c, tag, m, n, iv, rk, aes128_enc_ecb,
+				   GCM_V_CTR | GCM_V_HASH_OUT);
+}
+
+int aes128_dec_vfy_gcm_v(const struct iovec *m, const struct iovec *c,
+						 size_t n, const uint8_t tag[16],
+						 const uint8_t * key, const uint8_t iv[12])
+{
+	uint32_t rk[AES128_RK_WORDS];
+
+	aes128_enc_key(rk, key);
+	return aes_gcm_vfy_v(m, c, n, tag, iv, rk, aes128_enc_ecb);
+}
+
+void aes192_enc_gcm_v(const struct iovec *c, const struct iovec *m, size_t n,
+					  uint8_t tag[16],
+					  const uint8_t * key, const uint8_t iv[12])
+{
+	uint32_t rk[AES192_RK_WORDS];
+
+	aes192_enc_key(rk, key);
+	aes_gcm_body_v(c, tag, m, n, iv, rk, aes192_enc_ecb,
+				   GCM_V_CTR | GCM_V_HASH_OUT);
+}
+
+int aes192_dec_vfy_gcm_v(const struct iovec *m, const struct iovec *c,
+						 size_t n, const uint8_t tag[16],
+						 const uint8_t * key, const uint8_t iv[12])
+{
+	uint32_t rk[AES192_RK_WORDS];
+
+	aes192_enc_key(rk, key);
+	return aes_gcm_vfy_v(m, c, n, tag, iv, rk, aes192_enc_ecb);
+}
+
+void aes256_enc_gcm_v(const struct iovec *c, const struct iovec *m, size_t n,
+					  uint8_t tag[16],
+					  const uint8_t * key, const uint8_t iv[12])
+{
+	uint32_t rk[AES256_RK_WORDS];
+
+	aes256_enc_key(rk, key);
+	aes_gcm_body_v(c, tag, m, n, iv, rk, aes256_enc_ecb,
+				   GCM_V_CTR | GCM_V_HASH_OUT);
+}
+
+int aes256_dec_vfy_gcm_v(const struct iovec *m, const struct iovec *c,
+						 size_t n, const uint8_t tag[16],
+						 const uint8_t * key, const uint8_t iv[12])
+{
+	uint32_t rk[AES256_RK_WORDS];
+
+	aes256_enc_key(rk, key);
+	return aes_gcm_vfy_v(m, c, n, tag, iv, rk, aes256_enc_ecb);
 }
@@ -5,6 +5,8 @@
 //	Basic AES-GCM; 96-bit IV, no AAD, 128-bit auth tag padded at the end.
 //	Ciphertext is always 16 bytes larger than plaintext.
 //	Decrypt/verify routines (aesxxx_dec_vfy_gcm) return nonzero on failure.
+//	They check the tag before decrypting: "m" is not written on failure, and
+//	"m" and "c" may be the same buffer or overlap.
 
 #ifndef _GCM_API_H_
 #define _GCM_API_H_
@@ -15,6 +17,10 @@ extern "C" {
 
 #include <stdint.h>
 #include <stddef.h>
+#include "rvk_iovec.h"
+#include "rvk_align.h"
+#include "aes/aes_api.h"
+#include "gcm_gfmul.h"
 
 //	AES-GCM-128 Encrypt / Decrypt & Verify
 
@@ -37,6 +43,49 @@ void aes256_enc_gcm(uint8_t * c, const uint8_t * m, size_t mlen,
 int aes256_dec_vfy_gcm(uint8_t * m, const uint8_t * c, size_t clen,
 					   const uint8_t * key, const uint8_t iv[12]);
 
+//	Scatter-gather versions: "n" input segments, each written to the output
+//	segment with the same index (which must be at least as long). Blocks
+//	may straddle segments. The tag is separate. Segments may be in-place.
+//	As above, the output is only written after the tag has been checked.
+
+void aes128_enc_gcm_v(const struct iovec *c, const struct iovec *m, size_t n,
+					  uint8_t tag[16],
+					  const uint8_t * key, const uint8_t iv[12]);
+int aes128_dec_vfy_gcm_v(const struct iovec *m, const struct iovec *c,
+						 size_t n, const uint8_t tag[16],
+						 const uint8_t * key, const uint8_t iv[12]);
+
+void aes192_enc_gcm_v(const struct iovec *c, const struct iovec *m, size_t n,
+					  uint8_t tag[16],
+					  const uint8_t * key, const uint8_t iv[12]);
+int aes192_dec_vfy_gcm_v(const struct iovec *m, const struct iovec *c,
+						 size_t n, const uint8_t tag[16],
+						 const uint8_t * key, const uint8_t iv[12]);
+
+void aes256_enc_gcm_v(const struct iovec *c, const struct iovec *m, size_t n,
+					  uint8_t tag[16],
+					  const uint8_t * key, const uint8_t iv[12]);
+int aes256_dec_vfy_gcm_v(const struct iovec *m, const struct iovec *c,
+						 size_t n, const uint8_t tag[16],
+						 const uint8_t * key, const uint8_t iv[12]);
+
+//	Key object: the GHASH powers take the first cache line and the AES
+//	round keys follow (four lines in total for AES-128). The powers are in
+//	the representation of the GHASH backend active at aes_gcm_key_init().
+
+typedef struct {
+	gf128_t h[4];							//	H^4, H^3, H^2, H
+	uint32_t rk[AES256_RK_WORDS];			//	AES round keys
+	int nr;									//	number of AES rounds
+} RVK_ALIGNED gcm_key_t;
+
+//	klen is 16, 24, or 32; nonzero on other lengths
+int aes_gcm_key_init(gcm_key_t * gk, const uint8_t * key, size_t klen);
+
+void aes_enc_gcm_key(uint8_t * c, const uint8_t * m, size_t mlen,
+					 const gcm_key_t * gk, const uint8_t iv[12]);
+int aes_dec_vfy_gcm_key(uint8_t * m, const uint8_t * c, size_t clen,
+						const gcm_key_t * gk, const uint8_t iv[12]);
 
 #ifdef __cplusplus
 }
@@ -11,6 +11,7 @@
 extern "C" {
 #endif
 
+#include <stddef.h>
 #include <stdint.h>
 
 //	A GF(2^128) element type -- just for alignment and to avoid casts
@@ -29,12 +30,54 @@ void ghash_mul_rv32(gf128_t * z, const gf128_t * x, const gf128_t * h);
 
 //	32-bit karatsuba version (rv32_ghash.c)
 void ghash_mul_rv32_kar(gf128_t * z, const gf128_t * x, const gf128_t * h);
+void ghash_mul4_rv32_kar(gf128_t * z, const gf128_t x[4],
+						 const gf128_t h[4]);
+
+//	32-bit schoolbook (sb) / Karatsuba (kar) multiplication with shift (sh)
+//	or CLMUL (cm) reduction (rv32_ghash.c)
+void ghash_mul_rv32_sb_sh(gf128_t * z, const gf128_t * x, const gf128_t * h);
+void ghash_mul4_rv32_sb_sh(gf128_t * z, const gf128_t x[4],
+						   const gf128_t h[4]);
+void ghash_mul_rv32_sb_cm(gf128_t * z, const gf128_t * x, const gf128_t * h);
+void ghash_mul4_rv32_sb_cm(gf128_t * z, const gf128_t x[4],
+						   const gf128_t h[4]);
+void ghash_mul_rv32_kar_sh(gf128_t * z, const gf128_t * x, const gf128_t * h);
+void ghash_mul4_rv32_kar_sh(gf128_t * z, const gf128_t x[4],
+							const gf128_t h[4]);
+void ghash_mul_rv32_kar_cm(gf128_t * z, const gf128_t * x, const gf128_t * h);
+void ghash_mul4_rv32_kar_cm(gf128_t * z, const gf128_t x[4],
+							const gf128_t h[4]);
 
 //	bit reversal, 64-bit variant (rv64_ghash.c)
 void ghash_rev_rv64(gf128_t * z);
 
 //	64-bit version (Karatsuba optional) (rv64_ghash.c)
 void ghash_mul_rv64(gf128_t * z, const gf128_t * x, const gf128_t * h);
+void ghash_mul4_rv64(gf128_t * z, const gf128_t x[4], const gf128_t h[4]);
+
+//	64-bit schoolbook (sb) / Karatsuba (kar) multiplication with shift (sh)
+//	or CLMUL (cm) reduction (rv64_ghash.c)
+void ghash_mul_rv64_sb_sh(gf128_t * z, const gf128_t * x, const gf128_t * h);
+void ghash_mul4_rv64_sb_sh(gf128_t * z, const gf128_t x[4],
+						   const gf128_t h[4]);
+void ghash_mul_rv64_sb_cm(gf128_t * z, const gf128_t * x, const gf128_t * h);
+void ghash_mul4_rv64_sb_cm(gf128_t * z, const gf128_t x[4],
+						   const gf128_t h[4]);
+void ghash_mul_rv64_kar_sh(gf128_t * z, const gf128_t * x, const gf128_t * h);
+void ghash_mul4_rv64_kar_sh(gf128_t * z, const gf128_t x[4],
+							const gf128_t h[4]);
+void ghash_mul_rv64_kar_cm(gf128_t * z, const gf128_t * x, const gf128_t * h);
+void ghash_mul4_rv64_kar_cm(gf128_t * z, const gf128_t x[4],
+							const gf128_t h[4]);
+
+//	POLYVAL z = ( z ^ x ) * h * x^-128, 32-bit karatsuba (rv32_ghash.c)
+void polyval_mul_rv32_kar(gf128_t * z, const gf128_t * x, const gf128_t * h);
+void polyval_mul4_rv32_kar(gf128_t * z, const gf128_t x[4],
+						   const gf128_t h[4]);
+
+//	POLYVAL z = ( z ^ x ) * h * x^-128, 64-bit (rv64_ghash.c)
+void polyval_mul_rv64(gf128_t * z, const gf128_t * x, const gf128_t * h);
+void polyval_mul4_rv64(gf128_t * z, const gf128_t x[4], const gf128_t h[4]);
 
 //	Function pointers so that different versions can be tested. (aes_gcm.c)
 
@@ -44,6 +87,39 @@ extern void (*ghash_rev)(gf128_t * z);
 //	finite field multiply z = ( z ^ rev(x) ) * h
 extern void (*ghash_mul)(gf128_t * z, const gf128_t * x, const gf128_t * h);
 
+//	four blocks at once; h[] = { H^4, H^3, H^2, H }. The default is four
+//	ghash_mul() calls with h[3].
+extern void (*ghash_mul4)(gf128_t * z, const gf128_t x[4],
+						  const gf128_t h[4]);
+void ghash_mul4_loop(gf128_t * z, const gf128_t x[4], const gf128_t h[4]);
+
+//	GHASH backends that can be selected at run time (gcm_gfmul_tune.c)
+typedef struct {
+	const char *name;
+	void (*rev)(gf128_t * z);
+	void (*mul)(gf128_t * z, const gf128_t * x, const gf128_t * h);
+	void (*mul4)(gf128_t * z, const gf128_t x[4], const gf128_t h[4]);
+} ghash_impl_t;
+
+//	table of available backends, terminated by a NULL name
+extern const ghash_impl_t ghash_impl[];
+
+//	set the ghash_* pointers to backend "g"
+void ghash_select(const ghash_impl_t * g);
+
+//	time each backend over "reps" 4-block GHASH calls, check that it agrees
+//	with the others, and select the fastest one. Returns it, or NULL if no
+//	backend is available or the backends disagree; the previous selection
+//	is then kept.
+const ghash_impl_t *ghash_tune(size_t reps);
+
+//	POLYVAL (RFC 8452) multiply z = ( z ^ x ) * h * x^-128  (gcm_siv_api.c)
+extern void (*polyval_mul)(gf128_t * z, const gf128_t * x, const gf128_t * h);
+
+//	four blocks at once; h[] = { H^4, H^3, H^2, H } (Montgomery powers)
+extern void (*polyval_mul4)(gf128_t * z, const gf128_t x[4],
+							const gf128_t h[4]);
+
 #ifdef __cplusplus
 }
 #endif
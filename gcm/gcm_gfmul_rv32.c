@@ -10,7 +10,7 @@
 
 #include "gcm_gfmul.h"
 
-//	disable shift reduction
+//	disable shift reduction in ghash_mul_rv32() and ghash_mul_rv32_kar()
 #define NO_SHIFTRED
 
 //	reverse bits in bytes of a 128-bit block; do this for h and final value
@@ -120,44 +120,46 @@ void ghash_mul_rv32(gf128_t * z, const gf128_t * x, const gf128_t * h)
 	z->w[3] = z3;
 }
 
-//	multiply z = ( z ^ rev(x) ) * h
-//	32-bit Karatsuba version
+//	128 x 128 -> 256-bit carryless multiply
+//	Schoolbook: 16 x CLMULH, 16 x CLMUL, 30 x XOR
+
+static inline void clmul128_rv32_sb(uint32_t z[8], const uint32_t x[4],
+									const uint32_t y[4])
+{
+	int i, j;
+	uint32_t xi;
+
+	for (i = 0; i < 8; i++)
+		z[i] = 0;
+
+	for (i = 0; i < 4; i++) {
+		xi = x[i];
+		for (j = 0; j < 4; j++) {
+			z[i + j] ^= _rv32_clmul(xi, y[j]);
+			z[i + j + 1] ^= _rv32_clmulh(xi, y[j]);
+		}
+	}
+}
 
-void ghash_mul_rv32_kar(gf128_t * z, const gf128_t * x, const gf128_t * h)
+//	128 x 128 -> 256-bit carryless multiply
+//	2-level Karatsuba: 9 x CLMULH, 9 x CLMUL, 40 x XOR
+
+static inline void clmul128_rv32_kar(uint32_t z[8], const uint32_t x[4],
+									 const uint32_t y[4])
 {
 	uint32_t x0, x1, x2, x3, y0, y1, y2, y3;
 	uint32_t z0, z1, z2, z3, z4, z5, z6, z7;
 	uint32_t t0, t1, t2, t3;
 
-	x0 = x->w[0];							//	load new data
-	x1 = x->w[1];
-	x2 = x->w[2];
-	x3 = x->w[3];
-
-	z0 = z->w[0];							//	inline to avoid these loads
-	z1 = z->w[1];
-	z2 = z->w[2];
-	z3 = z->w[3];
-
-	y0 = h->w[0];							//	y is untouched
-	y1 = h->w[1];
-	y2 = h->w[2];
-	y3 = h->w[3];
-
-	//	4 x GREV
-	x0 = _rv32_brev8(x0);					//	reverse input x only
-	x1 = _rv32_brev8(x1);
-	x2 = _rv32_brev8(x2);
-	x3 = _rv32_brev8(x3);
-
-	//	4 x XOR
-	x0 = x0 ^ z0;							//	z is updated
-	x1 = x1 ^ z1;
-	x2 = x2 ^ z2;
-	x3 = x3 ^ z3;
+	x0 = x[0];
+	x1 = x[1];
+	x2 = x[2];
+	x3 = x[3];
 
-	//	2-level Karatsuba multiplication
-	//	9 x CLMULH, 9 x CLMUL, 40 x XOR
+	y0 = y[0];
+	y1 = y[1];
+	y2 = y[2];
+	y3 = y[3];
 
 	z7 = _rv32_clmulh(x3, y3);				//	high pair
 	z6 = _rv32_clmul(x3, y3);
@@ -213,10 +215,33 @@ void ghash_mul_rv32_kar(gf128_t * z, const gf128_t * x, const gf128_t * h)
 	z3 = z3 ^ x1;
 	z2 = z2 ^ x0;
 
-	//	== REDUCTION ==
+	z[0] = z0;
+	z[1] = z1;
+	z[2] = z2;
+	z[3] = z3;
+	z[4] = z4;
+	z[5] = z5;
+	z[6] = z6;
+	z[7] = z7;
+}
+
+//	GHASH reduction of a 256-bit product p to z
+//	Mul reduction: 4 x CLMULH, 4 x CLMUL, 8 x XOR
+
+static inline void ghash_red_rv32_cm(gf128_t * z, const uint32_t p[8])
+{
+	uint32_t z0, z1, z2, z3, z4, z5, z6, z7;
+	uint32_t t0, t1;
+
+	z0 = p[0];
+	z1 = p[1];
+	z2 = p[2];
+	z3 = p[3];
+	z4 = p[4];
+	z5 = p[5];
+	z6 = p[6];
+	z7 = p[7];
 
-#ifdef NO_SHIFTRED
-	//	Mul reduction: 4 x CLMULH, 4 x CLMUL, 8 x XOR
 	t1 = _rv32_clmulh(z7, 0x87);
 	t0 = _rv32_clmul(z7, 0x87);
 	z4 = z4 ^ t1;
@@ -233,8 +258,28 @@ void ghash_mul_rv32_kar(gf128_t * z, const gf128_t * x, const gf128_t * h)
 	t0 = _rv32_clmul(z4, 0x87);
 	z1 = z1 ^ t1;
 	z0 = z0 ^ t0;
-#else
-	//	Shift reduction: 24 x SHIFT, 28 x XOR
+
+	z->w[0] = z0;							//	inline to remove store
+	z->w[1] = z1;
+	z->w[2] = z2;
+	z->w[3] = z3;
+}
+
+//	Shift reduction: 24 x SHIFT, 28 x XOR
+
+static inline void ghash_red_rv32_sh(gf128_t * z, const uint32_t p[8])
+{
+	uint32_t z0, z1, z2, z3, z4, z5, z6, z7;
+
+	z0 = p[0];
+	z1 = p[1];
+	z2 = p[2];
+	z3 = p[3];
+	z4 = p[4];
+	z5 = p[5];
+	z6 = p[6];
+	z7 = p[7];
+
 	z4 = z4 ^ (z7 >> 31) ^ (z7 >> 30) ^ (z7 >> 25);
 	z3 = z3 ^ z7 ^ (z7 << 1) ^ (z7 << 2) ^ (z7 << 7) ^
 		(z6 >> 31) ^ (z6 >> 30) ^ (z6 >> 25);
@@ -243,13 +288,129 @@ void ghash_mul_rv32_kar(gf128_t * z, const gf128_t * x, const gf128_t * h)
 	z1 = z1 ^ z5 ^ (z5 << 1) ^ (z5 << 2) ^ (z5 << 7) ^
 		(z4 >> 31) ^ (z4 >> 30) ^ (z4 >> 25);
 	z0 = z0 ^ z4 ^ (z4 << 1) ^ (z4 << 2) ^ (z4 << 7);
-#endif
 
-	z->w[0] = z0;							//	inline to remove store
+	z->w[0] = z0;
 	z->w[1] = z1;
 	z->w[2] = z2;
 	z->w[3] = z3;
 }
 
+#ifdef NO_SHIFTRED
+#define ghash_red_rv32 ghash_red_rv32_cm
+#else
+#define ghash_red_rv32 ghash_red_rv32_sh
+#endif
+
+//	multiply z = ( z ^ rev(x) ) * h; single block and 4-block GHASH with a
+//	single (deferred) reduction,
+//	z = ( z ^ rev(x[0]) ) * h[0] + rev(x[1]) * h[1] + .. + rev(x[3]) * h[3]
+//	where h[] = { H^4, H^3, H^2, H }
+
+#define GHASH_MUL_RV32(mul, mul4, clmul, red)							\
+void mul(gf128_t * z, const gf128_t * x, const gf128_t * h)				\
+{																		\
+	uint32_t a[4], p[8];												\
+																		\
+	a[0] = _rv32_brev8(x->w[0]) ^ z->w[0];	/*	reverse input x only */	\
+	a[1] = _rv32_brev8(x->w[1]) ^ z->w[1];	/*	z is updated */			\
+	a[2] = _rv32_brev8(x->w[2]) ^ z->w[2];								\
+	a[3] = _rv32_brev8(x->w[3]) ^ z->w[3];								\
+	clmul(p, a, h->w);													\
+	red(z, p);															\
+}																		\
+																		\
+void mul4(gf128_t * z, const gf128_t x[4], const gf128_t h[4])			\
+{																		\
+	int i, j;															\
+	uint32_t a[4], p[8], t[8];											\
+																		\
+	a[0] = _rv32_brev8(x[0].w[0]) ^ z->w[0];							\
+	a[1] = _rv32_brev8(x[0].w[1]) ^ z->w[1];							\
+	a[2] = _rv32_brev8(x[0].w[2]) ^ z->w[2];							\
+	a[3] = _rv32_brev8(x[0].w[3]) ^ z->w[3];							\
+	clmul(p, a, h[0].w);												\
+	for (i = 1; i < 4; i++) {											\
+		for (j = 0; j < 4; j++)											\
+			a[j] = _rv32_brev8(x[i].w[j]);								\
+		clmul(t, a, h[i].w);											\
+		for (j = 0; j < 8; j++)											\
+			p[j] ^= t[j];												\
+	}																	\
+	red(z, p);															\
+}
+
+//	32-bit Karatsuba version; reduction as selected by NO_SHIFTRED
+GHASH_MUL_RV32(ghash_mul_rv32_kar, ghash_mul4_rv32_kar,
+			   clmul128_rv32_kar, ghash_red_rv32)
+
+//	all four combinations, for ghash_tune()
+GHASH_MUL_RV32(ghash_mul_rv32_sb_sh, ghash_mul4_rv32_sb_sh,
+			   clmul128_rv32_sb, ghash_red_rv32_sh)
+GHASH_MUL_RV32(ghash_mul_rv32_sb_cm, ghash_mul4_rv32_sb_cm,
+			   clmul128_rv32_sb, ghash_red_rv32_cm)
+GHASH_MUL_RV32(ghash_mul_rv32_kar_sh, ghash_mul4_rv32_kar_sh,
+			   clmul128_rv32_kar, ghash_red_rv32_sh)
+GHASH_MUL_RV32(ghash_mul_rv32_kar_cm, ghash_mul4_rv32_kar_cm,
+			   clmul128_rv32_kar, ghash_red_rv32_cm)
+
+//	POLYVAL Montgomery reduction z = p * x^-128 mod x^128+x^127+x^126+x^121+1
+//	4 x CLMULH, 4 x CLMUL, 12 x XOR
+
+static inline void polyval_red_rv32(gf128_t * z, uint32_t p[8])
+{
+	const uint32_t q = 0xC2000000;			//	x^31 + x^30 + x^25
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		p[i + 3] ^= _rv32_clmul(p[i], q);
+		p[i + 4] ^= _rv32_clmulh(p[i], q) ^ p[i];
+	}
+
+	z->w[0] = p[4];
+	z->w[1] = p[5];
+	z->w[2] = p[6];
+	z->w[3] = p[7];
+}
+
+//	POLYVAL: z = ( z ^ x ) * h * x^-128; no bit reversal needed
+
+void polyval_mul_rv32_kar(gf128_t * z, const gf128_t * x, const gf128_t * h)
+{
+	uint32_t a[4], p[8];
+
+	a[0] = z->w[0] ^ x->w[0];
+	a[1] = z->w[1] ^ x->w[1];
+	a[2] = z->w[2] ^ x->w[2];
+	a[3] = z->w[3] ^ x->w[3];
+
+	clmul128_rv32_kar(p, a, h->w);
+	polyval_red_rv32(z, p);
+}
+
+//	4-block POLYVAL with a single (deferred) reduction;
+//	z = ( z ^ x[0] ) * h[0] + x[1] * h[1] + x[2] * h[2] + x[3] * h[3]
+//	where h[] = { H^4, H^3, H^2, H } in the POLYVAL (Montgomery) domain
+
+void polyval_mul4_rv32_kar(gf128_t * z, const gf128_t x[4],
+						   const gf128_t h[4])
+{
+	int i, j;
+	uint32_t a[4], p[8], t[8];
+
+	a[0] = z->w[0] ^ x[0].w[0];
+	a[1] = z->w[1] ^ x[0].w[1];
+	a[2] = z->w[2] ^ x[0].w[2];
+	a[3] = z->w[3] ^ x[0].w[3];
+	clmul128_rv32_kar(p, a, h[0].w);
+
+	for (i = 1; i < 4; i++) {
+		clmul128_rv32_kar(t, x[i].w, h[i].w);
+		for (j = 0; j < 8; j++)
+			p[j] ^= t[j];
+	}
+
+	polyval_red_rv32(z, p);
+}
+
 #endif	//	RVKINTRIN_RV32
 
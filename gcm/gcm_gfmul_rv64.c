@@ -10,6 +10,11 @@
 
 #include "gcm_gfmul.h"
 
+//	Both carryless multiplications (schoolbook and Karatsuba) and both
+//	reductions (shifts and CLMUL by 0x87) are compiled in; the best pair
+//	depends on the CLMUL latency of the core, see ghash_tune(). The flags
+//	below only select the combination used by ghash_mul_rv64().
+
 //	disable shift reduction
 //#define NO_SHIFTRED
 //	disable karatsuba multiplication
@@ -23,33 +28,14 @@ void ghash_rev_rv64(gf128_t * z)
 	z->d[1] = _rv64_brev8(z->d[1]);
 }
 
-//	multiply z = ( z ^ rev(x) ) * h
+//	128 x 128 -> 256-bit carryless multiply, without Karatsuba;
+//	4 x CLMULH, 4 x CLMUL, 4 x XOR
 
-void ghash_mul_rv64(gf128_t * z, const gf128_t * x, const gf128_t * h)
+static inline void clmul128_rv64_sb(uint64_t z[4], uint64_t x0, uint64_t x1,
+									uint64_t y0, uint64_t y1)
 {
-	uint64_t x0, x1, y0, y1;
-	uint64_t z0, z1, z2, z3, t0, t1, t2;
-
-	x0 = x->d[0];							//	new input
-	x1 = x->d[1];
-
-	z0 = z->d[0];							//	inline to avoid these loads
-	z1 = z->d[1];
-
-	y0 = h->d[0];							//	h value already reversed
-	y1 = h->d[1];
-
-	//	2 x GREV, 2 x XOR
-	x0 = _rv64_brev8(x0);					//	reverse input x only
-	x1 = _rv64_brev8(x1);
-	x0 = x0 ^ z0;							//	z is updated
-	x1 = x1 ^ z1;
-
-#ifdef NO_KARATSUBA
-
-	(void) t2;								//	unused
+	uint64_t z0, z1, z2, z3, t0, t1;
 
-	//	Without Karatsuba; 4 x CLMULH, 4 x CLMUL, 4 x XOR
 	z3 = _rv64_clmulh(x1, y1);
 	z2 = _rv64_clmul(x1, y1);
 	t1 = _rv64_clmulh(x0, y1);
@@ -63,9 +49,20 @@ void ghash_mul_rv64(gf128_t * z, const gf128_t * x, const gf128_t * h)
 	z0 = _rv64_clmul(x0, y0);
 	z1 = z1 ^ t1;
 
-#else
+	z[0] = z0;
+	z[1] = z1;
+	z[2] = z2;
+	z[3] = z3;
+}
+
+//	128 x 128 -> 256-bit carryless multiply with Karatsuba;
+//	3 x CLMULH, 3 x CLMUL, 8 x XOR
+
+static inline void clmul128_rv64_kar(uint64_t z[4], uint64_t x0, uint64_t x1,
+									 uint64_t y0, uint64_t y1)
+{
+	uint64_t z0, z1, z2, z3, t0, t1, t2;
 
-	//	With Karatsuba; 3 x CLMULH, 3 x CLMUL, 8 x XOR
 	z3 = _rv64_clmulh(x1, y1);
 	z2 = _rv64_clmul(x1, y1);
 	z1 = _rv64_clmulh(x0, y0);
@@ -79,11 +76,44 @@ void ghash_mul_rv64(gf128_t * z, const gf128_t * x, const gf128_t * h)
 	z2 = z2 ^ t1;
 	z1 = z1 ^ t0;
 
-#endif
+	z[0] = z0;
+	z[1] = z1;
+	z[2] = z2;
+	z[3] = z3;
+}
 
-#ifdef NO_SHIFTRED
+//	GHASH reduction of a 256-bit product p to z
+//	Shift reduction: 12 x SHIFT, 14 x XOR
+
+static inline void ghash_red_rv64_sh(gf128_t * z, const uint64_t p[4])
+{
+	uint64_t z0, z1, z2, z3;
+
+	z0 = p[0];
+	z1 = p[1];
+	z2 = p[2];
+	z3 = p[3];
+
+	z2 = z2 ^ (z3 >> 63) ^ (z3 >> 62) ^ (z3 >> 57);
+	z1 = z1 ^ z3 ^ (z3 << 1) ^ (z3 << 2) ^ (z3 << 7) ^
+		(z2 >> 63) ^ (z2 >> 62) ^ (z2 >> 57);
+	z0 = z0 ^ z2 ^ (z2 << 1) ^ (z2 << 2) ^ (z2 << 7);
+
+	z->d[0] = z0;							//	inline to avoid these stores
+	z->d[1] = z1;
+}
+
+//	Mul reduction: 2 x CLMULH, 2 x CLMUL, 4 x XOR
+
+static inline void ghash_red_rv64_cm(gf128_t * z, const uint64_t p[4])
+{
+	uint64_t z0, z1, z2, z3, t0, t1;
+
+	z0 = p[0];
+	z1 = p[1];
+	z2 = p[2];
+	z3 = p[3];
 
-	//	Mul reduction: 2 x CLMULH, 2 x CLMUL, 4 x XOR
 	t1 = _rv64_clmulh(z3, 0x87);
 	t0 = _rv64_clmul(z3, 0x87);
 	z2 = z2 ^ t1;
@@ -93,18 +123,116 @@ void ghash_mul_rv64(gf128_t * z, const gf128_t * x, const gf128_t * h)
 	z1 = z1 ^ t1;
 	z0 = z0 ^ t0;
 
-#else
+	z->d[0] = z0;
+	z->d[1] = z1;
+}
 
-	//	Shift reduction: 12 x SHIFT, 14 x XOR
-	z2 = z2 ^ (z3 >> 63) ^ (z3 >> 62) ^ (z3 >> 57);
-	z1 = z1 ^ z3 ^ (z3 << 1) ^ (z3 << 2) ^ (z3 << 7) ^
-		(z2 >> 63) ^ (z2 >> 62) ^ (z2 >> 57);
-	z0 = z0 ^ z2 ^ (z2 << 1) ^ (z2 << 2) ^ (z2 << 7);
+//	the combination used by ghash_mul_rv64() and the POLYVAL functions
 
+#ifdef NO_KARATSUBA
+#define clmul128_rv64 clmul128_rv64_sb
+#else
+#define clmul128_rv64 clmul128_rv64_kar
 #endif
 
-	z->d[0] = z0;							//	inline to avoid these stores
-	z->d[1] = z1;
+#ifdef NO_SHIFTRED
+#define ghash_red_rv64 ghash_red_rv64_cm
+#else
+#define ghash_red_rv64 ghash_red_rv64_sh
+#endif
+
+//	multiply z = ( z ^ rev(x) ) * h; single block and 4-block GHASH with a
+//	single (deferred) reduction,
+//	z = ( z ^ rev(x[0]) ) * h[0] + rev(x[1]) * h[1] + .. + rev(x[3]) * h[3]
+//	where h[] = { H^4, H^3, H^2, H }
+
+#define GHASH_MUL_RV64(mul, mul4, clmul, red)							\
+void mul(gf128_t * z, const gf128_t * x, const gf128_t * h)				\
+{																		\
+	uint64_t p[4];														\
+																		\
+	clmul(p, _rv64_brev8(x->d[0]) ^ z->d[0],							\
+		  _rv64_brev8(x->d[1]) ^ z->d[1], h->d[0], h->d[1]);			\
+	red(z, p);															\
+}																		\
+																		\
+void mul4(gf128_t * z, const gf128_t x[4], const gf128_t h[4])			\
+{																		\
+	int i;																\
+	uint64_t p[4], t[4];												\
+																		\
+	clmul(p, _rv64_brev8(x[0].d[0]) ^ z->d[0],							\
+		  _rv64_brev8(x[0].d[1]) ^ z->d[1], h[0].d[0], h[0].d[1]);		\
+	for (i = 1; i < 4; i++) {											\
+		clmul(t, _rv64_brev8(x[i].d[0]), _rv64_brev8(x[i].d[1]),		\
+			  h[i].d[0], h[i].d[1]);									\
+		p[0] ^= t[0];													\
+		p[1] ^= t[1];													\
+		p[2] ^= t[2];													\
+		p[3] ^= t[3];													\
+	}																	\
+	red(z, p);															\
+}
+
+GHASH_MUL_RV64(ghash_mul_rv64, ghash_mul4_rv64,
+			   clmul128_rv64, ghash_red_rv64)
+GHASH_MUL_RV64(ghash_mul_rv64_sb_sh, ghash_mul4_rv64_sb_sh,
+			   clmul128_rv64_sb, ghash_red_rv64_sh)
+GHASH_MUL_RV64(ghash_mul_rv64_sb_cm, ghash_mul4_rv64_sb_cm,
+			   clmul128_rv64_sb, ghash_red_rv64_cm)
+GHASH_MUL_RV64(ghash_mul_rv64_kar_sh, ghash_mul4_rv64_kar_sh,
+			   clmul128_rv64_kar, ghash_red_rv64_sh)
+GHASH_MUL_RV64(ghash_mul_rv64_kar_cm, ghash_mul4_rv64_kar_cm,
+			   clmul128_rv64_kar, ghash_red_rv64_cm)
+
+//	POLYVAL Montgomery reduction z = p * x^-128 mod x^128+x^127+x^126+x^121+1
+//	2 x CLMULH, 2 x CLMUL, 6 x XOR
+
+static inline void polyval_red_rv64(gf128_t * z, const uint64_t p[4])
+{
+	const uint64_t q = 0xC200000000000000;	//	x^63 + x^62 + x^57
+	uint64_t z1, z2, z3;
+
+	z1 = p[1] ^ _rv64_clmul(p[0], q);
+	z2 = p[2] ^ _rv64_clmulh(p[0], q) ^ p[0];
+	z2 = z2 ^ _rv64_clmul(z1, q);
+	z3 = p[3] ^ _rv64_clmulh(z1, q) ^ z1;
+
+	z->d[0] = z2;
+	z->d[1] = z3;
+}
+
+//	POLYVAL: z = ( z ^ x ) * h * x^-128; no bit reversal needed
+
+void polyval_mul_rv64(gf128_t * z, const gf128_t * x, const gf128_t * h)
+{
+	uint64_t p[4];
+
+	clmul128_rv64(p, z->d[0] ^ x->d[0], z->d[1] ^ x->d[1], h->d[0], h->d[1]);
+	polyval_red_rv64(z, p);
+}
+
+//	4-block POLYVAL with a single (deferred) reduction;
+//	z = ( z ^ x[0] ) * h[0] + x[1] * h[1] + x[2] * h[2] + x[3] * h[3]
+//	where h[] = { H^4, H^3, H^2, H } in the POLYVAL (Montgomery) domain
+
+void polyval_mul4_rv64(gf128_t * z, const gf128_t x[4], const gf128_t h[4])
+{
+	int i;
+	uint64_t p[4], t[4];
+
+	clmul128_rv64(p, z->d[0] ^ x[0].d[0], z->d[1] ^ x[0].d[1],
+				  h[0].d[0], h[0].d[1]);
+
+	for (i = 1; i < 4; i++) {
+		clmul128_rv64(t, x[i].d[0], x[i].d[1], h[i].d[0], h[i].d[1]);
+		p[0] ^= t[0];
+		p[1] ^= t[1];
+		p[2] ^= t[2];
+		p[3] ^= t[3];
+	}
+
+	polyval_red_rv64(z, p);
 }
 
 #endif	//	RVKINTRIN_RV64
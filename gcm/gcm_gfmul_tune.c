@@ -0,0 +1,120 @@
+//	gcm_gfmul_tune.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Run-time selection of the GHASH multiplication backend.
+
+#include <string.h>
+
+#include "riscv_crypto.h"
+#include "rvk_cycles.h"
+#include "gcm_gfmul.h"
+
+//	all backends compiled in; the first one of each ISA is the default
+
+const ghash_impl_t ghash_impl[] = {
+#ifdef RVKINTRIN_RV64
+	{ "rv64", ghash_rev_rv64, ghash_mul_rv64, ghash_mul4_rv64 },
+	{ "rv64_sb_sh", ghash_rev_rv64, ghash_mul_rv64_sb_sh,
+	  ghash_mul4_rv64_sb_sh },
+	{ "rv64_sb_cm", ghash_rev_rv64, ghash_mul_rv64_sb_cm,
+	  ghash_mul4_rv64_sb_cm },
+	{ "rv64_kar_sh", ghash_rev_rv64, ghash_mul_rv64_kar_sh,
+	  ghash_mul4_rv64_kar_sh },
+	{ "rv64_kar_cm", ghash_rev_rv64, ghash_mul_rv64_kar_cm,
+	  ghash_mul4_rv64_kar_cm },
+#endif
+#ifdef RVKINTRIN_RV32
+	{ "rv32_kar", ghash_rev_rv32, ghash_mul_rv32_kar, ghash_mul4_rv32_kar },
+	{ "rv32", ghash_rev_rv32, ghash_mul_rv32, ghash_mul4_loop },
+	{ "rv32_sb_sh", ghash_rev_rv32, ghash_mul_rv32_sb_sh,
+	  ghash_mul4_rv32_sb_sh },
+	{ "rv32_sb_cm", ghash_rev_rv32, ghash_mul_rv32_sb_cm,
+	  ghash_mul4_rv32_sb_cm },
+	{ "rv32_kar_sh", ghash_rev_rv32, ghash_mul_rv32_kar_sh,
+	  ghash_mul4_rv32_kar_sh },
+	{ "rv32_kar_cm", ghash_rev_rv32, ghash_mul_rv32_kar_cm,
+	  ghash_mul4_rv32_kar_cm },
+#endif
+	{ NULL, NULL, NULL, NULL }
+};
+
+void ghash_select(const ghash_impl_t * g)
+{
+	ghash_rev = g->rev;
+	ghash_mul = g->mul;
+	ghash_mul4 = g->mul4;
+}
+
+//	"reps" 4-block multiplications; returns the best of three timings
+
+#define GHASH_TUNE_TRIES 3
+
+static uint64_t ghash_time(gf128_t * z, const ghash_impl_t * g, size_t reps)
+{
+	gf128_t x[4], h[4];
+	uint64_t t, best;
+	size_t i, j;
+
+	for (i = 0; i < 4; i++) {				//	fixed, arbitrary operands
+		for (j = 0; j < 16; j++)
+			x[i].b[j] = (uint8_t) (0x3D * (16 * i + j) + 1);
+	}
+	for (j = 0; j < 16; j++)
+		h[3].b[j] = (uint8_t) (0x5B * j + 7);
+	for (i = 3; i > 0; i--) {				//	h[] = { H^4, H^3, H^2, H }
+		*z = h[i];
+		g->rev(z);
+		memset(&h[i - 1], 0, sizeof(gf128_t));
+		g->mul(&h[i - 1], z, &h[3]);
+	}
+
+	best = 0;
+	for (i = 0; i < GHASH_TUNE_TRIES; i++) {
+		memset(z, 0, sizeof(gf128_t));
+		t = rvk_cycles();
+		for (j = 0; j < reps; j++)
+			g->mul4(z, x, h);
+		t = rvk_cycles() - t;
+		if (i == 0 || t < best)
+			best = t;
+	}
+
+	return best;
+}
+
+//	each backend is selected while timed; the generic loops (such as
+//	ghash_mul4_loop) go through the global pointers
+
+const ghash_impl_t *ghash_tune(size_t reps)
+{
+	const ghash_impl_t *g, *best;
+	ghash_impl_t cur;
+	gf128_t z0, z;
+	uint64_t t, tb;
+
+	cur.name = "current";
+	cur.rev = ghash_rev;
+	cur.mul = ghash_mul;
+	cur.mul4 = ghash_mul4;
+
+	best = NULL;
+	tb = 0;
+	for (g = ghash_impl; g->name != NULL; g++) {
+		ghash_select(g);
+		t = ghash_time(&z, g, reps);
+		if (g == ghash_impl) {
+			z0 = z;
+		} else if (memcmp(&z, &z0, sizeof(gf128_t)) != 0) {
+			ghash_select(&cur);				//	disagreement
+			return NULL;
+		}
+		if (best == NULL || t < tb) {
+			best = g;
+			tb = t;
+		}
+	}
+	ghash_select(best != NULL ? best : &cur);
+
+	return best;
+}
@@ -0,0 +1,295 @@
+//	gcm_siv_api.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	AES-GCM-SIV on top of the multi-block AES pointers and POLYVAL.
+
+#include <string.h>
+
+#include "riscv_crypto.h"
+#include "test_rvkat.h"
+#include "rv_endian.h"
+#include "rvk_mem.h"
+#include "aes/aes_api.h"
+#include "gcm_siv_api.h"
+#include "gcm_gfmul.h"
+
+//	number of CTR blocks given to the multi-block cipher at once
+
+#define SIV_PAR 8
+
+typedef void (*siv_ecbn_t)(uint8_t * d, const uint8_t * s, size_t n,
+						   const uint32_t * rk);
+
+typedef void (*siv_key_t)(uint32_t * rk, const uint8_t * key);
+
+static void polyval_mul_undef(gf128_t *z, const gf128_t *x, const gf128_t *h)
+{
+	(void) z;
+	(void) x;
+	(void) h;
+	rvkat_info("undefined pointer: polyval_mul_undef()");
+}
+
+//	generic four-block POLYVAL via the single-block pointer
+
+static void polyval_mul4_loop(gf128_t *z, const gf128_t x[4],
+							  const gf128_t h[4])
+{
+	int i;
+
+	for (i = 0; i < 4; i++)
+		polyval_mul(z, &x[i], &h[3]);
+}
+
+//	function pointers are here
+
+void (*polyval_mul)(gf128_t *, const gf128_t *, const gf128_t *) =
+	polyval_mul_undef;
+void (*polyval_mul4)(gf128_t *, const gf128_t[4], const gf128_t[4]) =
+	polyval_mul4_loop;
+
+//	absorb "len" bytes (zero-padded) into POLYVAL state "z"
+
+static void polyval_upd(gf128_t * z, const gf128_t hp[4],
+						const uint8_t * s, size_t len)
+{
+	gf128_t x[4];
+
+	while (len >= 64) {						//	four blocks at a time
+		memcpy(x[0].b, s, 64);
+		polyval_mul4(z, x, hp);
+		s += 64;
+		len -= 64;
+	}
+
+	while (len >= 16) {
+		memcpy(x[0].b, s, 16);
+		polyval_mul(z, &x[0], &hp[3]);
+		s += 16;
+		len -= 16;
+	}
+
+	if (len > 0) {							//	partial block
+		memset(x[0].b, 0, 16);
+		memcpy(x[0].b, s, len);
+		polyval_mul(z, &x[0], &hp[3]);
+	}
+}
+
+//	per-nonce key derivation: 4 (AES-128) or 6 (AES-256) blocks in a
+//	single batch. "rk" holds the master key schedule on input and the
+//	message encryption key schedule on output.
+
+static void aes_gcm_siv_kdf(gf128_t hp[4], uint32_t rk[],
+							const uint8_t n[12], size_t nb,
+							siv_ecbn_t ecbn, siv_key_t enc_key)
+{
+	size_t i;
+	gf128_t blk[6], zero;
+	uint8_t ek[32];
+
+	for (i = 0; i < nb; i++) {
+		put32u_le(blk[i].b, i);
+		memcpy(blk[i].b + 4, n, 12);
+	}
+	ecbn(blk[0].b, blk[0].b, nb, rk);
+
+	memcpy(hp[3].b, blk[0].b, 8);			//	message authentication key
+	memcpy(hp[3].b + 8, blk[1].b, 8);
+	for (i = 2; i < nb; i++)				//	message encryption key
+		memcpy(ek + 8 * (i - 2), blk[i].b, 8);
+	enc_key(rk, ek);
+	rvk_memzero(ek, sizeof(ek));			//	clear derived keys
+	rvk_memzero(blk, sizeof(blk));
+
+	zero.d[0] = 0;							//	H^2, H^3, H^4
+	zero.d[1] = 0;
+	for (i = 3; i > 0; i--) {
+		hp[i - 1] = hp[i];
+		polyval_mul(&hp[i - 1], &zero, &hp[3]);
+	}
+}
+
+//	the tag; POLYVAL of AAD, message and length block, then encrypt
+
+static void aes_gcm_siv_tag(gf128_t * t, const uint8_t * m, size_t mlen,
+							const uint8_t * a, size_t alen,
+							const uint8_t n[12], const gf128_t hp[4],
+							const uint32_t rk[], siv_ecbn_t ecbn)
+{
+	size_t i;
+	gf128_t l;
+
+	t->d[0] = 0;
+	t->d[1] = 0;
+	polyval_upd(t, hp, a, alen);
+	polyval_upd(t, hp, m, mlen);
+	put64u_le(l.b, ((uint64_t) alen) << 3);
+	put64u_le(l.b + 8, ((uint64_t) mlen) << 3);
+	polyval_mul(t, &l, &hp[3]);
+
+	for (i = 0; i < 12; i++)
+		t->b[i] ^= n[i];
+	t->b[15] &= 0x7F;
+	ecbn(t->b, t->b, 1, rk);
+}
+
+//	CTR mode with a 32-bit little-endian counter, SIV_PAR blocks at once
+
+static void aes_gcm_siv_ctr(uint8_t * dst, const uint8_t * src, size_t len,
+							const gf128_t * t, const uint32_t rk[],
+							siv_ecbn_t ecbn)
+{
+	size_t i, j, l;
+	uint32_t ctr;
+	gf128_t c, k[SIV_PAR], b[SIV_PAR];
+
+	c = *t;
+	c.b[15] |= 0x80;
+	ctr = get32u_le(c.b);
+
+	while (len > 0) {
+		l = len < 16 * SIV_PAR ? len : 16 * SIV_PAR;
+		j = (l + 15) / 16;
+		for (i = 0; i < j; i++) {
+			k[i] = c;
+			put32u_le(k[i].b, ctr++);		//	wraps mod 2^32
+		}
+		ecbn(k[0].b, k[0].b, j, rk);
+
+		memcpy(b[0].b, src, l);
+		for (i = 0; i < j; i++) {
+			b[i].d[0] ^= k[i].d[0];
+			b[i].d[1] ^= k[i].d[1];
+		}
+		memcpy(dst, b[0].b, l);
+
+		src += l;
+		dst += l;
+		len -= l;
+	}
+	rvk_memzero(k, sizeof(k));				//	clear keystream
+	rvk_memzero(b, sizeof(b));
+}
+
+//	length limits of RFC 8452
+
+static int aes_gcm_siv_len(size_t mlen, size_t alen)
+{
+	return ((uint64_t) mlen > (1ull << 36) ||
+			(uint64_t) alen > (1ull << 36)) ? -1 : 0;
+}
+
+//	encrypt and append tag
+
+static int aes_gcm_siv_enc(uint8_t * c, const uint8_t * m, size_t mlen,
+						   const uint8_t * a, size_t alen,
+						   const uint8_t n[12], uint32_t rk[], size_t nb,
+						   siv_ecbn_t ecbn, siv_key_t enc_key)
+{
+	gf128_t hp[4], t;
+
+	if (aes_gcm_siv_len(mlen, alen))
+		return -1;
+
+	aes_gcm_siv_kdf(hp, rk, n, nb, ecbn, enc_key);
+	aes_gcm_siv_tag(&t, m, mlen, a, alen, n, hp, rk, ecbn);
+	aes_gcm_siv_ctr(c, m, mlen, &t, rk, ecbn);
+	memcpy(c + mlen, t.b, 16);
+	rvk_memzero(hp, sizeof(hp));
+
+	return 0;
+}
+
+//	decrypt with the received tag, then verify it
+
+static int aes_gcm_siv_vfy(uint8_t * m, const uint8_t * c, size_t clen,
+						   const uint8_t * a, size_t alen,
+						   const uint8_t n[12], uint32_t rk[], size_t nb,
+						   siv_ecbn_t ecbn, siv_key_t enc_key)
+{
+	gf128_t hp[4], t, r;
+	int ret = 0;
+
+	if (clen < 16 || aes_gcm_siv_len(clen - 16, alen))
+		return -1;
+	clen -= 16;
+
+	aes_gcm_siv_kdf(hp, rk, n, nb, ecbn, enc_key);
+	memcpy(r.b, c + clen, 16);				//	c and m may overlap
+	aes_gcm_siv_ctr(m, c, clen, &r, rk, ecbn);
+	aes_gcm_siv_tag(&t, m, clen, a, alen, n, hp, rk, ecbn);
+
+	if (!rvk_memeq_ct(t.b, r.b, 16)) {		//	no unverified plaintext
+		memset(m, 0, clen);
+		ret = 1;
+	}
+	rvk_memzero(hp, sizeof(hp));
+
+	return ret;
+}
+
+//	AES128-GCM-SIV
+
+int aes128_enc_gcm_siv(uint8_t * c, const uint8_t * m, size_t mlen,
+					   const uint8_t * a, size_t alen,
+					   const uint8_t * key, const uint8_t n[12])
+{
+	uint32_t rk[AES128_RK_WORDS];
+	int ret;
+
+	aes128_enc_key(rk, key);
+	ret = aes_gcm_siv_enc(c, m, mlen, a, alen, n, rk, 4,
+						  aes128_enc_ecbn, aes128_enc_key);
+	rvk_memzero(rk, sizeof(rk));
+
+	return ret;
+}
+
+int aes128_dec_vfy_gcm_siv(uint8_t * m, const uint8_t * c, size_t clen,
+						   const uint8_t * a, size_t alen,
+						   const uint8_t * key, const uint8_t n[12])
+{
+	uint32_t rk[AES128_RK_WORDS];
+	int ret;
+
+	aes128_enc_key(rk, key);
+	ret = aes_gcm_siv_vfy(m, c, clen, a, alen, n, rk, 4,
+						  aes128_enc_ecbn, aes128_enc_key);
+	rvk_memzero(rk, sizeof(rk));
+
+	return ret;
+}
+
+//	AES256-GCM-SIV
+
+int aes256_enc_gcm_siv(uint8_t * c, const uint8_t * m, size_t mlen,
+					   const uint8_t * a, size_t alen,
+					   const uint8_t * key, const uint8_t n[12])
+{
+	uint32_t rk[AES256_RK_WORDS];
+	int ret;
+
+	aes256_enc_key(rk, key);
+	ret = aes_gcm_siv_enc(c, m, mlen, a, alen, n, rk, 6,
+						  aes256_enc_ecbn, aes256_enc_key);
+	rvk_memzero(rk, sizeof(rk));
+
+	return ret;
+}
+
+int aes256_dec_vfy_gcm_siv(uint8_t * m, const uint8_t * c, size_t clen,
+						   const uint8_t * a, size_t alen,
+						   const uint8_t * key, const uint8_t n[12])
+{
+	uint32_t rk[AES256_RK_WORDS];
+	int ret;
+
+	aes256_enc_key(rk, key);
+	ret = aes_gcm_siv_vfy(m, c, clen, a, alen, n, rk, 6,
+						  aes256_enc_ecbn, aes256_enc_key);
+	rvk_memzero(rk, sizeof(rk));
+
+	return ret;
+}
@@ -0,0 +1,42 @@
+//	gcm_siv_api.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	AES-GCM-SIV (RFC 8452), nonce misuse-resistant AEAD. 96-bit nonce,
+//	128-bit tag appended at the end; ciphertext is 16 bytes larger than
+//	plaintext. Plaintext and AAD are limited to 2^36 bytes. Routines return
+//	nonzero on invalid lengths or (aesxxx_dec_vfy_gcm_siv) on failure.
+
+#ifndef _GCM_SIV_API_H_
+#define _GCM_SIV_API_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+//	AES-GCM-SIV-128 Encrypt / Decrypt & Verify
+
+int aes128_enc_gcm_siv(uint8_t * c, const uint8_t * m, size_t mlen,
+					   const uint8_t * a, size_t alen,
+					   const uint8_t * key, const uint8_t n[12]);
+int aes128_dec_vfy_gcm_siv(uint8_t * m, const uint8_t * c, size_t clen,
+						   const uint8_t * a, size_t alen,
+						   const uint8_t * key, const uint8_t n[12]);
+
+//	AES-GCM-SIV-256 Encrypt / Decrypt & Verify
+
+int aes256_enc_gcm_siv(uint8_t * c, const uint8_t * m, size_t mlen,
+					   const uint8_t * a, size_t alen,
+					   const uint8_t * key, const uint8_t n[12]);
+int aes256_dec_vfy_gcm_siv(uint8_t * m, const uint8_t * c, size_t clen,
+						   const uint8_t * a, size_t alen,
+						   const uint8_t * key, const uint8_t n[12]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	//	_GCM_SIV_API_H_
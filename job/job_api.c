@@ -0,0 +1,311 @@
+//	job_api.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Job ring and the batch scheduler.
+
+#include <string.h>
+
+#include "rvk_mem.h"
+#include "aes/aes_api.h"
+#include "sm4/sm4_api.h"
+#include "gcm/gcm_gfmul.h"
+#include "sha2/sha2_api.h"
+#include "sha2/sha2_hmac.h"
+#include "job_api.h"
+
+//	number of blocks given to the multi-block cipher at once
+
+#define JOB_BLK 16
+
+typedef void (*job_ecbn_t)(uint8_t * d, const uint8_t * s, size_t n,
+						   const uint32_t * rk);
+
+//	SM4 has no multi-block kernel; loop
+
+static void job_sm4_ecbn(uint8_t * d, const uint8_t * s, size_t n,
+						 const uint32_t * rk)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++)
+		sm4_encdec(d + 16 * i, s + 16 * i, rk);
+}
+
+//	=== ring ===
+
+void rvk_ring_init(rvk_ring_t *r)
+{
+	r->head = 0;
+	r->tail = 0;
+}
+
+int rvk_ring_submit(rvk_ring_t *r, rvk_job_t *j)
+{
+	if (r->tail - r->head >= RVK_RING_SIZE)
+		return -1;
+	j->status = RVK_JOB_PENDING;
+	r->job[r->tail % RVK_RING_SIZE] = j;
+	r->tail++;
+
+	return 0;
+}
+
+//	=== GCM for a group of jobs under one key ===
+
+//	GHASH "len" bytes, zero-padding the last block
+
+static void job_ghash(gf128_t * z, const uint8_t * s, size_t len,
+					  const gf128_t * h)
+{
+	gf128_t x;
+
+	while (len >= 16) {
+		memcpy(x.b, s, 16);
+		ghash_mul(z, &x, h);
+		s += 16;
+		len -= 16;
+	}
+	if (len > 0) {
+		x.d[0] = 0;
+		x.d[1] = 0;
+		memcpy(x.b, s, len);
+		ghash_mul(z, &x, h);
+	}
+}
+
+//	keystream block destination
+
+typedef struct {
+	uint8_t *d;								//	output (or E(J0) slot)
+	const uint8_t *s;						//	input, NULL for E(J0)
+	size_t l;								//	bytes
+} job_blk_t;
+
+static void job_gcm_flush(gf128_t * b, job_blk_t * e, size_t n,
+						  const uint32_t * rk, job_ecbn_t ecbn)
+{
+	size_t i, j;
+
+	ecbn(b[0].b, b[0].b, n, rk);
+	for (i = 0; i < n; i++) {
+		if (e[i].s == NULL) {
+			memcpy(e[i].d, b[i].b, 16);
+		} else {
+			for (j = 0; j < e[i].l; j++)
+				e[i].d[j] = e[i].s[j] ^ b[i].b[j];
+		}
+	}
+}
+
+static void job_gcm_group(rvk_job_t **job, size_t n,
+						  const uint32_t * rk, job_ecbn_t ecbn)
+{
+	size_t i, k, o, nb;
+	uint32_t ctr;
+	gf128_t h, b[JOB_BLK], x;
+	gf128_t z[RVK_RING_SIZE], ek0[RVK_RING_SIZE];
+	job_blk_t e[JOB_BLK];
+	rvk_job_t *p;
+
+	h.d[0] = 0;								//	H = E(0), once per key
+	h.d[1] = 0;
+	ecbn(h.b, h.b, 1, rk);
+	ghash_rev(&h);
+
+	//	AAD (and ciphertext when decrypting) is hashed up front
+
+	for (i = 0; i < n; i++) {
+		p = job[i];
+		z[i].d[0] = 0;
+		z[i].d[1] = 0;
+		job_ghash(&z[i], p->aad, p->alen, &h);
+		if (p->op == RVK_JOB_DEC)
+			job_ghash(&z[i], p->src, p->len, &h);
+	}
+
+	//	counter blocks of all jobs through the multi-block cipher
+
+	k = 0;
+	for (i = 0; i < n; i++) {
+		p = job[i];
+		nb = (p->len + 15) / 16;
+		for (ctr = 1; ctr <= nb + 1; ctr++) {
+			memcpy(b[k].b, p->iv, 12);
+			b[k].w[3] = __builtin_bswap32(ctr);
+			if (ctr == 1) {					//	E(J0) for the tag
+				e[k].d = ek0[i].b;
+				e[k].s = NULL;
+				e[k].l = 16;
+			} else {
+				o = 16 * (ctr - 2);
+				e[k].d = p->dst + o;
+				e[k].s = p->src + o;
+				e[k].l = p->len - o < 16 ? p->len - o : 16;
+			}
+			if (++k == JOB_BLK) {
+				job_gcm_flush(b, e, k, rk, ecbn);
+				k = 0;
+			}
+		}
+	}
+	if (k > 0)
+		job_gcm_flush(b, e, k, rk, ecbn);
+
+	//	finish GHASH, write or check tags
+
+	for (i = 0; i < n; i++) {
+		p = job[i];
+		if (p->op == RVK_JOB_ENC)
+			job_ghash(&z[i], p->dst, p->len, &h);
+		x.w[0] = __builtin_bswap32(p->alen >> 29);
+		x.w[1] = __builtin_bswap32(p->alen << 3);
+		x.w[2] = __builtin_bswap32(p->len >> 29);
+		x.w[3] = __builtin_bswap32(p->len << 3);
+		ghash_mul(&z[i], &x, &h);
+		ghash_rev(&z[i]);
+		ek0[i].d[0] ^= z[i].d[0];
+		ek0[i].d[1] ^= z[i].d[1];
+
+		if (p->op == RVK_JOB_ENC) {
+			memcpy(p->tag, ek0[i].b, 16);
+			p->status = RVK_JOB_OK;
+		} else {
+			memcpy(x.b, p->tag, 16);
+			x.d[0] ^= ek0[i].d[0];
+			x.d[1] ^= ek0[i].d[1];
+			if ((x.d[0] | x.d[1]) == 0) {
+				p->status = RVK_JOB_OK;
+			} else {
+				if (p->len > 0)				//	no unauthenticated output
+					memset(p->dst, 0, p->len);
+				p->status = RVK_JOB_AUTH;
+			}
+		}
+	}
+
+	memset(b, 0, sizeof(b));				//	clear keystream
+	memset(ek0, 0, n * sizeof(gf128_t));
+}
+
+//	=== scheduler ===
+
+//	same algorithm and key?
+
+static int job_same(const rvk_job_t *a, const rvk_job_t *b)
+{
+	if (a->alg != b->alg)
+		return 0;
+	if (a->alg == RVK_JOB_SHA256)
+		return 1;
+	return a->klen == b->klen &&
+		(a->key == b->key || rvk_memeq_ct(a->key, b->key, a->klen));
+}
+
+//	parameter checks; sets status to RVK_JOB_INVALID on failure
+
+static int job_check(rvk_job_t *p)
+{
+	int ok;
+
+	switch (p->alg) {
+		case RVK_JOB_AES128_GCM:
+		case RVK_JOB_SM4_GCM:
+		case RVK_JOB_AES192_GCM:
+		case RVK_JOB_AES256_GCM:
+			ok = p->klen == (p->alg == RVK_JOB_AES256_GCM ? 32 :
+							 p->alg == RVK_JOB_AES192_GCM ? 24 : 16) &&
+				(p->op == RVK_JOB_ENC || p->op == RVK_JOB_DEC) &&
+				p->iv != NULL && p->tag != NULL &&
+				(p->alen == 0 || p->aad != NULL) &&
+				(p->len == 0 || (p->src != NULL && p->dst != NULL)) &&
+				p->len <= ((uint64_t) 1 << 36) - 32;	//	GCM limit
+			break;
+		case RVK_JOB_HMAC_SHA256:
+			ok = (p->klen == 0 || p->key != NULL) && p->dst != NULL &&
+				(p->len == 0 || p->src != NULL);
+			break;
+		case RVK_JOB_SHA256:
+			ok = p->dst != NULL && (p->len == 0 || p->src != NULL);
+			break;
+		default:
+			ok = 0;
+	}
+	if (!ok)
+		p->status = RVK_JOB_INVALID;
+
+	return ok;
+}
+
+//	run a group of jobs that share an algorithm and key
+
+static void job_run_group(rvk_job_t **g, size_t n)
+{
+	size_t i;
+	uint32_t rk[AES256_RK_WORDS];
+	hmac_sha256_key_t hk;
+
+	switch (g[0]->alg) {
+		case RVK_JOB_AES128_GCM:
+			aes128_enc_key(rk, g[0]->key);
+			job_gcm_group(g, n, rk, aes128_enc_ecbn);
+			break;
+		case RVK_JOB_AES192_GCM:
+			aes192_enc_key(rk, g[0]->key);
+			job_gcm_group(g, n, rk, aes192_enc_ecbn);
+			break;
+		case RVK_JOB_AES256_GCM:
+			aes256_enc_key(rk, g[0]->key);
+			job_gcm_group(g, n, rk, aes256_enc_ecbn);
+			break;
+		case RVK_JOB_SM4_GCM:
+			sm4_enc_key(rk, g[0]->key);
+			job_gcm_group(g, n, rk, job_sm4_ecbn);
+			break;
+		case RVK_JOB_SHA256:
+			for (i = 0; i < n; i++) {
+				sha2_256(g[i]->dst, g[i]->src, g[i]->len);
+				g[i]->status = RVK_JOB_OK;
+			}
+			break;
+		case RVK_JOB_HMAC_SHA256:
+			hmac_sha256_key(&hk, g[0]->key, g[0]->klen);
+			for (i = 0; i < n; i++) {
+				hmac_sha256(g[i]->dst, &hk, g[i]->src, g[i]->len);
+				g[i]->status = RVK_JOB_OK;
+			}
+			memset(&hk, 0, sizeof(hk));
+			break;
+	}
+	memset(rk, 0, sizeof(rk));
+}
+
+size_t rvk_ring_poll(rvk_ring_t *r, rvk_job_t **done, size_t max)
+{
+	size_t i, j, n, m;
+	rvk_job_t *g[RVK_RING_SIZE];
+
+	n = r->tail - r->head;
+	n = n < max ? n : max;
+	for (i = 0; i < n; i++) {
+		done[i] = r->job[(r->head + i) % RVK_RING_SIZE];
+		job_check(done[i]);
+	}
+	r->head += n;
+
+	//	group pending jobs by algorithm and key, first come first served
+
+	for (i = 0; i < n; i++) {
+		if (done[i]->status != RVK_JOB_PENDING)
+			continue;
+		m = 0;
+		for (j = i; j < n; j++) {
+			if (done[j]->status == RVK_JOB_PENDING &&
+				job_same(done[i], done[j]))
+				g[m++] = done[j];
+		}
+		job_run_group(g, m);
+	}
+
+	return n;
+}
@@ -0,0 +1,85 @@
+//	job_api.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Batched crypto jobs: submit job descriptors to a ring, then one poll
+//	runs the whole batch. Jobs with the same algorithm and key are run
+//	together -- the key is expanded once, and the counter blocks of all
+//	GCM jobs in a group go through the multi-block cipher together.
+//	A ring is not thread-safe; use one per thread.
+
+#ifndef _JOB_API_H_
+#define _JOB_API_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+//	algorithms
+#define RVK_JOB_AES128_GCM	1
+#define RVK_JOB_AES256_GCM	2
+#define RVK_JOB_SM4_GCM		3
+#define RVK_JOB_SHA256		4
+#define RVK_JOB_HMAC_SHA256	5
+#define RVK_JOB_AES192_GCM	6
+
+//	operations (GCM only)
+#define RVK_JOB_ENC			0
+#define RVK_JOB_DEC			1
+
+//	status
+#define RVK_JOB_OK			0				//	done
+#define RVK_JOB_AUTH		1				//	tag mismatch; output cleared
+#define RVK_JOB_INVALID		-1				//	bad parameters
+#define RVK_JOB_PENDING		-2				//	submitted, not yet run
+
+//	ring capacity (power of 2); also the largest batch
+#ifndef RVK_RING_SIZE
+#define RVK_RING_SIZE 64
+#endif
+
+//	A job. The caller owns it and all buffers until it is returned by
+//	rvk_ring_poll().
+//	GCM: "src" of "len" bytes to "dst"; 12-byte "iv"; optional "aad";
+//		 16-byte "tag" is written (ENC) or checked (DEC).
+//	SHA256: 32-byte digest of "src" to "dst"; key is ignored.
+//	HMAC_SHA256: 32-byte MAC of "src" under "key" to "dst".
+
+typedef struct {
+	int alg, op;
+	const uint8_t *key;
+	size_t klen;
+	const uint8_t *iv;
+	const uint8_t *aad;
+	size_t alen;
+	const uint8_t *src;
+	size_t len;
+	uint8_t *dst;
+	uint8_t *tag;
+	int status;
+	void *user;								//	not used by the library
+} rvk_job_t;
+
+typedef struct {
+	rvk_job_t *job[RVK_RING_SIZE];
+	size_t head, tail;						//	next to run, next free
+} rvk_ring_t;
+
+//	empty the ring
+void rvk_ring_init(rvk_ring_t *r);
+
+//	queue a job; nonzero if the ring is full
+int rvk_ring_submit(rvk_ring_t *r, rvk_job_t *j);
+
+//	run up to "max" queued jobs as one batch; the jobs are written to
+//	"done" in submission order and their number is returned
+size_t rvk_ring_poll(rvk_ring_t *r, rvk_job_t **done, size_t max);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	//	_JOB_API_H_
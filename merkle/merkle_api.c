@@ -0,0 +1,182 @@
+//	merkle_api.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Binary hash trees over SHA-256, SHA3-256 and SM3.
+
+#include <string.h>
+
+#include "rv_endian.h"
+#include "sha2/sha2_api.h"
+#include "sha3/sha3_api.h"
+#include "sm3/sm3_api.h"
+#include "par/par_api.h"
+#include "merkle_api.h"
+
+//	SHA3-256 of "n" 64-byte messages; they fit in a single rate block, so
+//	each is one permutation. Groups of four go to sha3_keccakp4.
+
+static void merkle_sha3_64b(uint8_t *md, const uint8_t *m, size_t n)
+{
+	uint64_t st[4][25];
+	size_t i, j, k, w;
+
+	for (i = 0; i < n; i += j) {
+		j = n - i < 4 ? n - i : 4;
+		memset(st, 0x00, sizeof(st));
+		for (k = 0; k < j; k++) {
+			for (w = 0; w < 8; w++)
+				st[k][w] = get64u_le(m + 64 * (i + k) + 8 * w);
+			st[k][8] = 0x06;				//	SHA-3 padding, rate 136
+			st[k][16] = 0x8000000000000000ULL;
+		}
+		if (j == 4) {
+			sha3_keccakp4(st);
+		} else {
+			for (k = 0; k < j; k++)
+				sha3_keccakp(st[k]);
+		}
+		for (k = 0; k < j; k++) {
+			for (w = 0; w < 4; w++)
+				put64u_le(md + 32 * (i + k) + 8 * w, st[k][w]);
+		}
+	}
+}
+
+//	hash "n" pairs of nodes at "in" to "n" nodes at "out"
+
+static void merkle_pairs(int alg, uint8_t *out, const uint8_t *in, size_t n)
+{
+	size_t i;
+
+	switch (alg) {
+		case RVK_MERKLE_SHA256:
+			sha256_64B_batch(out, in, n);
+			break;
+		case RVK_MERKLE_SHA3_256:
+			merkle_sha3_64b(out, in, n);
+			break;
+		case RVK_MERKLE_SM3:
+			for (i = 0; i < n; i++)
+				sm3_256(out + 32 * i, in + 64 * i, 64);
+			break;
+	}
+}
+
+//	a range of pairs, split into chunks for the worker pool
+
+typedef struct {
+	int alg;
+	uint8_t *out;
+	const uint8_t *in;
+	size_t n, chunk;
+} merkle_job_t;
+
+static void merkle_chunk(void *arg, size_t i)
+{
+	merkle_job_t *p = (merkle_job_t *) arg;
+	size_t o, l;
+
+	o = i * p->chunk;
+	l = p->n - o < p->chunk ? p->n - o : p->chunk;
+	merkle_pairs(p->alg, p->out + 32 * o, p->in + 64 * o, l);
+}
+
+//	recompute nodes [a, b) of level "v" + 1 from level "v"
+
+static void merkle_level(merkle_t *t, size_t v, size_t a, size_t b)
+{
+	merkle_job_t p;
+	size_t np;
+
+	np = t->cnt[v] / 2;						//	full pairs in level v
+	if (b > np) {							//	promoted odd node
+		memcpy(t->node[t->off[v + 1] + np], t->node[t->off[v] + 2 * np], 32);
+		b = np;
+	}
+	if (a >= b)
+		return;
+
+	p.alg = t->alg;
+	p.out = t->node[t->off[v + 1] + a];
+	p.in = t->node[t->off[v] + 2 * a];
+	p.n = b - a;
+	p.chunk = RVK_MERKLE_CHUNK;
+	if (p.n < 2 * RVK_MERKLE_CHUNK) {		//	too small to split
+		merkle_pairs(p.alg, p.out, p.in, p.n);
+		return;
+	}
+	if (p.n > RVK_PAR_JOBS * p.chunk)		//	bound the number of jobs
+		p.chunk = (p.n + RVK_PAR_JOBS - 1) / RVK_PAR_JOBS;
+	rvk_pool_run(merkle_chunk, &p, (p.n + p.chunk - 1) / p.chunk);
+}
+
+//	tree layout
+
+size_t merkle_nodes(size_t n)
+{
+	size_t s = n;
+
+	while (n > 1) {
+		n = (n + 1) / 2;
+		s += n;
+	}
+
+	return s;
+}
+
+int merkle_init(merkle_t *t, int alg, uint8_t (*node)[32], size_t n)
+{
+	size_t v;
+
+	if (alg != RVK_MERKLE_SHA256 && alg != RVK_MERKLE_SHA3_256 &&
+		alg != RVK_MERKLE_SM3)
+		return -1;
+	if (n == 0)
+		return -1;
+
+	t->alg = alg;
+	t->node = node;
+	t->off[0] = 0;
+	t->cnt[0] = n;
+	for (v = 0; t->cnt[v] > 1; v++) {
+		t->off[v + 1] = t->off[v] + t->cnt[v];
+		t->cnt[v + 1] = (t->cnt[v] + 1) / 2;
+	}
+	t->lev = v + 1;
+
+	return 0;
+}
+
+void merkle_build(merkle_t *t)
+{
+	size_t v;
+
+	for (v = 0; v + 1 < t->lev; v++)
+		merkle_level(t, v, 0, t->cnt[v + 1]);
+}
+
+void merkle_update(merkle_t *t, size_t i, const uint8_t (*leaf)[32],
+				   size_t n)
+{
+	size_t v, a, b;
+
+	if (n == 0 || i >= t->cnt[0])
+		return;
+	if (n > t->cnt[0] - i)
+		n = t->cnt[0] - i;
+	memcpy(t->node[i], leaf, 32 * n);
+
+	a = i;									//	changed nodes [a, b)
+	b = i + n;
+	for (v = 0; v + 1 < t->lev; v++) {
+		a = a / 2;
+		b = (b + 1) / 2;
+		merkle_level(t, v, a, b);
+	}
+}
+
+const uint8_t *merkle_root(const merkle_t *t)
+{
+	return t->node[t->off[t->lev - 1]];
+}
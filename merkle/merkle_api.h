@@ -0,0 +1,65 @@
+//	merkle_api.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Binary hash trees over 32-byte leaf hashes. An inner node is the hash
+//	of its two children, H(left || right); the last node of a level with
+//	an odd number of nodes is promoted to the next level unchanged. Each
+//	level is hashed as one batch of 64-byte messages, and wide levels are
+//	split over the par/ worker pool.
+
+#ifndef _MERKLE_API_H_
+#define _MERKLE_API_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+//	hash functions
+#define RVK_MERKLE_SHA256	1				//	sha256_compress
+#define RVK_MERKLE_SHA3_256	2				//	sha3_keccakp, sha3_keccakp4
+#define RVK_MERKLE_SM3		3				//	sm3_compress
+
+//	largest tree height (levels including leaves and root)
+#define RVK_MERKLE_LEVELS	64
+
+//	smallest number of nodes per worker when a level is split
+#ifndef RVK_MERKLE_CHUNK
+#define RVK_MERKLE_CHUNK	256
+#endif
+
+typedef struct {
+	int alg;
+	size_t lev;								//	number of levels
+	size_t off[RVK_MERKLE_LEVELS];			//	first node of each level
+	size_t cnt[RVK_MERKLE_LEVELS];			//	nodes in each level
+	uint8_t (*node)[32];					//	all nodes; leaves first
+} merkle_t;
+
+//	number of 32-byte nodes needed for a tree of "n" leaves
+size_t merkle_nodes(size_t n);
+
+//	set up tree "t" of "n" leaves in "node", which has merkle_nodes(n)
+//	entries; the leaf hashes go to node[0 .. n - 1]. Returns -1 if "alg"
+//	or "n" is not valid, 0 otherwise.
+int merkle_init(merkle_t *t, int alg, uint8_t (*node)[32], size_t n);
+
+//	compute all inner nodes from the leaves
+void merkle_build(merkle_t *t);
+
+//	replace "n" leaves starting from leaf "i" and recompute only the
+//	nodes above them
+void merkle_update(merkle_t *t, size_t i, const uint8_t (*leaf)[32],
+				   size_t n);
+
+//	the 32-byte root
+const uint8_t *merkle_root(const merkle_t *t);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	//	_MERKLE_API_H_
@@ -0,0 +1,472 @@
+//	par_api.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	ECB, CTR, GCM and XTS split into chunks and run on the worker pool.
+//	GCM chunks compute partial GHASH values which are combined in order
+//	with powers of H.
+
+#include <string.h>
+
+#include "rv_endian.h"
+#include "aes/aes_api.h"
+#include "rvk_mem.h"
+#include "gcm/gcm_gfmul.h"
+#include "xts/xts_api.h"
+#include "par_api.h"
+
+//	number of blocks given to the multi-block cipher at once
+
+#define PAR_BLK 8
+
+typedef void (*par_ecbn_t)(uint8_t * d, const uint8_t * s, size_t n,
+						   const uint32_t * rk);
+
+//	chunk size for "len" bytes: at least RVK_PAR_CHUNK, at most
+//	RVK_PAR_JOBS chunks, a multiple of "unit". Depends only on "len".
+
+static size_t par_chunk(size_t len, size_t unit)
+{
+	size_t l;
+
+	l = (len + RVK_PAR_JOBS - 1) / RVK_PAR_JOBS;
+	if (l < RVK_PAR_CHUNK)
+		l = RVK_PAR_CHUNK;
+	return (l + unit - 1) / unit * unit;
+}
+
+//	=== ECB ===
+
+typedef struct {
+	uint8_t *d;
+	const uint8_t *s;
+	size_t n, cn;							//	blocks, blocks per chunk
+	const uint32_t *rk;
+	par_ecbn_t ecbn;
+} par_ecb_t;
+
+static void par_ecb_job(void *arg, size_t i)
+{
+	par_ecb_t *p = (par_ecb_t *) arg;
+	size_t o, n;
+
+	o = i * p->cn;
+	n = p->n - o < p->cn ? p->n - o : p->cn;
+	p->ecbn(p->d + 16 * o, p->s + 16 * o, n, p->rk);
+}
+
+static void par_ecb(uint8_t * d, const uint8_t * s, size_t n,
+					const uint32_t * rk, par_ecbn_t ecbn)
+{
+	par_ecb_t p;
+
+	p.d = d;
+	p.s = s;
+	p.n = n;
+	p.cn = par_chunk(16 * n, 16) / 16;
+	p.rk = rk;
+	p.ecbn = ecbn;
+	rvk_pool_run(par_ecb_job, &p, (n + p.cn - 1) / p.cn);
+}
+
+void aes128_enc_ecb_par(uint8_t * ct, const uint8_t * pt, size_t n,
+						const uint32_t * rk)
+{
+	par_ecb(ct, pt, n, rk, aes128_enc_ecbn);
+}
+
+void aes192_enc_ecb_par(uint8_t * ct, const uint8_t * pt, size_t n,
+						const uint32_t * rk)
+{
+	par_ecb(ct, pt, n, rk, aes192_enc_ecbn);
+}
+
+void aes256_enc_ecb_par(uint8_t * ct, const uint8_t * pt, size_t n,
+						const uint32_t * rk)
+{
+	par_ecb(ct, pt, n, rk, aes256_enc_ecbn);
+}
+
+void aes128_dec_ecb_par(uint8_t * pt, const uint8_t * ct, size_t n,
+						const uint32_t * rk)
+{
+	par_ecb(pt, ct, n, rk, aes128_dec_ecbn);
+}
+
+void aes192_dec_ecb_par(uint8_t * pt, const uint8_t * ct, size_t n,
+						const uint32_t * rk)
+{
+	par_ecb(pt, ct, n, rk, aes192_dec_ecbn);
+}
+
+void aes256_dec_ecb_par(uint8_t * pt, const uint8_t * ct, size_t n,
+						const uint32_t * rk)
+{
+	par_ecb(pt, ct, n, rk, aes256_dec_ecbn);
+}
+
+//	=== CTR and GCM ===
+
+//	one chunk is a run of counter blocks; with "z" != NULL the chunk's
+//	GHASH partial (of the ciphertext) is computed too
+
+typedef struct {
+	uint8_t *d;
+	const uint8_t *s;
+	size_t len, cl;							//	bytes, bytes per chunk
+	const uint32_t *rk;
+	par_ecbn_t ecbn;
+	uint64_t c0, c1;						//	initial counter block
+	int gcm;								//	32-bit counter, GHASH
+	int enc;								//	GHASH output (1) or input (0)
+	gf128_t h;								//	GHASH key
+	gf128_t z[RVK_PAR_JOBS];				//	GHASH partials
+} par_ctr_t;
+
+static void par_ctr_job(void *arg, size_t i)
+{
+	par_ctr_t *p = (par_ctr_t *) arg;
+	size_t j, k, l, len;
+	uint64_t c0, c1, o;
+	uint32_t w;
+	uint8_t *d;
+	const uint8_t *s;
+	gf128_t b[PAR_BLK], x, z;
+
+	o = i * p->cl;							//	offset of this chunk
+	d = p->d + o;
+	s = p->s + o;
+	len = p->len - o < p->cl ? p->len - o : p->cl;
+
+	c0 = p->c0;								//	counter offset for chunk
+	c1 = p->c1;
+	if (p->gcm) {
+		w = ((uint32_t) c1) + (uint32_t) (o / 16);
+		c1 = (c1 & 0xFFFFFFFF00000000) | w;
+	} else {
+		c1 += o / 16;
+		c0 += (c1 < p->c1);
+	}
+
+	z.d[0] = 0;
+	z.d[1] = 0;
+
+	while (len > 0) {
+		k = (len + 15) / 16;
+		k = k < PAR_BLK ? k : PAR_BLK;
+		for (j = 0; j < k; j++) {
+			put64u_be(b[j].b, c0);
+			put64u_be(b[j].b + 8, c1);
+			if (p->gcm) {
+				w = ((uint32_t) c1) + 1;
+				c1 = (c1 & 0xFFFFFFFF00000000) | w;
+			} else {
+				c1++;
+				c0 += (c1 == 0);
+			}
+		}
+		p->ecbn(b[0].b, b[0].b, k, p->rk);
+
+		for (j = 0; j < k && len > 0; j++) {
+			l = len < 16 ? len : 16;
+			x.d[0] = 0;
+			x.d[1] = 0;
+			memcpy(x.b, s, l);
+			if (p->gcm && !p->enc)
+				ghash_mul(&z, &x, &p->h);	//	GHASH ciphertext input
+			x.d[0] ^= b[j].d[0];
+			x.d[1] ^= b[j].d[1];
+			memcpy(d, x.b, l);
+			if (p->gcm && p->enc) {
+				memset(&x.b[l], 0, 16 - l);	//	zero pad
+				ghash_mul(&z, &x, &p->h);	//	GHASH ciphertext output
+			}
+			s += l;
+			d += l;
+			len -= l;
+		}
+	}
+
+	if (p->gcm)
+		p->z[i] = z;
+
+	memset(b, 0, sizeof(b));				//	clear keystream
+	memset(&x, 0, sizeof(x));
+}
+
+static void par_ctr(uint8_t * d, const uint8_t * s, size_t len,
+					const uint32_t * rk, par_ecbn_t ecbn,
+					const uint8_t ctr[16])
+{
+	par_ctr_t p;
+
+	p.d = d;
+	p.s = s;
+	p.len = len;
+	p.cl = par_chunk(len, 16);
+	p.rk = rk;
+	p.ecbn = ecbn;
+	p.c0 = get64u_be(ctr);
+	p.c1 = get64u_be(ctr + 8);
+	p.gcm = 0;
+	p.enc = 0;
+	rvk_pool_run(par_ctr_job, &p, (len + p.cl - 1) / p.cl);
+}
+
+void aes128_ctr_par(uint8_t * d, const uint8_t * s, size_t len,
+					const uint32_t * rk, const uint8_t ctr[16])
+{
+	par_ctr(d, s, len, rk, aes128_enc_ecbn, ctr);
+}
+
+void aes192_ctr_par(uint8_t * d, const uint8_t * s, size_t len,
+					const uint32_t * rk, const uint8_t ctr[16])
+{
+	par_ctr(d, s, len, rk, aes192_enc_ecbn, ctr);
+}
+
+void aes256_ctr_par(uint8_t * d, const uint8_t * s, size_t len,
+					const uint32_t * rk, const uint8_t ctr[16])
+{
+	par_ctr(d, s, len, rk, aes256_enc_ecbn, ctr);
+}
+
+//	field multiply z = x * y (GHASH representation of ghash_mul)
+
+static void par_gfmul(gf128_t * z, const gf128_t * x, const gf128_t * y)
+{
+	gf128_t t, r;
+
+	t = *x;
+	ghash_rev(&t);
+	r.d[0] = 0;
+	r.d[1] = 0;
+	ghash_mul(&r, &t, y);
+	*z = r;
+}
+
+//	z = h^n, n >= 1
+
+static void par_gfpow(gf128_t * z, const gf128_t * h, size_t n)
+{
+	gf128_t a, r;
+	int i;
+
+	r = *h;
+	a = *h;
+	for (i = 8 * sizeof(size_t) - 1; i >= 0; i--) {
+		if ((n >> i) & 1)
+			break;
+	}
+	for (i--; i >= 0; i--) {
+		par_gfmul(&r, &r, &r);
+		if ((n >> i) & 1)
+			par_gfmul(&r, &r, &a);
+	}
+	*z = r;
+}
+
+//	GCM on the pool; "tag" is computed, "len" is the payload length
+
+static void par_gcm(uint8_t * dst, uint8_t tag[16],
+					const uint8_t * src, size_t len,
+					const uint8_t iv[12], const uint32_t * rk,
+					par_ecbn_t ecbn, int enc_flag)
+{
+	par_ctr_t p;
+	size_t i, n;
+	gf128_t j0, t, hn, z;
+
+	p.h.d[0] = 0;							//	H = AES_k(0), E(J0)
+	p.h.d[1] = 0;
+	memcpy(j0.b, iv, 12);
+	j0.w[3] = __builtin_bswap32(1);
+	t = j0;
+	ecbn(p.h.b, p.h.b, 1, rk);
+	ecbn(t.b, t.b, 1, rk);
+	ghash_rev(&p.h);
+
+	p.d = dst;
+	p.s = src;
+	p.len = len;
+	p.cl = par_chunk(len, 16);
+	p.rk = rk;
+	p.ecbn = ecbn;
+	p.c0 = get64u_be(j0.b);
+	p.c1 = get64u_be(j0.b + 8) + 1;			//	inc32(J0); no carry from 1
+	p.gcm = 1;
+	p.enc = enc_flag;
+	n = (len + p.cl - 1) / p.cl;
+	rvk_pool_run(par_ctr_job, &p, n);
+
+	//	Horner over chunks: z = z * H^(blocks in chunk) + z_i
+
+	z.d[0] = 0;
+	z.d[1] = 0;
+	if (n > 0)
+		par_gfpow(&hn, &p.h, p.cl / 16);
+	for (i = 0; i < n; i++) {
+		if (i == n - 1 && len - i * p.cl < p.cl)
+			par_gfpow(&hn, &p.h, (len - i * p.cl + 15) / 16);
+		par_gfmul(&z, &z, &hn);
+		z.d[0] ^= p.z[i].d[0];
+		z.d[1] ^= p.z[i].d[1];
+	}
+
+	j0.d[0] = 0;							//	pad with bit length
+	j0.w[2] = __builtin_bswap32(len >> 29);
+	j0.w[3] = __builtin_bswap32(len << 3);
+	ghash_mul(&z, &j0, &p.h);
+	ghash_rev(&z);
+	t.d[0] ^= z.d[0];
+	t.d[1] ^= z.d[1];
+	memcpy(tag, t.b, 16);
+}
+
+static int par_gcm_vfy(uint8_t * m, const uint8_t * c, size_t clen,
+					   const uint8_t iv[12], const uint32_t * rk,
+					   par_ecbn_t ecbn)
+{
+	uint8_t tag[16];
+
+	if (clen < 16)
+		return -1;
+
+	par_gcm(m, tag, c, clen - 16, iv, rk, ecbn, 0);
+	if (!rvk_memeq_ct(tag, c + clen - 16, 16)) {
+		memset(m, 0, clen - 16);			//	no unauthenticated output
+		return 1;
+	}
+
+	return 0;
+}
+
+void aes128_enc_gcm_par(uint8_t * c, const uint8_t * m, size_t mlen,
+						const uint8_t * key, const uint8_t iv[12])
+{
+	uint32_t rk[AES128_RK_WORDS];
+
+	aes128_enc_key(rk, key);
+	par_gcm(c, c + mlen, m, mlen, iv, rk, aes128_enc_ecbn, 1);
+}
+
+int aes128_dec_vfy_gcm_par(uint8_t * m, const uint8_t * c, size_t clen,
+						   const uint8_t * key, const uint8_t iv[12])
+{
+	uint32_t rk[AES128_RK_WORDS];
+
+	aes128_enc_key(rk, key);
+	return par_gcm_vfy(m, c, clen, iv, rk, aes128_enc_ecbn);
+}
+
+void aes192_enc_gcm_par(uint8_t * c, const uint8_t * m, size_t mlen,
+						const uint8_t * key, const uint8_t iv[12])
+{
+	uint32_t rk[AES192_RK_WORDS];
+
+	aes192_enc_key(rk, key);
+	par_gcm(c, c + mlen, m, mlen, iv, rk, aes192_enc_ecbn, 1);
+}
+
+int aes192_dec_vfy_gcm_par(uint8_t * m, const uint8_t * c, size_t clen,
+						   const uint8_t * key, const uint8_t iv[12])
+{
+	uint32_t rk[AES192_RK_WORDS];
+
+	aes192_enc_key(rk, key);
+	return par_gcm_vfy(m, c, clen, iv, rk, aes192_enc_ecbn);
+}
+
+void aes256_enc_gcm_par(uint8_t * c, const uint8_t * m, size_t mlen,
+						const uint8_t * key, const uint8_t iv[12])
+{
+	uint32_t rk[AES256_RK_WORDS];
+
+	aes256_enc_key(rk, key);
+	par_gcm(c, c + mlen, m, mlen, iv, rk, aes256_enc_ecbn, 1);
+}
+
+int aes256_dec_vfy_gcm_par(uint8_t * m, const uint8_t * c, size_t clen,
+						   const uint8_t * key, const uint8_t iv[12])
+{
+	uint32_t rk[AES256_RK_WORDS];
+
+	aes256_enc_key(rk, key);
+	return par_gcm_vfy(m, c, clen, iv, rk, aes256_enc_ecbn);
+}
+
+//	=== XTS: whole sectors per chunk ===
+
+typedef int (*par_xts_t)(uint8_t * d, const uint8_t * s,
+						 size_t secsiz, size_t nsec,
+						 const uint8_t * key, uint64_t secno);
+
+typedef struct {
+	uint8_t *d;
+	const uint8_t *s;
+	size_t secsiz, nsec, cs;				//	sectors per chunk
+	const uint8_t *key;
+	uint64_t secno;
+	par_xts_t xts;
+} par_xts_arg_t;
+
+static void par_xts_job(void *arg, size_t i)
+{
+	par_xts_arg_t *p = (par_xts_arg_t *) arg;
+	size_t o, n;
+
+	o = i * p->cs;
+	n = p->nsec - o < p->cs ? p->nsec - o : p->cs;
+	p->xts(p->d + o * p->secsiz, p->s + o * p->secsiz,
+		   p->secsiz, n, p->key, p->secno + o);
+}
+
+static int par_xts(uint8_t * d, const uint8_t * s,
+				   size_t secsiz, size_t nsec,
+				   const uint8_t * key, uint64_t secno, par_xts_t xts)
+{
+	par_xts_arg_t p;
+
+	if (secsiz < 16)
+		return -1;
+
+	p.d = d;
+	p.s = s;
+	p.secsiz = secsiz;
+	p.nsec = nsec;
+	p.cs = par_chunk(secsiz * nsec, secsiz) / secsiz;
+	p.key = key;
+	p.secno = secno;
+	p.xts = xts;
+	rvk_pool_run(par_xts_job, &p, (nsec + p.cs - 1) / p.cs);
+
+	return 0;
+}
+
+int aes128_enc_xts_sec_par(uint8_t * c, const uint8_t * m,
+						   size_t secsiz, size_t nsec,
+						   const uint8_t key[32], uint64_t secno)
+{
+	return par_xts(c, m, secsiz, nsec, key, secno, aes128_enc_xts_sec);
+}
+
+int aes128_dec_xts_sec_par(uint8_t * m, const uint8_t * c,
+						   size_t secsiz, size_t nsec,
+						   const uint8_t key[32], uint64_t secno)
+{
+	return par_xts(m, c, secsiz, nsec, key, secno, aes128_dec_xts_sec);
+}
+
+int aes256_enc_xts_sec_par(uint8_t * c, const uint8_t * m,
+						   size_t secsiz, size_t nsec,
+						   const uint8_t key[64], uint64_t secno)
+{
+	return par_xts(c, m, secsiz, nsec, key, secno, aes256_enc_xts_sec);
+}
+
+int aes256_dec_xts_sec_par(uint8_t * m, const uint8_t * c,
+						   size_t secsiz, size_t nsec,
+						   const uint8_t key[64], uint64_t secno)
+{
+	return par_xts(m, c, secsiz, nsec, key, secno, aes256_dec_xts_sec);
+}
@@ -0,0 +1,108 @@
+//	par_api.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Parallel bulk encryption on a worker pool. Build with -DRVK_PTHREAD
+//	(and -pthread) to get POSIX threads; otherwise, or before
+//	rvk_pool_init(), everything runs serially on the calling thread. The
+//	buffer split depends only on the length, so output is identical to
+//	the serial path for any number of workers.
+
+#ifndef _PAR_API_H_
+#define _PAR_API_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+//	maximum number of worker threads
+#ifndef RVK_POOL_MAX
+#define RVK_POOL_MAX 16
+#endif
+
+//	smallest chunk given to a worker (bytes; multiple of 16)
+#ifndef RVK_PAR_CHUNK
+#define RVK_PAR_CHUNK 0x4000
+#endif
+
+//	maximum number of chunks per call; larger buffers get larger chunks
+#ifndef RVK_PAR_JOBS
+#define RVK_PAR_JOBS 64
+#endif
+
+//	=== Worker pool ===
+
+//	start "nthr" workers (at most RVK_POOL_MAX); returns the number started
+int rvk_pool_init(int nthr);
+
+//	stop and join the workers
+void rvk_pool_free(void);
+
+//	call fn(arg, i) for i = 0, 1, .. n - 1 on the pool and the calling
+//	thread; returns when all are done. Serial if the pool is not running
+//	or already busy with another call.
+void rvk_pool_run(void (*fn)(void *arg, size_t i), void *arg, size_t n);
+
+//	=== ECB (n blocks) ===
+
+void aes128_enc_ecb_par(uint8_t * ct, const uint8_t * pt, size_t n,
+						const uint32_t * rk);
+void aes192_enc_ecb_par(uint8_t * ct, const uint8_t * pt, size_t n,
+						const uint32_t * rk);
+void aes256_enc_ecb_par(uint8_t * ct, const uint8_t * pt, size_t n,
+						const uint32_t * rk);
+void aes128_dec_ecb_par(uint8_t * pt, const uint8_t * ct, size_t n,
+						const uint32_t * rk);
+void aes192_dec_ecb_par(uint8_t * pt, const uint8_t * ct, size_t n,
+						const uint32_t * rk);
+void aes256_dec_ecb_par(uint8_t * pt, const uint8_t * ct, size_t n,
+						const uint32_t * rk);
+
+//	=== CTR (SP 800-38A; 128-bit big-endian counter) ===
+//	the same operation encrypts and decrypts
+
+void aes128_ctr_par(uint8_t * d, const uint8_t * s, size_t len,
+					const uint32_t * rk, const uint8_t ctr[16]);
+void aes192_ctr_par(uint8_t * d, const uint8_t * s, size_t len,
+					const uint32_t * rk, const uint8_t ctr[16]);
+void aes256_ctr_par(uint8_t * d, const uint8_t * s, size_t len,
+					const uint32_t * rk, const uint8_t ctr[16]);
+
+//	=== GCM (same format as gcm_api.h: no AAD, tag appended) ===
+
+void aes128_enc_gcm_par(uint8_t * c, const uint8_t * m, size_t mlen,
+						const uint8_t * key, const uint8_t iv[12]);
+int aes128_dec_vfy_gcm_par(uint8_t * m, const uint8_t * c, size_t clen,
+						   const uint8_t * key, const uint8_t iv[12]);
+void aes192_enc_gcm_par(uint8_t * c, const uint8_t * m, size_t mlen,
+						const uint8_t * key, const uint8_t iv[12]);
+int aes192_dec_vfy_gcm_par(uint8_t * m, const uint8_t * c, size_t clen,
+						   const uint8_t * key, const uint8_t iv[12]);
+void aes256_enc_gcm_par(uint8_t * c, const uint8_t * m, size_t mlen,
+						const uint8_t * key, const uint8_t iv[12]);
+int aes256_dec_vfy_gcm_par(uint8_t * m, const uint8_t * c, size_t clen,
+						   const uint8_t * key, const uint8_t iv[12]);
+
+//	=== XTS (same as the *_xts_sec functions in xts_api.h) ===
+
+int aes128_enc_xts_sec_par(uint8_t * c, const uint8_t * m,
+						   size_t secsiz, size_t nsec,
+						   const uint8_t key[32], uint64_t secno);
+int aes128_dec_xts_sec_par(uint8_t * m, const uint8_t * c,
+						   size_t secsiz, size_t nsec,
+						   const uint8_t key[32], uint64_t secno);
+int aes256_enc_xts_sec_par(uint8_t * c, const uint8_t * m,
+						   size_t secsiz, size_t nsec,
+						   const uint8_t key[64], uint64_t secno);
+int aes256_dec_xts_sec_par(uint8_t * m, const uint8_t * c,
+						   size_t secsiz, size_t nsec,
+						   const uint8_t key[64], uint64_t secno);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	//	_PAR_API_H_
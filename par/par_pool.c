@@ -0,0 +1,144 @@
+//	par_pool.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	A minimal worker pool: one job at a time, indices handed out in order.
+
+#include "par_api.h"
+
+#ifdef RVK_PTHREAD
+
+#include <pthread.h>
+
+static pthread_t pool_thr[RVK_POOL_MAX];
+static int pool_n = 0;
+
+static pthread_mutex_t pool_busy = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t pool_mtx = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pool_work = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t pool_done = PTHREAD_COND_INITIALIZER;
+
+//	current job; protected by pool_mtx
+
+static void (*job_fn)(void *, size_t) = NULL;
+static void *job_arg = NULL;
+static size_t job_n = 0, job_next = 0, job_done = 0;
+static int pool_quit = 0;
+
+//	run indices of the current job until none are left; pool_mtx is held
+//	on entry and exit
+
+static void pool_drain(void)
+{
+	size_t i;
+	void (*fn)(void *, size_t) = job_fn;
+	void *arg = job_arg;
+
+	while (job_fn != NULL && job_next < job_n) {
+		i = job_next++;
+		pthread_mutex_unlock(&pool_mtx);
+		fn(arg, i);
+		pthread_mutex_lock(&pool_mtx);
+		if (++job_done == job_n)
+			pthread_cond_signal(&pool_done);
+	}
+}
+
+static void *pool_worker(void *p)
+{
+	(void) p;
+
+	pthread_mutex_lock(&pool_mtx);
+	while (!pool_quit) {
+		if (job_fn != NULL && job_next < job_n)
+			pool_drain();
+		else
+			pthread_cond_wait(&pool_work, &pool_mtx);
+	}
+	pthread_mutex_unlock(&pool_mtx);
+
+	return NULL;
+}
+
+int rvk_pool_init(int nthr)
+{
+	if (pool_n > 0)
+		rvk_pool_free();
+	if (nthr > RVK_POOL_MAX)
+		nthr = RVK_POOL_MAX;
+
+	pool_quit = 0;
+	while (pool_n < nthr) {
+		if (pthread_create(&pool_thr[pool_n], NULL, pool_worker, NULL) != 0)
+			break;
+		pool_n++;
+	}
+
+	return pool_n;
+}
+
+void rvk_pool_free(void)
+{
+	int i;
+
+	pthread_mutex_lock(&pool_mtx);
+	pool_quit = 1;
+	pthread_cond_broadcast(&pool_work);
+	pthread_mutex_unlock(&pool_mtx);
+
+	for (i = 0; i < pool_n; i++)
+		pthread_join(pool_thr[i], NULL);
+	pool_n = 0;
+}
+
+void rvk_pool_run(void (*fn)(void *arg, size_t i), void *arg, size_t n)
+{
+	size_t i;
+
+	//	serial if there is no pool, nothing to split, or it is in use
+	if (pool_n == 0 || n < 2 || pthread_mutex_trylock(&pool_busy) != 0) {
+		for (i = 0; i < n; i++)
+			fn(arg, i);
+		return;
+	}
+
+	pthread_mutex_lock(&pool_mtx);
+	job_fn = fn;
+	job_arg = arg;
+	job_n = n;
+	job_next = 0;
+	job_done = 0;
+	pthread_cond_broadcast(&pool_work);
+
+	pool_drain();							//	caller works too
+	while (job_done < job_n)
+		pthread_cond_wait(&pool_done, &pool_mtx);
+	job_fn = NULL;
+	pthread_mutex_unlock(&pool_mtx);
+
+	pthread_mutex_unlock(&pool_busy);
+}
+
+#else
+
+//	no threads: serial
+
+int rvk_pool_init(int nthr)
+{
+	(void) nthr;
+	return 0;
+}
+
+void rvk_pool_free(void)
+{
+}
+
+void rvk_pool_run(void (*fn)(void *arg, size_t i), void *arg, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++)
+		fn(arg, i);
+}
+
+#endif
@@ -7,6 +7,9 @@
 #	(lacking K flag here)
 CFLAGS	+=	-march=rv64imafdc -mabi=lp64d -DRVKINTRIN_ASSEMBLER
 
+#	no Zkr access under pk: seed rvk_random() deterministically (tests only)
+CFLAGS	+=	-DRVK_ES16_EMU
+
 #	toolchain
 XCHAIN	=	$(RISCV)/bin/riscv64-unknown-elf-
 
@@ -0,0 +1,108 @@
+//	rvk_align.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Cache line size and alignment for key objects. Key objects start on a
+//	cache line and occupy whole lines, so two keys never share a line.
+//	Word access to data buffers that may be misaligned.
+
+#ifndef _RVK_ALIGN_H_
+#define _RVK_ALIGN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef RVK_CACHE_LINE
+#define RVK_CACHE_LINE 64
+#endif
+
+#define RVK_ALIGNED __attribute__((aligned(RVK_CACHE_LINE)))
+
+//	round a size up to a whole number of cache lines
+#define RVK_LINES(n) \
+	(((n) + RVK_CACHE_LINE - 1) & ~((size_t) RVK_CACHE_LINE - 1))
+
+//	pointer "p" is a multiple of "n" bytes (a power of two)
+#define RVK_IS_ALIGNED(p, n) ((((uintptr_t) (p)) & ((n) - 1)) == 0)
+
+//	Misaligned (little-endian) 64-bit word access without misaligned loads
+//	or stores: the inner words are assembled with shifts from aligned
+//	accesses, only the partial words at the two ends are done bytewise.
+//	Memory outside the "8 * nw" bytes at "p" is never touched.
+
+static inline void rvk_load64_ua(uint64_t * w, const uint8_t * p, size_t nw)
+{
+	const uint64_t *q;
+	uint64_t a, b;
+	size_t i, o, s;
+
+	o = ((uintptr_t) p) & 7;
+	if (o == 0) {
+		for (i = 0; i < nw; i++)
+			w[i] = ((const uint64_t *) p)[i];
+		return;
+	}
+	s = 8 * o;
+	q = (const uint64_t *) (p - o);			//	aligned base
+
+	a = 0;
+	for (i = 0; i < 8 - o; i++)				//	head
+		a |= ((uint64_t) p[i]) << (s + 8 * i);
+	for (i = 1; i < nw; i++) {
+		b = q[i];
+		w[i - 1] = (a >> s) | (b << (64 - s));
+		a = b;
+	}
+	b = 0;
+	for (i = 0; i < o; i++)					//	tail
+		b |= ((uint64_t) p[8 * nw - o + i]) << (8 * i);
+	w[nw - 1] = (a >> s) | (b << (64 - s));
+}
+
+static inline void rvk_store64_ua(uint8_t * p, const uint64_t * w, size_t nw)
+{
+	uint64_t *q;
+	size_t i, o, s;
+
+	o = ((uintptr_t) p) & 7;
+	if (o == 0) {
+		for (i = 0; i < nw; i++)
+			((uint64_t *) p)[i] = w[i];
+		return;
+	}
+	s = 8 * o;
+	q = (uint64_t *) (p - o);				//	aligned base
+
+	for (i = 0; i < 8 - o; i++)				//	head
+		p[i] = (uint8_t) (w[0] >> (8 * i));
+	for (i = 1; i < nw; i++)
+		q[i] = (w[i - 1] >> (64 - s)) | (w[i] << s);
+	for (i = 0; i < o; i++)					//	tail
+		p[8 * nw - o + i] = (uint8_t) (w[nw - 1] >> (64 - s + 8 * i));
+}
+
+//	get / put a 16-byte block as two 64-bit words; direct if aligned
+
+#define RVK_GET64X2(t0, t1, p) {				\
+	if (RVK_IS_ALIGNED(p, 8)) {					\
+		t0 = ((const uint64_t *) (p))[0];		\
+		t1 = ((const uint64_t *) (p))[1];		\
+	} else {									\
+		uint64_t w_[2];							\
+		rvk_load64_ua(w_, p, 2);				\
+		t0 = w_[0];								\
+		t1 = w_[1];								\
+	}	}
+
+#define RVK_PUT64X2(p, t0, t1) {				\
+	if (RVK_IS_ALIGNED(p, 8)) {					\
+		((uint64_t *) (p))[0] = t0;				\
+		((uint64_t *) (p))[1] = t1;				\
+	} else {									\
+		uint64_t w_[2];							\
+		w_[0] = t0;								\
+		w_[1] = t1;								\
+		rvk_store64_ua(p, w_, 2);				\
+	}	}
+
+#endif	//	_RVK_ALIGN_H_
@@ -0,0 +1,56 @@
+//	rvk_cycles.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Cycle counter for run-time tuning and timing tests. Only differences
+//	between two readings are meaningful. The RISC-V cycle CSR is read on
+//	bare metal only: under an operating system user-mode rdcycle may trap
+//	(Linux 6.6 and later by default), so hosted builds use the monotonic
+//	clock instead. RVK_CYCLES_UNIT names the unit of the readings.
+
+#ifndef _RVK_CYCLES_H_
+#define _RVK_CYCLES_H_
+
+#include <stdint.h>
+#include <time.h>
+
+#if defined(__riscv) && !defined(__unix__)
+#define RVK_CYCLES_RDCYCLE
+#define RVK_CYCLES_UNIT "cyc"
+#elif defined(__x86_64__) || defined(__i386__)
+#define RVK_CYCLES_UNIT "cyc"
+#elif defined(CLOCK_MONOTONIC)
+#define RVK_CYCLES_UNIT "ns"
+#else
+#define RVK_CYCLES_UNIT "clk"
+#endif
+
+static inline uint64_t rvk_cycles(void)
+{
+#if defined(RVK_CYCLES_RDCYCLE) && (__riscv_xlen == 64)
+	uint64_t c;
+
+	__asm__ __volatile__ ("rdcycle %0" : "=r"(c));
+	return c;
+#elif defined(RVK_CYCLES_RDCYCLE)
+	uint32_t hi, lo, hi2;
+
+	do {									//	carry between the halves
+		__asm__ __volatile__ ("rdcycleh %0" : "=r"(hi));
+		__asm__ __volatile__ ("rdcycle %0" : "=r"(lo));
+		__asm__ __volatile__ ("rdcycleh %0" : "=r"(hi2));
+	} while (hi != hi2);
+	return (((uint64_t) hi) << 32) | lo;
+#elif defined(__x86_64__) || defined(__i386__)
+	return __builtin_ia32_rdtsc();
+#elif defined(CLOCK_MONOTONIC)
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t) ts.tv_sec) * 1000000000 + ts.tv_nsec;
+#else
+	return (uint64_t) clock();				//	coarse fallback
+#endif
+}
+
+#endif	//	_RVK_CYCLES_H_
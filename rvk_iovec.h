@@ -0,0 +1,22 @@
+//	rvk_iovec.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	struct iovec for the scatter-gather (*_v) interfaces: the system one
+//	where there is <sys/uio.h>, otherwise a compatible definition.
+
+#ifndef _RVK_IOVEC_H_
+#define _RVK_IOVEC_H_
+
+#include <stddef.h>
+
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(RVK_NO_SYS_UIO)
+#include <sys/uio.h>
+#else
+struct iovec {
+	void *iov_base;
+	size_t iov_len;
+};
+#endif
+
+#endif	//	_RVK_IOVEC_H_
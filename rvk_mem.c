@@ -0,0 +1,48 @@
+//	rvk_mem.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Constant-time comparison and secure zeroization helpers.
+
+#include <stdint.h>
+#include <string.h>
+#include "rvk_mem.h"
+
+//	constant-time equality; word-sized loads, no early exit
+
+int rvk_memeq_ct(const void *a, const void *b, size_t len)
+{
+	const uint8_t *x = (const uint8_t *) a;
+	const uint8_t *y = (const uint8_t *) b;
+	uint64_t d, u, v;
+	size_t i;
+
+	d = 0;
+	for (i = 0; i + 8 <= len; i += 8) {		//	full words
+		memcpy(&u, x + i, 8);
+		memcpy(&v, y + i, 8);
+		d |= u ^ v;
+	}
+	for (; i < len; i++) {					//	tail
+		d |= x[i] ^ y[i];
+	}
+
+	return (int) (1 ^ ((d | (0 - d)) >> 63));
+}
+
+//	zeroization. With GCC/Clang memset() does the clearing word-wise and
+//	the empty asm statement, which may read all of memory via "p", keeps
+//	it from being removed as a dead store.
+
+void rvk_memzero(void *p, size_t len)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	memset(p, 0x00, len);
+	__asm__ __volatile__ ("" : : "r"(p) : "memory");
+#else
+	volatile uint8_t *v = (volatile uint8_t *) p;
+
+	while (len--)
+		*v++ = 0;
+#endif
+}
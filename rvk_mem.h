@@ -0,0 +1,27 @@
+//	rvk_mem.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Constant-time comparison and secure zeroization helpers.
+
+#ifndef _RVK_MEM_H_
+#define _RVK_MEM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+//	1 if the "len" bytes at "a" and "b" are equal, 0 otherwise. The time
+//	depends on "len" only; the comparison is done a word at a time.
+int rvk_memeq_ct(const void *a, const void *b, size_t len);
+
+//	clear "len" bytes at "p" in a way that cannot be optimized away
+void rvk_memzero(void *p, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	//	_RVK_MEM_H_
@@ -0,0 +1,98 @@
+//	rvk_slab.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Slab allocator for cache line aligned key objects.
+
+#include <string.h>
+#include "rvk_slab.h"
+#include "rvk_mem.h"
+
+//	free objects hold the free list link followed by this word
+#define RVK_SLAB_MAGIC 0x5AB1F4EE0BADC0DE
+
+//	is "p" (which carries the magic word) on the free list?
+
+static int rvk_slab_isfree(const rvk_slab_t *s, const void *p)
+{
+	void *q;
+
+	for (q = s->free; q != NULL; memcpy(&q, q, sizeof(void *))) {
+		if (q == p)
+			return 1;
+	}
+	return 0;
+}
+
+//	set up a slab on "mem"
+
+size_t rvk_slab_init(rvk_slab_t *s, void *mem, size_t len, size_t size)
+{
+	uintptr_t a;
+	size_t pad;
+
+	memset(s, 0, sizeof(rvk_slab_t));
+	if (mem == NULL || size == 0)
+		return 0;
+
+	a = (uintptr_t) mem;					//	align the first object
+	pad = (RVK_CACHE_LINE - (a % RVK_CACHE_LINE)) % RVK_CACHE_LINE;
+	if (len < pad)
+		return 0;
+
+	s->base = (uint8_t *) mem + pad;
+	s->osz = RVK_LINES(size);
+	s->cap = (len - pad) / s->osz;
+	s->top = 0;
+
+	return s->cap;
+}
+
+//	allocate a zeroed object: first from the free list, then fresh ones
+
+void *rvk_slab_alloc(rvk_slab_t *s)
+{
+	void *p;
+
+	if (s->free != NULL) {
+		p = s->free;
+		memcpy(&s->free, p, sizeof(void *));
+		memset(p, 0, sizeof(void *) + 8);	//	rest is already clear
+	} else if (s->top < s->cap) {
+		p = s->base + s->top * s->osz;
+		s->top++;
+		memset(p, 0, s->osz);
+	} else {
+		return NULL;
+	}
+	s->used++;
+
+	return p;
+}
+
+//	wipe and release an object. The free list is walked only when the
+//	object already carries the magic word, so a double free is caught
+//	without a bitmap and the common case stays O(1).
+
+int rvk_slab_free(rvk_slab_t *s, void *p)
+{
+	const uint64_t magic = RVK_SLAB_MAGIC;
+	size_t off;
+
+	if (p == NULL || (uint8_t *) p < s->base)
+		return -1;
+	off = (size_t) ((uint8_t *) p - s->base);
+	if (off % s->osz != 0 || off / s->osz >= s->top || s->used == 0)
+		return -1;
+	if (memcmp((uint8_t *) p + sizeof(void *), &magic, 8) == 0 &&
+		rvk_slab_isfree(s, p))				//	double free
+		return -1;
+
+	rvk_memzero(p, s->osz);				//	zeroize key material
+	memcpy(p, &s->free, sizeof(void *));	//	link to free list
+	memcpy((uint8_t *) p + sizeof(void *), &magic, 8);
+	s->free = p;
+	s->used--;
+
+	return 0;
+}
@@ -0,0 +1,50 @@
+//	rvk_slab.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Slab allocator for key objects on caller-supplied memory. Objects are
+//	cache line aligned and a whole number of lines long; they are returned
+//	zeroed and are wiped again on free. Allocation and free are O(1) and
+//	initialization does not touch the memory, so a slab can be large.
+//	Free objects carry a magic word, so a double free is detected.
+//	Not locked: use one slab per thread or serialize the calls.
+
+#ifndef _RVK_SLAB_H_
+#define _RVK_SLAB_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include "rvk_align.h"
+
+//	bytes of memory needed for n objects of "size" bytes (incl. alignment)
+#define RVK_SLAB_BYTES(n, size) \
+	((n) * RVK_LINES(size) + RVK_CACHE_LINE - 1)
+
+typedef struct {
+	uint8_t *base;							//	first object (aligned)
+	size_t osz;								//	object size, whole lines
+	size_t cap;								//	number of objects
+	size_t top;								//	objects never handed out
+	size_t used;							//	objects currently allocated
+	void *free;								//	free list
+} rvk_slab_t;
+
+//	set up a slab on "mem"; returns the number of objects (0 on error)
+size_t rvk_slab_init(rvk_slab_t *s, void *mem, size_t len, size_t size);
+
+//	allocate a zeroed object; NULL if the slab is full
+void *rvk_slab_alloc(rvk_slab_t *s);
+
+//	wipe and release an object; nonzero if "p" is not an allocated object
+//	of "s" (including a second free of the same object)
+int rvk_slab_free(rvk_slab_t *s, void *p);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	//	_RVK_SLAB_H_
@@ -7,6 +7,7 @@
 
 #include "sha2_api.h"
 #include "rv_endian.h"
+#include "rvk_mem.h"
 #include "test_rvkat.h"
 
 #include <string.h>
@@ -22,6 +23,25 @@ static void sha2_compress_undef(void *s)
 void (*sha256_compress)(void *s) = &sha2_compress_undef;
 void (*sha512_compress)(void *s) = &sha2_compress_undef;
 
+static void sha2_schedule_undef(uint32_t wk[64], const uint8_t m[64])
+{
+	(void) wk;
+	(void) m;
+	rvkat_info("undefined pointer: sha2_schedule_undef()");
+}
+
+static void sha2_compress_wk_undef(void *s, const uint32_t wk[64])
+{
+	(void) s;
+	(void) wk;
+	rvkat_info("undefined pointer: sha2_compress_wk_undef()");
+}
+
+void (*sha256_schedule)(uint32_t wk[64], const uint8_t m[64]) =
+	&sha2_schedule_undef;
+void (*sha256_compress_wk)(void *s, const uint32_t wk[64]) =
+	&sha2_compress_wk_undef;
+
 //	SHA-224 initial values H0, Sect 5.3.2.
 
 static const uint32_t sha2_224_h0[8] = {
@@ -54,47 +74,25 @@ static const uint64_t sha2_512_h0[8] = {
 	0x1F83D9ABFB41BD6BULL, 0x5BE0CD19137E2179LL
 };
 
-//	=== incremental interface (internal here) ===
-
-typedef struct {
-	uint32_t s[8 + 24];
-	size_t i, len;
-} sha256_t;
-
-typedef struct {
-	uint64_t s[8 + 24];
-	size_t i, len;
-} sha512_t;
-
-typedef sha256_t sha224_t;
-typedef sha512_t sha384_t;
-
-//	shaNNN_init(ctx): Initialize context for hashing.
-static inline void sha256_init_h0(sha256_t *sha, const uint32_t h0[8]);
-#define sha256_init(sha) sha256_init_h0(sha, sha2_256_h0)
-#define sha224_init(sha) sha256_init_h0(sha, sha2_224_h0)
-static inline void sha512_init_h0(sha512_t *sha, const uint64_t h0[8]);
-#define sha512_init(sha) sha512_init_h0(sha, sha2_512_h0)
-#define sha384_init(sha) sha512_init_h0(sha, sha2_384_h0)
+//	SHA-512/224 initial values H0, Sect 5.3.6.1.
 
-//	shaNNN_update(ctx, m, mlen): Include "m" of "mlen" bytes in hash.
-static inline void sha256_update(sha256_t *sha, const uint8_t *m, size_t mlen);
-#define sha224_update(sha, m, mlen) sha256_update(sha, m, mlen)
-static inline void sha512_update(sha512_t *sha, const uint8_t *m, size_t mlen);
-#define sha384_update(sha, m, mlen) sha512_update(sha, m, mlen)
+static const uint64_t sha2_512_224_h0[8] = {
+	0x8C3D37C819544DA2ULL, 0x73E1996689DCD4D6ULL, 0x1DFAB7AE32FF9C82ULL,
+	0x679DD514582F9FCFULL, 0x0F6D2B697BD44DA8ULL, 0x77E36F7304C48942ULL,
+	0x3F9D85A86A1D36C8ULL, 0x1112E6AD91D692A1ULL
+};
 
-//	shaNNN_final(ctx, h): Finalize hash to "h", and clear the state.
-static inline void sha256_final_len(sha256_t *sha, uint8_t *h, size_t hlen);
-#define sha256_final(sha, h) sha256_final_len(sha, h, 32)
-#define sha224_final(sha, h) sha256_final_len(sha, h, 28)
-static inline void sha512_final_len(sha512_t *sha, uint8_t *h, size_t hlen);
-#define sha512_final(sha, h) sha512_final_len(sha, h, 64)
-#define sha384_final(sha, h) sha512_final_len(sha, h, 48)
+//	SHA-512/256 initial values H0, Sect 5.3.6.2.
 
+static const uint64_t sha2_512_256_h0[8] = {
+	0x22312194FC2BF72CULL, 0x9F555FA3C84C64C2ULL, 0x2393B86B6F53B151ULL,
+	0x963877195940EABDULL, 0x96283EE2A88EFFE3ULL, 0xBE5E1E2553863992ULL,
+	0x2B0199FC2C85B8AAULL, 0x0EB72DDC81C52CA2ULL
+};
 
-//	SHA2-256 initialize
+//	SHA2-224/256 initialize
 
-void sha256_init_h0(sha256_t *sha, const uint32_t h0[8])
+static void sha256_init_h0(sha256_t *sha, const uint32_t h0[8])
 {
 	size_t i;
 
@@ -104,6 +102,16 @@ void sha256_init_h0(sha256_t *sha, const uint32_t h0[8])
 	sha->len = 0;
 }
 
+void sha224_init(sha224_t *sha)
+{
+	sha256_init_h0(sha, sha2_224_h0);
+}
+
+void sha256_init(sha256_t *sha)
+{
+	sha256_init_h0(sha, sha2_256_h0);
+}
+
 //	SHA2-256 process input
 
 void sha256_update(sha256_t *sha, const uint8_t *m, size_t mlen)
@@ -111,6 +119,8 @@ void sha256_update(sha256_t *sha, const uint8_t *m, size_t mlen)
 	size_t l;
 	uint8_t *mp = (uint8_t *)&sha->s[8];
 
+	if (mlen == 0)
+		return;
 	sha->len += mlen;
 	l = 64 - sha->i;
 
@@ -162,7 +172,7 @@ void sha256_final_len(sha256_t *sha, uint8_t *h, size_t hlen)
 	for (i = 0; i < hlen; i += 4)  //  store big endian output
 		put32u_be(&h[i], sha->s[i / 4]);
 
-	memset(sha, 0x00, sizeof(sha256_t));  //	clear it
+	rvk_memzero(sha, sizeof(sha256_t));  //	clear it
 }
 
 //	SHA-224/256 public single-call interfaces
@@ -185,9 +195,38 @@ void sha2_256(uint8_t *h, const void *m, size_t mlen)
 	sha256_final(&sha, h);
 }
 
-//	SHA-512 initialize
+//	SHA2-256 of many 64-byte messages; the second block is always the
+//	padding 0x80, 0x00 .. 0x00, 0x0200 (512 bits) and its schedule is fixed
+
+void sha256_64B_batch(uint8_t *md, const uint8_t *m, size_t n)
+{
+	uint32_t wk[64];
+	uint8_t pad[64];
+	sha256_t sha;
+	size_t i, j;
+
+	memset(pad, 0x00, sizeof(pad));
+	pad[0] = 0x80;
+	pad[62] = 0x02;
+	sha256_schedule(wk, pad);
+
+	for (i = 0; i < n; i++) {
+		sha256_init(&sha);
+		memcpy(&sha.s[8], m, 64);
+		sha256_compress(sha.s);
+		sha256_compress_wk(sha.s, wk);
+		for (j = 0; j < 8; j++)
+			put32u_be(&md[4 * j], sha.s[j]);
+		m += 64;
+		md += 32;
+	}
+
+	rvk_memzero(&sha, sizeof(sha256_t));	//	clear it
+}
+
+//	SHA-384/512 initialize
 
-void sha512_init_h0(sha512_t *sha, const uint64_t h0[8])
+static void sha512_init_h0(sha512_t *sha, const uint64_t h0[8])
 {
 	size_t i;
 
@@ -197,6 +236,26 @@ void sha512_init_h0(sha512_t *sha, const uint64_t h0[8])
 	sha->len = 0;
 }
 
+void sha384_init(sha384_t *sha)
+{
+	sha512_init_h0(sha, sha2_384_h0);
+}
+
+void sha512_init(sha512_t *sha)
+{
+	sha512_init_h0(sha, sha2_512_h0);
+}
+
+void sha512_224_init(sha512_224_t *sha)
+{
+	sha512_init_h0(sha, sha2_512_224_h0);
+}
+
+void sha512_256_init(sha512_256_t *sha)
+{
+	sha512_init_h0(sha, sha2_512_256_h0);
+}
+
 //	take message input
 
 void sha512_update(sha512_t *sha, const uint8_t *m, size_t mlen)
@@ -204,6 +263,8 @@ void sha512_update(sha512_t *sha, const uint8_t *m, size_t mlen)
 	size_t l;
 	uint8_t *mp = (uint8_t *)&sha->s[8];
 
+	if (mlen == 0)
+		return;
 	sha->len += mlen;
 	l = 128 - sha->i;
 
@@ -252,10 +313,12 @@ void sha512_final_len(sha512_t *sha, uint8_t *h, size_t hlen)
 	}
 	sha512_compress(sha->s);
 
-	for (i = 0; i < hlen; i += 8)  //  store big endian output
+	for (i = 0; i + 8 <= hlen; i += 8)	//  store big endian output
 		put64u_be(&h[i], sha->s[i / 8]);
+	for (; i < hlen; i++)				//	truncated (SHA-512/224)
+		h[i] = (uint8_t) (sha->s[i / 8] >> (56 - 8 * (i % 8)));
 
-	memset(sha, 0x00, sizeof(sha512_t));  //	clear it
+	rvk_memzero(sha, sizeof(sha512_t));  //	clear it
 }
 
 //	SHA-384/512 public single-call interfaces
@@ -277,3 +340,89 @@ void sha2_512(uint8_t *h, const void *m, size_t mlen)
 	sha512_update(&sha, m, mlen);
 	sha512_final(&sha, h);
 }
+
+void sha2_512_224(uint8_t *h, const void *m, size_t mlen)
+{
+	sha512_224_t sha;
+
+	sha512_224_init(&sha);
+	sha512_224_update(&sha, m, mlen);
+	sha512_224_final(&sha, h);
+}
+
+void sha2_512_256(uint8_t *h, const void *m, size_t mlen)
+{
+	sha512_256_t sha;
+
+	sha512_256_init(&sha);
+	sha512_256_update(&sha, m, mlen);
+	sha512_256_final(&sha, h);
+}
+
+//	scatter-gather single-call interfaces
+
+void sha2_224_v(uint8_t *h, const struct iovec *iov, size_t n)
+{
+	sha256_t sha;
+	size_t i;
+
+	sha224_init(&sha);
+	for (i = 0; i < n; i++)
+		sha224_update(&sha, iov[i].iov_base, iov[i].iov_len);
+	sha224_final(&sha, h);
+}
+
+void sha2_256_v(uint8_t *h, const struct iovec *iov, size_t n)
+{
+	sha256_t sha;
+	size_t i;
+
+	sha256_init(&sha);
+	for (i = 0; i < n; i++)
+		sha256_update(&sha, iov[i].iov_base, iov[i].iov_len);
+	sha256_final(&sha, h);
+}
+
+void sha2_384_v(uint8_t *h, const struct iovec *iov, size_t n)
+{
+	sha512_t sha;
+	size_t i;
+
+	sha384_init(&sha);
+	for (i = 0; i < n; i++)
+		sha384_update(&sha, iov[i].iov_base, iov[i].iov_len);
+	sha384_final(&sha, h);
+}
+
+void sha2_512_v(uint8_t *h, const struct iovec *iov, size_t n)
+{
+	sha512_t sha;
+	size_t i;
+
+	sha512_init(&sha);
+	for (i = 0; i < n; i++)
+		sha512_update(&sha, iov[i].iov_base, iov[i].iov_len);
+	sha512_final(&sha, h);
+}
+
+void sha2_512_224_v(uint8_t *h, const struct iovec *iov, size_t n)
+{
+	sha512_t sha;
+	size_t i;
+
+	sha512_224_init(&sha);
+	for (i = 0; i < n; i++)
+		sha512_224_update(&sha, iov[i].iov_base, iov[i].iov_len);
+	sha512_224_final(&sha, h);
+}
+
+void sha2_512_256_v(uint8_t *h, const struct iovec *iov, size_t n)
+{
+	sha512_t sha;
+	size_t i;
+
+	sha512_256_init(&sha);
+	for (i = 0; i < n; i++)
+		sha512_256_update(&sha, iov[i].iov_base, iov[i].iov_len);
+	sha512_256_final(&sha, h);
+}
@@ -13,6 +13,7 @@ extern "C" {
 
 #include <stdint.h>
 #include <stddef.h>
+#include "rvk_iovec.h"
 
 //	=== Single-call hash wrappers ===
 
@@ -28,13 +29,84 @@ void sha2_384(uint8_t *md, const void *m, size_t mlen);
 //	SHA2-512: Compute 64-byte hash to "md" from "in" which has "mlen" bytes.
 void sha2_512(uint8_t *md, const void *m, size_t mlen);
 
+//	SHA2-512/224: Compute 28-byte hash to "md" with the SHA-512 function.
+void sha2_512_224(uint8_t *md, const void *m, size_t mlen);
+
+//	SHA2-512/256: Compute 32-byte hash to "md" with the SHA-512 function.
+void sha2_512_256(uint8_t *md, const void *m, size_t mlen);
+
+//	Scatter-gather versions: hash the concatenation of "n" segments.
+void sha2_224_v(uint8_t *md, const struct iovec *iov, size_t n);
+void sha2_256_v(uint8_t *md, const struct iovec *iov, size_t n);
+void sha2_384_v(uint8_t *md, const struct iovec *iov, size_t n);
+void sha2_512_v(uint8_t *md, const struct iovec *iov, size_t n);
+void sha2_512_224_v(uint8_t *md, const struct iovec *iov, size_t n);
+void sha2_512_256_v(uint8_t *md, const struct iovec *iov, size_t n);
+
+//	=== Incremental interface ===
+
+typedef struct {
+	uint32_t s[8 + 24];
+	size_t i, len;
+} sha256_t;
+
+typedef struct {
+	uint64_t s[8 + 24];
+	size_t i, len;
+} sha512_t;
+
+typedef sha256_t sha224_t;
+typedef sha512_t sha384_t;
+typedef sha512_t sha512_224_t;
+typedef sha512_t sha512_256_t;
+
+//	shaNNN_init(ctx): Initialize context for hashing.
+void sha224_init(sha224_t *sha);
+void sha256_init(sha256_t *sha);
+void sha384_init(sha384_t *sha);
+void sha512_init(sha512_t *sha);
+void sha512_224_init(sha512_224_t *sha);
+void sha512_256_init(sha512_256_t *sha);
+
+//	shaNNN_update(ctx, m, mlen): Include "m" of "mlen" bytes in hash.
+void sha256_update(sha256_t *sha, const uint8_t *m, size_t mlen);
+#define sha224_update(sha, m, mlen) sha256_update(sha, m, mlen)
+void sha512_update(sha512_t *sha, const uint8_t *m, size_t mlen);
+#define sha384_update(sha, m, mlen) sha512_update(sha, m, mlen)
+#define sha512_224_update(sha, m, mlen) sha512_update(sha, m, mlen)
+#define sha512_256_update(sha, m, mlen) sha512_update(sha, m, mlen)
+
+//	shaNNN_final(ctx, h): Finalize hash to "h", and clear the state.
+void sha256_final_len(sha256_t *sha, uint8_t *h, size_t hlen);
+#define sha256_final(sha, h) sha256_final_len(sha, h, 32)
+#define sha224_final(sha, h) sha256_final_len(sha, h, 28)
+void sha512_final_len(sha512_t *sha, uint8_t *h, size_t hlen);
+#define sha512_final(sha, h) sha512_final_len(sha, h, 64)
+#define sha384_final(sha, h) sha512_final_len(sha, h, 48)
+#define sha512_224_final(sha, h) sha512_final_len(sha, h, 28)
+#define sha512_256_final(sha, h) sha512_final_len(sha, h, 32)
+
+//	=== Fixed-length batch interface ===
+
+//	SHA2-256 of "n" independent 64-byte messages (e.g. Merkle tree nodes)
+//	at "m"; the 32-byte hashes go to "md". The padding block is the same
+//	for all of them, so its message schedule is computed only once.
+void sha256_64B_batch(uint8_t *md, const uint8_t *m, size_t n);
+
 //	=== Compression Functions ===
 
 //	function pointer to the compression function used by the test wrappers
 extern void (*sha256_compress)(void *);
 extern void (*sha512_compress)(void *);
 
+//	compression with a precomputed message schedule wk[t] = W[t] + K[t] of
+//	a constant block; sha256_schedule() computes it.
+extern void (*sha256_schedule)(uint32_t wk[64], const uint8_t m[64]);
+extern void (*sha256_compress_wk)(void *s, const uint32_t wk[64]);
+
 void sha2_cf256_rvk(void *s);			//	SHA-224/256 CF for RV32 & RV64
+void sha2_wk256_rvk(uint32_t wk[64], const uint8_t m[64]);
+void sha2_cf256_wk_rvk(void *s, const uint32_t wk[64]);
 void sha2_cf512_rvk64(void *s);			//	SHA-384/512 CF for RV64
 void sha2_cf512_rvk32(void *s);			//	SHA-384/512 CF for RV32
 
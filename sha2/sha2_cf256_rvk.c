@@ -22,29 +22,29 @@
 	x0 = x0 + _rv_sha256sig0(x1);	\
 	x0 = x0 + _rv_sha256sig1(xe);	}
 
+//	4.2.2 SHA-224 and SHA-256 Constants
+
+static const uint32_t ck[64] = {
+	0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5,
+	0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+	0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3,
+	0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+	0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC,
+	0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+	0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7,
+	0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+	0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13,
+	0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+	0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3,
+	0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+	0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5,
+	0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+	0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208,
+	0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
 void sha2_cf256_rvk(void *s)
 {
-	//	4.2.2 SHA-224 and SHA-256 Constants
-
-	const uint32_t ck[64] = {
-		0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5,
-		0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
-		0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3,
-		0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
-		0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC,
-		0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
-		0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7,
-		0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
-		0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13,
-		0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
-		0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3,
-		0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
-		0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5,
-		0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
-		0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208,
-		0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
-	};
-
 	uint32_t a, b, c, d, e, f, g, h;
 	uint32_t m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, ma, mb, mc, md, me, mf;
 
@@ -130,3 +130,64 @@ void sha2_cf256_rvk(void *s)
 	sp[6] = sp[6] + g;
 	sp[7] = sp[7] + h;
 }
+
+//	Message schedule with the round constants added, wk[t] = W[t] + K[t],
+//	for a block "m" that is the same for many compressions
+
+void sha2_wk256_rvk(uint32_t wk[64], const uint8_t m[64])
+{
+	uint32_t w[64];
+	int i;
+
+	for (i = 0; i < 16; i++) {
+		w[i] = (((uint32_t) m[4 * i]) << 24) |
+			(((uint32_t) m[4 * i + 1]) << 16) |
+			(((uint32_t) m[4 * i + 2]) << 8) | ((uint32_t) m[4 * i + 3]);
+	}
+	for (i = 16; i < 64; i++) {
+		w[i] = w[i - 16] + _rv_sha256sig0(w[i - 15]) + w[i - 7] +
+			_rv_sha256sig1(w[i - 2]);
+	}
+	for (i = 0; i < 64; i++)
+		wk[i] = w[i] + ck[i];
+}
+
+//	Compression with a precomputed schedule "wk"; no message expansion.
+//	Only the chaining value s[0..7] is used.
+
+void sha2_cf256_wk_rvk(void *s, const uint32_t wk[64])
+{
+	uint32_t a, b, c, d, e, f, g, h;
+	uint32_t *sp = s;
+	const uint32_t *kp = wk;
+
+	a = sp[0];
+	b = sp[1];
+	c = sp[2];
+	d = sp[3];
+	e = sp[4];
+	f = sp[5];
+	g = sp[6];
+	h = sp[7];
+
+	while (kp != &wk[64]) {
+		STEP_SHA256_R(a, b, c, d, e, f, g, h, kp[0], 0);	//	rounds
+		STEP_SHA256_R(h, a, b, c, d, e, f, g, kp[1], 0);
+		STEP_SHA256_R(g, h, a, b, c, d, e, f, kp[2], 0);
+		STEP_SHA256_R(f, g, h, a, b, c, d, e, kp[3], 0);
+		STEP_SHA256_R(e, f, g, h, a, b, c, d, kp[4], 0);
+		STEP_SHA256_R(d, e, f, g, h, a, b, c, kp[5], 0);
+		STEP_SHA256_R(c, d, e, f, g, h, a, b, kp[6], 0);
+		STEP_SHA256_R(b, c, d, e, f, g, h, a, kp[7], 0);
+		kp += 8;
+	}
+
+	sp[0] = sp[0] + a;
+	sp[1] = sp[1] + b;
+	sp[2] = sp[2] + c;
+	sp[3] = sp[3] + d;
+	sp[4] = sp[4] + e;
+	sp[5] = sp[5] + f;
+	sp[6] = sp[6] + g;
+	sp[7] = sp[7] + h;
+}
@@ -0,0 +1,404 @@
+//	sha2_hmac.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	HMAC and HKDF over SHA-2 with precomputed inner/outer pad states.
+
+#include "sha2_hmac.h"
+#include "rv_endian.h"
+#include "rvk_mem.h"
+
+#include <string.h>
+
+//	largest padded HKDF-Expand inner message handled with a fixed template
+
+#define HKDF256_TPL 256
+#define HKDF384_TPL 512
+
+//	=== HMAC-SHA256 ===
+
+void hmac_sha256_key(hmac_sha256_key_t *k, const uint8_t *key, size_t klen)
+{
+	sha256_t sha;
+	uint8_t kb[64];
+	size_t i;
+
+	memset(kb, 0x00, sizeof(kb));
+	if (klen > 64) {				//	long keys are hashed
+		sha2_256(kb, key, klen);
+	} else if (klen > 0) {
+		memcpy(kb, key, klen);
+	}
+
+	for (i = 0; i < 64; i++)
+		kb[i] ^= 0x36;
+	sha256_init(&sha);
+	sha256_update(&sha, kb, 64);
+	memcpy(k->si, sha.s, sizeof(k->si));
+
+	for (i = 0; i < 64; i++)
+		kb[i] ^= 0x36 ^ 0x5C;
+	sha256_init(&sha);
+	sha256_update(&sha, kb, 64);
+	memcpy(k->so, sha.s, sizeof(k->so));
+
+	rvk_memzero(kb, sizeof(kb));	//	clear it
+	rvk_memzero(&sha, sizeof(sha));
+}
+
+void hmac_sha256_init(hmac_sha256_t *ctx, const hmac_sha256_key_t *k)
+{
+	memcpy(ctx->sha.s, k->si, sizeof(k->si));
+	ctx->sha.i = 0;
+	ctx->sha.len = 64;				//	ipad block already processed
+	ctx->k = k;
+}
+
+void hmac_sha256_final(hmac_sha256_t *ctx, uint8_t mac[32])
+{
+	uint8_t h[32];
+
+	sha256_final(&ctx->sha, h);
+	memcpy(ctx->sha.s, ctx->k->so, sizeof(ctx->k->so));
+	ctx->sha.i = 0;
+	ctx->sha.len = 64;				//	opad block already processed
+	sha256_update(&ctx->sha, h, 32);
+	sha256_final(&ctx->sha, mac);
+
+	rvk_memzero(h, sizeof(h));
+}
+
+void hmac_sha256(uint8_t mac[32], const hmac_sha256_key_t *k,
+				 const void *m, size_t mlen)
+{
+	hmac_sha256_t ctx;
+
+	hmac_sha256_init(&ctx, k);
+	hmac_sha256_update(&ctx, m, mlen);
+	hmac_sha256_final(&ctx, mac);
+}
+
+//	=== HMAC-SHA384 and HMAC-SHA512 ===
+
+static void hmac_sha512_key_len(hmac_sha512_key_t *k,
+								const uint8_t *key, size_t klen, size_t hlen)
+{
+	sha512_t sha;
+	uint8_t kb[128];
+	size_t i;
+
+	memset(kb, 0x00, sizeof(kb));
+	if (klen > 128) {				//	long keys are hashed
+		if (hlen == 48) {
+			sha2_384(kb, key, klen);
+		} else {
+			sha2_512(kb, key, klen);
+		}
+	} else if (klen > 0) {
+		memcpy(kb, key, klen);
+	}
+
+	for (i = 0; i < 128; i++)
+		kb[i] ^= 0x36;
+	if (hlen == 48) {
+		sha384_init(&sha);
+	} else {
+		sha512_init(&sha);
+	}
+	sha512_update(&sha, kb, 128);
+	memcpy(k->si, sha.s, sizeof(k->si));
+
+	for (i = 0; i < 128; i++)
+		kb[i] ^= 0x36 ^ 0x5C;
+	if (hlen == 48) {
+		sha384_init(&sha);
+	} else {
+		sha512_init(&sha);
+	}
+	sha512_update(&sha, kb, 128);
+	memcpy(k->so, sha.s, sizeof(k->so));
+
+	rvk_memzero(kb, sizeof(kb));	//	clear it
+	rvk_memzero(&sha, sizeof(sha));
+}
+
+void hmac_sha384_key(hmac_sha384_key_t *k, const uint8_t *key, size_t klen)
+{
+	hmac_sha512_key_len(k, key, klen, 48);
+}
+
+void hmac_sha512_key(hmac_sha512_key_t *k, const uint8_t *key, size_t klen)
+{
+	hmac_sha512_key_len(k, key, klen, 64);
+}
+
+void hmac_sha512_init(hmac_sha512_t *ctx, const hmac_sha512_key_t *k)
+{
+	memcpy(ctx->sha.s, k->si, sizeof(k->si));
+	ctx->sha.i = 0;
+	ctx->sha.len = 128;				//	ipad block already processed
+	ctx->k = k;
+}
+
+static void hmac_sha512_final_len(hmac_sha512_t *ctx,
+								  uint8_t *mac, size_t hlen)
+{
+	uint8_t h[64];
+
+	sha512_final_len(&ctx->sha, h, hlen);
+	memcpy(ctx->sha.s, ctx->k->so, sizeof(ctx->k->so));
+	ctx->sha.i = 0;
+	ctx->sha.len = 128;				//	opad block already processed
+	sha512_update(&ctx->sha, h, hlen);
+	sha512_final_len(&ctx->sha, mac, hlen);
+
+	rvk_memzero(h, sizeof(h));
+}
+
+void hmac_sha384_final(hmac_sha384_t *ctx, uint8_t mac[48])
+{
+	hmac_sha512_final_len(ctx, mac, 48);
+}
+
+void hmac_sha512_final(hmac_sha512_t *ctx, uint8_t mac[64])
+{
+	hmac_sha512_final_len(ctx, mac, 64);
+}
+
+void hmac_sha384(uint8_t mac[48], const hmac_sha384_key_t *k,
+				 const void *m, size_t mlen)
+{
+	hmac_sha384_t ctx;
+
+	hmac_sha384_init(&ctx, k);
+	hmac_sha384_update(&ctx, m, mlen);
+	hmac_sha384_final(&ctx, mac);
+}
+
+void hmac_sha512(uint8_t mac[64], const hmac_sha512_key_t *k,
+				 const void *m, size_t mlen)
+{
+	hmac_sha512_t ctx;
+
+	hmac_sha512_init(&ctx, k);
+	hmac_sha512_update(&ctx, m, mlen);
+	hmac_sha512_final(&ctx, mac);
+}
+
+//	=== HKDF-SHA256 ===
+
+void hkdf_sha256_extract(uint8_t prk[32], const uint8_t *salt, size_t slen,
+						 const uint8_t *ikm, size_t ikmlen)
+{
+	hmac_sha256_key_t k;
+
+	hmac_sha256_key(&k, salt, slen);	//	empty salt == zero salt
+	hmac_sha256(prk, &k, ikm, ikmlen);
+	rvk_memzero(&k, sizeof(k));
+}
+
+//	T(1) goes through the incremental interface. After that the inner
+//	message T(i-1) | info | i always has the same padded layout, so it is
+//	built once and only T and i are patched; each further output block
+//	is then just the inner blocks plus one outer block, straight through
+//	the compression function.
+
+int hkdf_sha256_expand(uint8_t *okm, size_t olen,
+					   const hmac_sha256_key_t *prk,
+					   const uint8_t *info, size_t infolen)
+{
+	hmac_sha256_t ctx;
+	sha256_t sha;
+	uint8_t t[32], c, tpl[HKDF256_TPL], opad[64];
+	uint8_t *mp = (uint8_t *)&sha.s[8];
+	size_t i, l, ml, nb;
+
+	if (olen > 255 * 32)
+		return -1;
+
+	c = 0;
+	l = 0;
+	ml = 32 + infolen + 1;					//	inner message length
+	nb = (ml + 9 + 63) / 64;				//	padded blocks
+
+	while (olen > 0) {
+
+		c++;
+		if (c == 1 || nb * 64 > HKDF256_TPL) {
+
+			hmac_sha256_init(&ctx, prk);	//	generic path
+			hmac_sha256_update(&ctx, t, l);
+			hmac_sha256_update(&ctx, info, infolen);
+			hmac_sha256_update(&ctx, &c, 1);
+			hmac_sha256_final(&ctx, t);
+			l = 32;
+
+			if (c == 1 && nb * 64 <= HKDF256_TPL) {
+				memset(tpl, 0x00, nb * 64);	//	set up the templates
+				if (infolen > 0)
+					memcpy(tpl + 32, info, infolen);
+				tpl[ml] = 0x80;
+				put64u_be(tpl + nb * 64 - 8, (uint64_t) (64 + ml) << 3);
+				memset(opad, 0x00, sizeof(opad));
+				opad[32] = 0x80;
+				put64u_be(opad + 56, (64 + 32) << 3);
+			}
+
+		} else {
+
+			memcpy(tpl, t, 32);				//	patch T(i-1) and i
+			tpl[ml - 1] = c;
+
+			memcpy(sha.s, prk->si, 32);		//	inner hash
+			for (i = 0; i < nb; i++) {
+				memcpy(mp, tpl + 64 * i, 64);
+				sha256_compress(sha.s);
+			}
+			for (i = 0; i < 8; i++)
+				put32u_be(opad + 4 * i, sha.s[i]);
+
+			memcpy(sha.s, prk->so, 32);		//	outer hash
+			memcpy(mp, opad, 64);
+			sha256_compress(sha.s);
+			for (i = 0; i < 8; i++)
+				put32u_be(t + 4 * i, sha.s[i]);
+		}
+
+		i = olen < 32 ? olen : 32;
+		memcpy(okm, t, i);
+		okm += i;
+		olen -= i;
+	}
+
+	rvk_memzero(t, sizeof(t));				//	clear it
+	rvk_memzero(tpl, sizeof(tpl));
+	rvk_memzero(opad, sizeof(opad));
+	rvk_memzero(&sha, sizeof(sha));
+
+	return 0;
+}
+
+int hkdf_sha256(uint8_t *okm, size_t olen,
+				const uint8_t *salt, size_t slen,
+				const uint8_t *ikm, size_t ikmlen,
+				const uint8_t *info, size_t infolen)
+{
+	hmac_sha256_key_t k;
+	uint8_t prk[32];
+	int r;
+
+	hkdf_sha256_extract(prk, salt, slen, ikm, ikmlen);
+	hmac_sha256_key(&k, prk, 32);
+	r = hkdf_sha256_expand(okm, olen, &k, info, infolen);
+	rvk_memzero(prk, sizeof(prk));
+	rvk_memzero(&k, sizeof(k));
+
+	return r;
+}
+
+//	=== HKDF-SHA384 ===
+
+void hkdf_sha384_extract(uint8_t prk[48], const uint8_t *salt, size_t slen,
+						 const uint8_t *ikm, size_t ikmlen)
+{
+	hmac_sha384_key_t k;
+
+	hmac_sha384_key(&k, salt, slen);
+	hmac_sha384(prk, &k, ikm, ikmlen);
+	rvk_memzero(&k, sizeof(k));
+}
+
+//	same structure as hkdf_sha256_expand()
+
+int hkdf_sha384_expand(uint8_t *okm, size_t olen,
+					   const hmac_sha384_key_t *prk,
+					   const uint8_t *info, size_t infolen)
+{
+	hmac_sha384_t ctx;
+	sha512_t sha;
+	uint8_t t[48], c, tpl[HKDF384_TPL], opad[128];
+	uint8_t *mp = (uint8_t *)&sha.s[8];
+	size_t i, l, ml, nb;
+
+	if (olen > 255 * 48)
+		return -1;
+
+	c = 0;
+	l = 0;
+	ml = 48 + infolen + 1;					//	inner message length
+	nb = (ml + 17 + 127) / 128;				//	padded blocks
+
+	while (olen > 0) {
+
+		c++;
+		if (c == 1 || nb * 128 > HKDF384_TPL) {
+
+			hmac_sha384_init(&ctx, prk);	//	generic path
+			hmac_sha384_update(&ctx, t, l);
+			hmac_sha384_update(&ctx, info, infolen);
+			hmac_sha384_update(&ctx, &c, 1);
+			hmac_sha384_final(&ctx, t);
+			l = 48;
+
+			if (c == 1 && nb * 128 <= HKDF384_TPL) {
+				memset(tpl, 0x00, nb * 128);	//	set up the templates
+				if (infolen > 0)
+					memcpy(tpl + 48, info, infolen);
+				tpl[ml] = 0x80;
+				put64u_be(tpl + nb * 128 - 8, (uint64_t) (128 + ml) << 3);
+				memset(opad, 0x00, sizeof(opad));
+				opad[48] = 0x80;
+				put64u_be(opad + 120, (128 + 48) << 3);
+			}
+
+		} else {
+
+			memcpy(tpl, t, 48);				//	patch T(i-1) and i
+			tpl[ml - 1] = c;
+
+			memcpy(sha.s, prk->si, 64);		//	inner hash
+			for (i = 0; i < nb; i++) {
+				memcpy(mp, tpl + 128 * i, 128);
+				sha512_compress(sha.s);
+			}
+			for (i = 0; i < 6; i++)
+				put64u_be(opad + 8 * i, sha.s[i]);
+
+			memcpy(sha.s, prk->so, 64);		//	outer hash
+			memcpy(mp, opad, 128);
+			sha512_compress(sha.s);
+			for (i = 0; i < 6; i++)
+				put64u_be(t + 8 * i, sha.s[i]);
+		}
+
+		i = olen < 48 ? olen : 48;
+		memcpy(okm, t, i);
+		okm += i;
+		olen -= i;
+	}
+
+	rvk_memzero(t, sizeof(t));				//	clear it
+	rvk_memzero(tpl, sizeof(tpl));
+	rvk_memzero(opad, sizeof(opad));
+	rvk_memzero(&sha, sizeof(sha));
+
+	return 0;
+}
+
+int hkdf_sha384(uint8_t *okm, size_t olen,
+				const uint8_t *salt, size_t slen,
+				const uint8_t *ikm, size_t ikmlen,
+				const uint8_t *info, size_t infolen)
+{
+	hmac_sha384_key_t k;
+	uint8_t prk[48];
+	int r;
+
+	hkdf_sha384_extract(prk, salt, slen, ikm, ikmlen);
+	hmac_sha384_key(&k, prk, 48);
+	r = hkdf_sha384_expand(okm, olen, &k, info, infolen);
+	rvk_memzero(prk, sizeof(prk));
+	rvk_memzero(&k, sizeof(k));
+
+	return r;
+}
@@ -0,0 +1,107 @@
+//	sha2_hmac.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	FIPS 198-1 HMAC and RFC 5869 HKDF over SHA-2. A key object holds the
+//	chaining values after the ipad and opad blocks, so a MAC under an
+//	existing key costs two compression function calls less.
+
+#ifndef _SHA2_HMAC_H_
+#define _SHA2_HMAC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sha2_api.h"
+
+//	=== Key objects (post-ipad and post-opad states) ===
+
+typedef struct {
+	uint32_t si[8], so[8];
+} hmac_sha256_key_t;
+
+typedef struct {
+	uint64_t si[8], so[8];
+} hmac_sha512_key_t;
+
+typedef hmac_sha512_key_t hmac_sha384_key_t;
+
+//	hmac_shaNNN_key(k, key, klen): Set up key object "k" from "key".
+void hmac_sha256_key(hmac_sha256_key_t *k, const uint8_t *key, size_t klen);
+void hmac_sha384_key(hmac_sha384_key_t *k, const uint8_t *key, size_t klen);
+void hmac_sha512_key(hmac_sha512_key_t *k, const uint8_t *key, size_t klen);
+
+//	=== Single-call MAC with a key object ===
+
+void hmac_sha256(uint8_t mac[32], const hmac_sha256_key_t *k,
+				 const void *m, size_t mlen);
+void hmac_sha384(uint8_t mac[48], const hmac_sha384_key_t *k,
+				 const void *m, size_t mlen);
+void hmac_sha512(uint8_t mac[64], const hmac_sha512_key_t *k,
+				 const void *m, size_t mlen);
+
+//	=== Incremental interface ===
+
+typedef struct {
+	sha256_t sha;
+	const hmac_sha256_key_t *k;
+} hmac_sha256_t;
+
+typedef struct {
+	sha512_t sha;
+	const hmac_sha512_key_t *k;
+} hmac_sha512_t;
+
+typedef hmac_sha512_t hmac_sha384_t;
+
+//	hmac_shaNNN_init(ctx, k): Start a MAC; "k" must stay valid until final.
+void hmac_sha256_init(hmac_sha256_t *ctx, const hmac_sha256_key_t *k);
+void hmac_sha512_init(hmac_sha512_t *ctx, const hmac_sha512_key_t *k);
+#define hmac_sha384_init(ctx, k) hmac_sha512_init(ctx, k)
+
+//	hmac_shaNNN_update(ctx, m, mlen): Include "m" of "mlen" bytes.
+#define hmac_sha256_update(ctx, m, mlen) sha256_update(&(ctx)->sha, m, mlen)
+#define hmac_sha384_update(ctx, m, mlen) sha512_update(&(ctx)->sha, m, mlen)
+#define hmac_sha512_update(ctx, m, mlen) sha512_update(&(ctx)->sha, m, mlen)
+
+//	hmac_shaNNN_final(ctx, mac): Finalize MAC to "mac", and clear the state.
+void hmac_sha256_final(hmac_sha256_t *ctx, uint8_t mac[32]);
+void hmac_sha384_final(hmac_sha384_t *ctx, uint8_t mac[48]);
+void hmac_sha512_final(hmac_sha512_t *ctx, uint8_t mac[64]);
+
+//	=== HKDF (RFC 5869) ===
+
+//	HKDF-Extract: pseudorandom key "prk" from "salt" and "ikm".
+void hkdf_sha256_extract(uint8_t prk[32], const uint8_t *salt, size_t slen,
+						 const uint8_t *ikm, size_t ikmlen);
+void hkdf_sha384_extract(uint8_t prk[48], const uint8_t *salt, size_t slen,
+						 const uint8_t *ikm, size_t ikmlen);
+
+//	HKDF-Expand: "olen" bytes to "okm" from a PRK key object (set up with
+//	hmac_shaNNN_key) and "info". All output blocks are generated in one
+//	call. Returns nonzero if "olen" exceeds 255 hash lengths.
+int hkdf_sha256_expand(uint8_t *okm, size_t olen,
+					   const hmac_sha256_key_t *prk,
+					   const uint8_t *info, size_t infolen);
+int hkdf_sha384_expand(uint8_t *okm, size_t olen,
+					   const hmac_sha384_key_t *prk,
+					   const uint8_t *info, size_t infolen);
+
+//	Extract-then-Expand in a single call.
+int hkdf_sha256(uint8_t *okm, size_t olen,
+				const uint8_t *salt, size_t slen,
+				const uint8_t *ikm, size_t ikmlen,
+				const uint8_t *info, size_t infolen);
+int hkdf_sha384(uint8_t *okm, size_t olen,
+				const uint8_t *salt, size_t slen,
+				const uint8_t *ikm, size_t ikmlen,
+				const uint8_t *info, size_t infolen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	//	_SHA2_HMAC_H_
@@ -0,0 +1,240 @@
+//	kangaroo12.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	RFC 9861: TurboSHAKE128 and KangarooTwelve (KT128).
+
+#include <string.h>
+
+#include "kangaroo12.h"
+#include "rv_endian.h"
+#include "rvk_mem.h"
+
+//	number of KT128 leaves permuted together
+
+#define KT128_PAR 4
+
+//	TurboSHAKE128 rate in bytes
+
+#define KT128_RATE 168
+
+//	=== TurboSHAKE128 sponge (as sha3_update etc. with 12 rounds) ===
+
+static void ts_update(sha3_ctx_t *c, const void *data, size_t len)
+{
+	size_t i;
+	int j;
+
+	j = c->pt;
+	for (i = 0; i < len; i++) {
+		c->st.b[j++] ^= ((const uint8_t *) data)[i];
+		if (j >= c->rsiz) {
+			sha3_keccakp12(c->st.d);
+			j = 0;
+		}
+	}
+	c->pt = j;
+}
+
+//	padding with domain separation byte "d"
+
+static void ts_xof(sha3_ctx_t *c, uint8_t d)
+{
+	c->st.b[c->pt] ^= d;
+	c->st.b[c->rsiz - 1] ^= 0x80;
+	sha3_keccakp12(c->st.d);
+	c->pt = 0;
+}
+
+static void ts_out(uint8_t *out, size_t len, sha3_ctx_t *c)
+{
+	size_t i;
+	int j;
+
+	j = c->pt;
+	for (i = 0; i < len; i++) {
+		if (j >= c->rsiz) {
+			sha3_keccakp12(c->st.d);
+			j = 0;
+		}
+		out[i] = c->st.b[j++];
+	}
+	c->pt = j;
+}
+
+void turboshake128(uint8_t *out, size_t olen, const void *in, size_t inlen,
+				   uint8_t d)
+{
+	sha3_ctx_t c;
+
+	sha3_init(&c, 16);
+	ts_update(&c, in, inlen);
+	ts_xof(&c, d);
+	ts_out(out, olen, &c);
+	rvk_memzero(&c, sizeof(c));
+}
+
+//	=== KangarooTwelve ===
+
+//	length_encode(x): big-endian bytes without leading zeros, then their
+//	number; length_encode(0) is a single zero byte
+
+static size_t kt128_length_encode(uint8_t b[9], uint64_t x)
+{
+	size_t i, n;
+
+	for (n = 0; n < 8 && (x >> (8 * n)) != 0; n++)
+		;
+	for (i = 0; i < n; i++)
+		b[n - 1 - i] = x >> (8 * i);
+	b[n] = n;
+
+	return n + 1;
+}
+
+//	permute "j" <= KT128_PAR states; a full group goes to sha3_keccakp12x4
+
+static void kt128_permute(uint64_t st[KT128_PAR][25], size_t j)
+{
+	size_t i;
+
+	if (j == KT128_PAR) {
+		sha3_keccakp12x4(st);
+	} else {
+		for (i = 0; i < j; i++)
+			sha3_keccakp12(st[i]);
+	}
+}
+
+//	chaining values TurboSHAKE128(S_i, 0x0B, 32) of "n" <= KT128_PAR
+//	consecutive full leaves at "m", in lockstep; absorbed into "fin"
+
+static void kt128_leaves(kt128_ctx_t *c, const uint8_t *m, size_t n)
+{
+	uint64_t st[KT128_PAR][25];
+	uint8_t cv[32];
+	const uint8_t *p;
+	size_t k, w, off;
+
+	memset(st, 0x00, sizeof(st));
+
+	for (off = 0; off + KT128_RATE <= KT128_CHUNK; off += KT128_RATE) {
+		for (k = 0; k < n; k++) {			//	full rate blocks
+			p = m + k * KT128_CHUNK + off;
+			for (w = 0; w < KT128_RATE / 8; w++)
+				st[k][w] ^= get64u_le(p + 8 * w);
+		}
+		kt128_permute(st, n);
+	}
+
+	for (k = 0; k < n; k++) {				//	last 128 bytes and padding
+		p = m + k * KT128_CHUNK + off;
+		for (w = 0; w < (KT128_CHUNK - off) / 8; w++)
+			st[k][w] ^= get64u_le(p + 8 * w);
+		st[k][w] ^= 0x0B;
+		st[k][KT128_RATE / 8 - 1] ^= 0x8000000000000000ULL;
+	}
+	kt128_permute(st, n);
+
+	for (k = 0; k < n; k++) {
+		for (w = 0; w < 4; w++)
+			put64u_le(cv + 8 * w, st[k][w]);
+		ts_update(&c->fin, cv, 32);
+	}
+	c->nl += n;
+
+	rvk_memzero(st, sizeof(st));
+}
+
+//	finish the partial leaf in c->leaf
+
+static void kt128_leaf_end(kt128_ctx_t *c)
+{
+	uint8_t cv[32];
+
+	ts_xof(&c->leaf, 0x0B);
+	ts_out(cv, 32, &c->leaf);
+	ts_update(&c->fin, cv, 32);
+	c->nl++;
+}
+
+void kt128_init(kt128_ctx_t *c)
+{
+	sha3_init(&c->fin, 16);
+	sha3_init(&c->leaf, 16);
+	c->pos = 0;
+	c->nl = 0;
+}
+
+void kt128_update(kt128_ctx_t *c, const void *in, size_t inlen)
+{
+	const uint8_t mark[8] = { 0x03, 0, 0, 0, 0, 0, 0, 0 };
+	const uint8_t *p = (const uint8_t *) in;
+	size_t l, off;
+
+	while (inlen > 0) {
+
+		if (c->pos < KT128_CHUNK) {			//	S_0 goes to the final node
+			l = KT128_CHUNK - c->pos;
+			if (l > inlen)
+				l = inlen;
+			ts_update(&c->fin, p, l);
+		} else {
+			if (c->pos == KT128_CHUNK)		//	first leaf begins
+				ts_update(&c->fin, mark, sizeof(mark));
+			off = (c->pos - KT128_CHUNK) % KT128_CHUNK;
+			if (off == 0 && inlen >= KT128_CHUNK) {
+				l = inlen / KT128_CHUNK;	//	full leaves from input
+				if (l > KT128_PAR)
+					l = KT128_PAR;
+				kt128_leaves(c, p, l);
+				l *= KT128_CHUNK;
+			} else {
+				if (off == 0)
+					sha3_init(&c->leaf, 16);
+				l = KT128_CHUNK - off;
+				if (l > inlen)
+					l = inlen;
+				ts_update(&c->leaf, p, l);
+				if (off + l == KT128_CHUNK)
+					kt128_leaf_end(c);
+			}
+		}
+		c->pos += l;
+		p += l;
+		inlen -= l;
+	}
+}
+
+void kt128_final(uint8_t *out, size_t olen, kt128_ctx_t *c,
+				 const uint8_t *cs, size_t clen)
+{
+	const uint8_t ff[2] = { 0xFF, 0xFF };
+	uint8_t b[9];
+
+	kt128_update(c, cs, clen);
+	kt128_update(c, b, kt128_length_encode(b, clen));
+
+	if (c->pos <= KT128_CHUNK) {			//	single node
+		ts_xof(&c->fin, 0x07);
+	} else {
+		if ((c->pos - KT128_CHUNK) % KT128_CHUNK != 0)
+			kt128_leaf_end(c);
+		ts_update(&c->fin, b, kt128_length_encode(b, c->nl));
+		ts_update(&c->fin, ff, sizeof(ff));
+		ts_xof(&c->fin, 0x06);
+	}
+	ts_out(out, olen, &c->fin);
+
+	rvk_memzero(c, sizeof(kt128_ctx_t));	//	clear it
+}
+
+void kt128(uint8_t *out, size_t olen, const void *in, size_t inlen,
+		   const uint8_t *cs, size_t clen)
+{
+	kt128_ctx_t c;
+
+	kt128_init(&c);
+	kt128_update(&c, in, inlen);
+	kt128_final(out, olen, &c, cs, clen);
+}
@@ -0,0 +1,53 @@
+//	kangaroo12.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	RFC 9861: TurboSHAKE128 and KangarooTwelve (KT128). Both use the
+//	12-round permutation sha3_keccakp12; KT128 leaves of 8192 bytes are
+//	hashed four at a time through sha3_keccakp12x4.
+
+#ifndef _KANGAROO12_H_
+#define _KANGAROO12_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sha3_api.h"
+
+//	=== TurboSHAKE128 ===
+
+//	single-call TurboSHAKE128 with domain separation byte "d" (0x01..0x7F)
+void turboshake128(uint8_t *out, size_t olen, const void *in, size_t inlen,
+				   uint8_t d);
+
+//	=== KangarooTwelve ===
+
+//	leaf (chunk) size
+#define KT128_CHUNK 8192
+
+typedef struct {
+	sha3_ctx_t fin;							//	final node
+	sha3_ctx_t leaf;						//	current partial leaf
+	uint64_t pos;							//	message bytes so far
+	uint64_t nl;							//	leaves hashed into "fin"
+} kt128_ctx_t;
+
+//	single-call KT128 of "in" with customization string "cs"
+void kt128(uint8_t *out, size_t olen, const void *in, size_t inlen,
+		   const uint8_t *cs, size_t clen);
+
+//	incremental interface; kt128_final() absorbs the customization string
+//	and squeezes "olen" bytes. The context is cleared.
+void kt128_init(kt128_ctx_t *c);
+void kt128_update(kt128_ctx_t *c, const void *in, size_t inlen);
+void kt128_final(uint8_t *out, size_t olen, kt128_ctx_t *c,
+				 const uint8_t *cs, size_t clen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	//	_KANGAROO12_H_
@@ -7,6 +7,7 @@
 
 #include "sha3_api.h"
 #include "test_rvkat.h"
+#include "rvk_mem.h"
 
 //	These functions have not been optimized for performance -- they are
 //	here just to facilitate testing of the permutation code implementations.
@@ -22,6 +23,39 @@ static void sha3_f1600_undef(void *s)
 
 void (*sha3_keccakp)(void *) = sha3_f1600_undef;
 
+//	default four-state permutation: one at a time
+
+static void sha3_f1600x4_loop(void *s)
+{
+	int i;
+
+	for (i = 0; i < 4; i++)
+		sha3_keccakp(((uint64_t *) s) + 25 * i);
+}
+
+void (*sha3_keccakp4)(void *) = sha3_f1600x4_loop;
+
+//	12-round permutation pointers
+
+static void sha3_p1600_12_undef(void *s)
+{
+	(void) s;
+
+	rvkat_info("undefined pointer: sha3_p1600_12_undef()");
+}
+
+void (*sha3_keccakp12)(void *) = sha3_p1600_12_undef;
+
+static void sha3_p1600_12x4_loop(void *s)
+{
+	int i;
+
+	for (i = 0; i < 4; i++)
+		sha3_keccakp12(((uint64_t *) s) + 25 * i);
+}
+
+void (*sha3_keccakp12x4)(void *) = sha3_p1600_12x4_loop;
+
 //	initialize the context for SHA3
 
 void sha3_init(sha3_ctx_t * c, int mdlen)
@@ -66,6 +100,7 @@ void sha3_final(uint8_t * md, sha3_ctx_t * c)
 	for (i = 0; i < c->mdlen; i++) {
 		md[i] = c->st.b[i];
 	}
+	rvk_memzero(c, sizeof(sha3_ctx_t));		//	clear it
 }
 
 //	compute a SHA-3 hash "md" of "mdlen" bytes from data in "in"
@@ -81,6 +116,21 @@ void *sha3(uint8_t * md, int mdlen, const void *in, size_t inlen)
 	return md;
 }
 
+//	scatter-gather version
+
+void *sha3_v(uint8_t * md, int mdlen, const struct iovec *iov, size_t n)
+{
+	sha3_ctx_t sha3;
+	size_t i;
+
+	sha3_init(&sha3, mdlen);
+	for (i = 0; i < n; i++)
+		sha3_update(&sha3, iov[i].iov_base, iov[i].iov_len);
+	sha3_final(md, &sha3);
+
+	return md;
+}
+
 //	SHAKE128 and SHAKE256 extensible-output functionality
 
 //	add padding (call once after calls to shake_update() are done
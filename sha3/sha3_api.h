@@ -13,10 +13,14 @@ extern "C" {
 
 #include <stddef.h>
 #include <stdint.h>
+#include "rvk_iovec.h"
 
 //	compute a SHA-3 hash "md" of "mdlen" bytes from data in "in"
 void *sha3(uint8_t * md, int mdlen, const void *in, size_t inlen);
 
+//	the same over the concatenation of "n" segments
+void *sha3_v(uint8_t * md, int mdlen, const struct iovec *iov, size_t n);
+
 typedef struct {							//	state context
 	union {									//	aligned:
 		uint8_t b[200];						//	8-bit bytes
@@ -33,6 +37,18 @@ void sha3_f1600_rvb32(void *);				//	sha3_f1600_rvb32.c
 void sha3_f1600_rvb64(void *);				//	sha3_f1600_rvb64.c
 //void ref_keccakp(void *);					//	ref_keccakp.c ("reference")
 
+//	four independent states (4 x 25 words, consecutive) in one call; by
+//	default four sequential sha3_keccakp() calls. A multi-lane kernel
+//	(vector unit, multiple harts) can be plugged in here.
+extern void (*sha3_keccakp4)(void *);
+
+//	the same for the 12-round Keccak-p[1600,12] of TurboSHAKE and
+//	KangarooTwelve (kangaroo12.h)
+extern void (*sha3_keccakp12)(void *);
+void sha3_p1600_12_rvb32(void *);			//	sha3_f1600_rvb32.c
+void sha3_p1600_12_rvb64(void *);			//	sha3_f1600_rvb64.c
+extern void (*sha3_keccakp12x4)(void *);
+
 //	incremental interfece
 void sha3_init(sha3_ctx_t * c, int mdlen);	//	mdlen = hash output in bytes
 void sha3_update(sha3_ctx_t * c, const void *data, size_t len);
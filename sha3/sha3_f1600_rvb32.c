@@ -38,9 +38,9 @@ static void sha3_f1600_rvb32_join(uint32_t v[50])
 	}
 }
 
-//	Keccak-p[1600,24](S)
+//	Keccak-p[1600,nr](S): the last "nr" of the 24 rounds
 
-void sha3_f1600_rvb32(void *s)
+static void sha3_p1600_rvb32(void *s, int nr)
 {
 	//	round constants (interleaved)
 
@@ -81,9 +81,9 @@ void sha3_f1600_rvb32(void *s)
 	t8 = v[48];
 	t9 = v[49];
 
-	//	24 rounds
+	//	rounds 24 - nr .. 23
 
-	for (q = rc; q != &rc[48]; q += 2) {
+	for (q = &rc[48 - 2 * nr]; q != &rc[48]; q += 2) {
 
 		//	Theta
 
@@ -265,5 +265,19 @@ void sha3_f1600_rvb32(void *s)
 	sha3_f1600_rvb32_join(v);
 }
 
+//	Keccak-p[1600,24](S) = Keccak-f1600(S)
+
+void sha3_f1600_rvb32(void *s)
+{
+	sha3_p1600_rvb32(s, 24);
+}
+
+//	Keccak-p[1600,12](S), used by TurboSHAKE and KangarooTwelve
+
+void sha3_p1600_12_rvb32(void *s)
+{
+	sha3_p1600_rvb32(s, 12);
+}
+
 #endif	//	RVKINTRIN_RV32
 
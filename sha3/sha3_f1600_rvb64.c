@@ -8,9 +8,9 @@
 
 #ifdef RVKINTRIN_RV64
 
-//	Keccak-p[1600,24](S) = Keccak-f1600(S)
+//	Keccak-p[1600,nr](S): the last "nr" of the 24 rounds
 
-void sha3_f1600_rvb64(void *s)
+static void sha3_p1600_rvb64(void *s, int nr)
 {
 	//	round constants
 	const uint64_t rc[24] = {
@@ -61,7 +61,7 @@ void sha3_f1600_rvb64(void *s)
 
 	//	iteration
 
-	for (i = 0; i < 24; i++) {
+	for (i = 24 - nr; i < 24; i++) {
 
 		//	Theta
 
@@ -204,4 +204,18 @@ void sha3_f1600_rvb64(void *s)
 	vs[24] = sy;
 }
 
+//	Keccak-p[1600,24](S) = Keccak-f1600(S)
+
+void sha3_f1600_rvb64(void *s)
+{
+	sha3_p1600_rvb64(s, 24);
+}
+
+//	Keccak-p[1600,12](S), used by TurboSHAKE and KangarooTwelve
+
+void sha3_p1600_12_rvb64(void *s)
+{
+	sha3_p1600_rvb64(s, 12);
+}
+
 #endif
@@ -0,0 +1,307 @@
+//	sp800_185.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	SP 800-185: cSHAKE, KMAC, TupleHash, and ParallelHash.
+
+#include <string.h>
+
+#include "sp800_185.h"
+#include "rv_endian.h"
+#include "rvk_mem.h"
+
+//	number of ParallelHash leaves permuted together
+
+#define SHA3_PAR 4
+
+//	left_encode(x) and right_encode(x) of Sect 2.3.1; return length
+
+static size_t sha3_left_encode(uint8_t b[9], uint64_t x)
+{
+	size_t i, n;
+
+	for (n = 1; n < 8 && (x >> (8 * n)) != 0; n++)
+		;
+	b[0] = n;
+	for (i = 0; i < n; i++)
+		b[n - i] = x >> (8 * i);
+
+	return n + 1;
+}
+
+static size_t sha3_right_encode(uint8_t b[9], uint64_t x)
+{
+	size_t i, n;
+
+	for (n = 1; n < 8 && (x >> (8 * n)) != 0; n++)
+		;
+	for (i = 0; i < n; i++)
+		b[n - 1 - i] = x >> (8 * i);
+	b[n] = n;
+
+	return n + 1;
+}
+
+//	absorb encode_string(s)
+
+static void sha3_encode_string(sha3_ctx_t *c, const uint8_t *s, size_t len)
+{
+	uint8_t b[9];
+
+	sha3_update(c, b, sha3_left_encode(b, ((uint64_t) len) << 3));
+	sha3_update(c, s, len);
+}
+
+//	bytepad(.., rate): left_encode(rate) first, zero fill at the end
+
+static void sha3_bytepad_begin(sha3_ctx_t *c)
+{
+	uint8_t b[9];
+
+	sha3_update(c, b, sha3_left_encode(b, c->rsiz));
+}
+
+static void sha3_bytepad_end(sha3_ctx_t *c)
+{
+	if (c->pt != 0) {						//	zeros don't change state
+		sha3_keccakp(c->st.d);
+		c->pt = 0;
+	}
+}
+
+//	=== cSHAKE ===
+
+void cshake_init(sha3_ctx_t *c, int sec, const uint8_t *n, size_t nlen,
+				 const uint8_t *s, size_t slen)
+{
+	sha3_init(c, sec);
+	sha3_bytepad_begin(c);
+	sha3_encode_string(c, n, nlen);
+	sha3_encode_string(c, s, slen);
+	sha3_bytepad_end(c);
+}
+
+void cshake_xof(sha3_ctx_t *c)
+{
+	c->st.b[c->pt] ^= 0x04;
+	c->st.b[c->rsiz - 1] ^= 0x80;
+	sha3_keccakp(c->st.d);
+	c->pt = 0;
+}
+
+static void cshake(uint8_t *out, size_t olen, int sec,
+				   const void *in, size_t inlen,
+				   const uint8_t *n, size_t nlen,
+				   const uint8_t *s, size_t slen)
+{
+	sha3_ctx_t c;
+
+	if (nlen == 0 && slen == 0) {			//	plain SHAKE
+		sha3_init(&c, sec);
+		sha3_update(&c, in, inlen);
+		shake_xof(&c);
+	} else {
+		cshake_init(&c, sec, n, nlen, s, slen);
+		sha3_update(&c, in, inlen);
+		cshake_xof(&c);
+	}
+	shake_out(out, olen, &c);
+}
+
+void cshake128(uint8_t *out, size_t olen, const void *in, size_t inlen,
+			   const uint8_t *n, size_t nlen, const uint8_t *s, size_t slen)
+{
+	cshake(out, olen, 16, in, inlen, n, nlen, s, slen);
+}
+
+void cshake256(uint8_t *out, size_t olen, const void *in, size_t inlen,
+			   const uint8_t *n, size_t nlen, const uint8_t *s, size_t slen)
+{
+	cshake(out, olen, 32, in, inlen, n, nlen, s, slen);
+}
+
+//	=== KMAC ===
+
+void kmac_init(sha3_ctx_t *k, int sec, const uint8_t *key, size_t klen,
+			   const uint8_t *s, size_t slen)
+{
+	cshake_init(k, sec, (const uint8_t *) "KMAC", 4, s, slen);
+	sha3_bytepad_begin(k);
+	sha3_encode_string(k, key, klen);
+	sha3_bytepad_end(k);
+}
+
+//	right_encode(L) and cSHAKE output
+
+static void kmac_final_len(uint8_t *out, size_t olen, sha3_ctx_t *c,
+						   uint64_t l)
+{
+	uint8_t b[9];
+
+	sha3_update(c, b, sha3_right_encode(b, l));
+	cshake_xof(c);
+	shake_out(out, olen, c);
+	rvk_memzero(c, sizeof(sha3_ctx_t));	//	clear it
+}
+
+void kmac_final(uint8_t *out, size_t olen, sha3_ctx_t *c)
+{
+	kmac_final_len(out, olen, c, ((uint64_t) olen) << 3);
+}
+
+void kmacxof_final(uint8_t *out, size_t olen, sha3_ctx_t *c)
+{
+	kmac_final_len(out, olen, c, 0);
+}
+
+void kmac(uint8_t *out, size_t olen, const sha3_ctx_t *k,
+		  const void *m, size_t mlen)
+{
+	sha3_ctx_t c = *k;						//	clone keyed state
+
+	sha3_update(&c, m, mlen);
+	kmac_final(out, olen, &c);
+}
+
+void kmacxof(uint8_t *out, size_t olen, const sha3_ctx_t *k,
+			 const void *m, size_t mlen)
+{
+	sha3_ctx_t c = *k;
+
+	sha3_update(&c, m, mlen);
+	kmacxof_final(out, olen, &c);
+}
+
+//	=== TupleHash ===
+
+static void tuplehash(uint8_t *out, size_t olen, int sec,
+					  const uint8_t *const x[], const size_t xlen[],
+					  size_t n, const uint8_t *s, size_t slen)
+{
+	sha3_ctx_t c;
+	uint8_t b[9];
+	size_t i;
+
+	cshake_init(&c, sec, (const uint8_t *) "TupleHash", 9, s, slen);
+	for (i = 0; i < n; i++)
+		sha3_encode_string(&c, x[i], xlen[i]);
+	sha3_update(&c, b, sha3_right_encode(b, ((uint64_t) olen) << 3));
+	cshake_xof(&c);
+	shake_out(out, olen, &c);
+}
+
+void tuplehash128(uint8_t *out, size_t olen, const uint8_t *const x[],
+				  const size_t xlen[], size_t n,
+				  const uint8_t *s, size_t slen)
+{
+	tuplehash(out, olen, 16, x, xlen, n, s, slen);
+}
+
+void tuplehash256(uint8_t *out, size_t olen, const uint8_t *const x[],
+				  const size_t xlen[], size_t n,
+				  const uint8_t *s, size_t slen)
+{
+	tuplehash(out, olen, 32, x, xlen, n, s, slen);
+}
+
+//	=== ParallelHash ===
+
+//	permute "j" <= SHA3_PAR states; a full group goes to sha3_keccakp4
+
+static void phash_permute(uint64_t st[SHA3_PAR][25], size_t j)
+{
+	size_t i;
+
+	if (j == SHA3_PAR) {
+		sha3_keccakp4(st);
+	} else {
+		for (i = 0; i < j; i++)
+			sha3_keccakp(st[i]);
+	}
+}
+
+//	SHAKE of "n" full leaves of "b" bytes, in lockstep groups of SHA3_PAR;
+//	the leaf hashes are absorbed into the outer state "c"
+
+static void phash_leaves(sha3_ctx_t *c, int sec, const uint8_t *x,
+						 size_t n, size_t b)
+{
+	uint64_t st[SHA3_PAR][25];
+	const uint8_t *p;
+	size_t i, j, k, w, off, rsiz;
+
+	rsiz = 200 - 2 * sec;
+
+	for (i = 0; i < n; i += j) {
+
+		j = n - i < SHA3_PAR ? n - i : SHA3_PAR;
+		memset(st, 0x00, sizeof(st));
+
+		for (off = 0; off + rsiz <= b; off += rsiz) {
+			for (k = 0; k < j; k++) {		//	full rate blocks
+				p = x + (i + k) * b + off;
+				for (w = 0; w < rsiz / 8; w++)
+					st[k][w] ^= get64u_le(p + 8 * w);
+			}
+			phash_permute(st, j);
+		}
+
+		for (k = 0; k < j; k++) {			//	last block with padding
+			p = x + (i + k) * b + off;
+			for (w = 0; w < b - off; w++)
+				((uint8_t *) st[k])[w] ^= p[w];
+			((uint8_t *) st[k])[b - off] ^= 0x1F;
+			((uint8_t *) st[k])[rsiz - 1] ^= 0x80;
+		}
+		phash_permute(st, j);
+
+		for (k = 0; k < j; k++)				//	2 * sec bytes of output
+			sha3_update(c, st[k], 2 * sec);
+	}
+}
+
+static int parallelhash(uint8_t *out, size_t olen, int sec,
+						const uint8_t *x, size_t xlen, size_t b,
+						const uint8_t *s, size_t slen)
+{
+	sha3_ctx_t c, t;
+	uint8_t h[64], e[9];
+	size_t n;
+
+	if (b == 0)								//	no leaf size
+		return -1;
+
+	cshake_init(&c, sec, (const uint8_t *) "ParallelHash", 12, s, slen);
+	sha3_update(&c, e, sha3_left_encode(e, b));
+
+	n = xlen / b;							//	full leaves
+	phash_leaves(&c, sec, x, n, b);
+
+	if (xlen % b != 0) {					//	partial last leaf
+		sha3_init(&t, sec);
+		sha3_update(&t, x + n * b, xlen % b);
+		shake_xof(&t);
+		shake_out(h, 2 * sec, &t);
+		sha3_update(&c, h, 2 * sec);
+		n++;
+	}
+
+	sha3_update(&c, e, sha3_right_encode(e, n));
+	sha3_update(&c, e, sha3_right_encode(e, ((uint64_t) olen) << 3));
+	cshake_xof(&c);
+	shake_out(out, olen, &c);
+
+	return 0;
+}
+
+int parallelhash128(uint8_t *out, size_t olen, const void *x, size_t xlen,
+					size_t b, const uint8_t *s, size_t slen)
+{
+	return parallelhash(out, olen, 16, x, xlen, b, s, slen);
+}
+
+int parallelhash256(uint8_t *out, size_t olen, const void *x, size_t xlen,
+					size_t b, const uint8_t *s, size_t slen)
+{
+	return parallelhash(out, olen, 32, x, xlen, b, s, slen);
+}
@@ -0,0 +1,79 @@
+//	sp800_185.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	SP 800-185: SHA-3 Derived Functions cSHAKE, KMAC, TupleHash, and
+//	ParallelHash. Strings N (function name) and S (customization) are
+//	byte strings; "sec" is the security level in bytes (16 or 32).
+
+#ifndef _SP800_185_H_
+#define _SP800_185_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sha3_api.h"
+
+//	=== cSHAKE ===
+
+//	single-call cSHAKE; with N and S both empty this is SHAKE
+void cshake128(uint8_t *out, size_t olen, const void *in, size_t inlen,
+			   const uint8_t *n, size_t nlen, const uint8_t *s, size_t slen);
+void cshake256(uint8_t *out, size_t olen, const void *in, size_t inlen,
+			   const uint8_t *n, size_t nlen, const uint8_t *s, size_t slen);
+
+//	incremental cSHAKE; N and S must not both be empty (use SHAKE then).
+//	absorb with sha3_update(), then cshake_xof() and squeeze with shake_out()
+void cshake_init(sha3_ctx_t *c, int sec, const uint8_t *n, size_t nlen,
+				 const uint8_t *s, size_t slen);
+#define cshake128_init(c, n, nlen, s, slen) cshake_init(c, 16, n, nlen, s, slen)
+#define cshake256_init(c, n, nlen, s, slen) cshake_init(c, 32, n, nlen, s, slen)
+void cshake_xof(sha3_ctx_t *c);
+
+//	=== KMAC ===
+
+//	kmacNNN_init(k, key, klen, s, slen): Keyed state; the key block has
+//	been absorbed already, so "k" can be copied (cloned) for each message.
+void kmac_init(sha3_ctx_t *k, int sec, const uint8_t *key, size_t klen,
+			   const uint8_t *s, size_t slen);
+#define kmac128_init(k, key, klen, s, slen) kmac_init(k, 16, key, klen, s, slen)
+#define kmac256_init(k, key, klen, s, slen) kmac_init(k, 32, key, klen, s, slen)
+
+//	finalize a (cloned) keyed state after sha3_update() calls; output
+//	length "olen" is bound to the MAC; KMACXOF leaves it open.
+void kmac_final(uint8_t *out, size_t olen, sha3_ctx_t *c);
+void kmacxof_final(uint8_t *out, size_t olen, sha3_ctx_t *c);
+
+//	single-call MAC of "m" under a keyed state "k" (which is not modified)
+void kmac(uint8_t *out, size_t olen, const sha3_ctx_t *k,
+		  const void *m, size_t mlen);
+void kmacxof(uint8_t *out, size_t olen, const sha3_ctx_t *k,
+			 const void *m, size_t mlen);
+
+//	=== TupleHash ===
+
+//	hash of a tuple of "n" strings x[i] of length xlen[i]
+void tuplehash128(uint8_t *out, size_t olen, const uint8_t *const x[],
+				  const size_t xlen[], size_t n,
+				  const uint8_t *s, size_t slen);
+void tuplehash256(uint8_t *out, size_t olen, const uint8_t *const x[],
+				  const size_t xlen[], size_t n,
+				  const uint8_t *s, size_t slen);
+
+//	=== ParallelHash ===
+
+//	hash of "x" split into leaves of "b" bytes. Leaves are hashed in
+//	groups of four through sha3_keccakp4. Returns 0, or -1 if b = 0.
+int parallelhash128(uint8_t *out, size_t olen, const void *x, size_t xlen,
+					size_t b, const uint8_t *s, size_t slen);
+int parallelhash256(uint8_t *out, size_t olen, const void *x, size_t xlen,
+					size_t b, const uint8_t *s, size_t slen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	//	_SP800_185_H_
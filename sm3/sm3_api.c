@@ -9,61 +9,120 @@
 
 #include <string.h>
 #include "sm3_api.h"
+#include "rvk_mem.h"
 
 //	pointer to the compression functions
 void (*sm3_compress)(void *s) = &sm3_cf256_rvk;
 
-//	Compute 32-byte message digest to "md" from "in" which has "inlen" bytes
+//	initialize
 
-void sm3_256(uint8_t * md, const void *in, size_t inlen)
+void sm3_init(sm3_t * sm3)
 {
-	size_t i;
-	uint64_t x;
-	uint32_t t, s[8 + 16];
+	//	initial values
+	sm3->s[0] = 0x7380166F;
+	sm3->s[1] = 0x4914B2B9;
+	sm3->s[2] = 0x172442D7;
+	sm3->s[3] = 0xDA8A0600;
+	sm3->s[4] = 0xA96F30BC;
+	sm3->s[5] = 0x163138AA;
+	sm3->s[6] = 0xE38DEE4D;
+	sm3->s[7] = 0xB0FB0E4E;
+	sm3->i = 0;
+	sm3->len = 0;
+}
 
-	uint8_t *mp = (uint8_t *) & s[8];
-	const uint8_t *p = in;
+//	process input; a block may straddle calls
 
-	//	initial values
-	s[0] = 0x7380166F;
-	s[1] = 0x4914B2B9;
-	s[2] = 0x172442D7;
-	s[3] = 0xDA8A0600;
-	s[4] = 0xA96F30BC;
-	s[5] = 0x163138AA;
-	s[6] = 0xE38DEE4D;
-	s[7] = 0xB0FB0E4E;
-
-	//	"md padding"
-	x = inlen << 3;							//	length in bits
-
-	while (inlen >= 64) {					//	full blocks
-		memcpy(mp, p, 64);
-		sm3_compress(s);
-		inlen -= 64;
-		p += 64;
+void sm3_update(sm3_t * sm3, const uint8_t * m, size_t mlen)
+{
+	size_t l;
+	uint8_t *mp = (uint8_t *) & sm3->s[8];
+
+	if (mlen == 0)
+		return;
+	sm3->len += mlen;
+	l = 64 - sm3->i;
+
+	if (mlen < l) {
+		memcpy(mp + sm3->i, m, mlen);
+		sm3->i += mlen;
+		return;
+	}
+	if (sm3->i > 0) {
+		memcpy(mp + sm3->i, m, l);
+		sm3_compress(sm3->s);
+		mlen -= l;
+		m += l;
+		sm3->i = 0;
 	}
-	memcpy(mp, p, inlen);					//	last data block
-	mp[inlen++] = 0x80;
-	if (inlen > 56) {
-		memset(mp + inlen, 0x00, 64 - inlen);
-		sm3_compress(s);
-		inlen = 0;
+	while (mlen >= 64) {					//	full blocks
+		memcpy(mp, m, 64);
+		sm3_compress(sm3->s);
+		mlen -= 64;
+		m += 64;
+	}
+	memcpy(mp, m, mlen);
+	sm3->i = mlen;
+}
+
+//	"md padding" and output
+
+void sm3_final(sm3_t * sm3, uint8_t md[32])
+{
+	size_t i;
+	uint64_t x;
+	uint32_t t;
+	uint8_t *mp = (uint8_t *) & sm3->s[8];
+
+	i = sm3->i;								//	last data block
+	mp[i++] = 0x80;
+	if (i > 56) {
+		memset(mp + i, 0x00, 64 - i);
+		sm3_compress(sm3->s);
+		i = 0;
 	}
-	i = 64;									//	process length
+	memset(mp + i, 0x00, 64 - i);
+
+	x = ((uint64_t) sm3->len) << 3;			//	length in bits
+	i = 64;
 	while (x > 0) {
 		mp[--i] = x & 0xFF;
 		x >>= 8;
 	}
-	memset(&mp[inlen], 0x00, i - inlen);
-	sm3_compress(s);
+	sm3_compress(sm3->s);
 
 	//	store big endian output
 	for (i = 0; i < 32; i += 4) {
-		t = s[i >> 2];
+		t = sm3->s[i >> 2];
 		md[i] = t >> 24;
 		md[i + 1] = (t >> 16) & 0xFF;
 		md[i + 2] = (t >> 8) & 0xFF;
 		md[i + 3] = t & 0xFF;
 	}
+
+	rvk_memzero(sm3, sizeof(sm3_t));		//	clear it
+}
+
+//	Compute 32-byte message digest to "md" from "in" which has "inlen" bytes
+
+void sm3_256(uint8_t * md, const void *in, size_t inlen)
+{
+	sm3_t sm3;
+
+	sm3_init(&sm3);
+	sm3_update(&sm3, in, inlen);
+	sm3_final(&sm3, md);
+}
+
+//	scatter-gather version
+
+void sm3_256_v(uint8_t * md, const struct iovec *iov, size_t n)
+{
+	sm3_t sm3;
+	size_t i;
+
+	sm3_init(&sm3);
+	for (i = 0; i < n; i++)
+		sm3_update(&sm3, iov[i].iov_base, iov[i].iov_len);
+	sm3_final(&sm3, md);
 }
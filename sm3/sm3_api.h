@@ -14,10 +14,24 @@ extern "C" {
 
 #include <stdint.h>
 #include <stddef.h>
+#include "rvk_iovec.h"
 
 //	SM3-256: Compute 32-byte hash to "md" from "in" which has "inlen" bytes.
 void sm3_256(uint8_t * md, const void *in, size_t inlen);
 
+//	SM3-256 over the concatenation of "n" segments.
+void sm3_256_v(uint8_t * md, const struct iovec *iov, size_t n);
+
+//	incremental interface
+typedef struct {
+	uint32_t s[8 + 16];
+	size_t i, len;
+} sm3_t;
+
+void sm3_init(sm3_t * sm3);
+void sm3_update(sm3_t * sm3, const uint8_t * m, size_t mlen);
+void sm3_final(sm3_t * sm3, uint8_t md[32]);	//	also clears the state
+
 //	function pointer to the compression function used by the test wrappers
 extern void (*sm3_compress)(void *);
 
@@ -15,6 +15,7 @@ extern "C" {
 #endif
 
 #include <stdint.h>
+#include "rvk_align.h"
 
 //	Size of the expanded key.
 #define SM4_RK_WORDS  32
@@ -29,6 +30,14 @@ void sm4_enc_key(uint32_t rk[SM4_RK_WORDS], const uint8_t key[16]);
 //	expand a secret key for decryption
 void sm4_dec_key(uint32_t rk[SM4_RK_WORDS], const uint8_t key[16]);
 
+//	key object: the 128-byte schedule on two cache lines
+typedef struct {
+	uint32_t rk[SM4_RK_WORDS];
+} RVK_ALIGNED sm4_key_t;
+
+//	set up a key object for encryption (dec = 0) or decryption (dec = 1)
+void sm4_key_init(sm4_key_t * k, const uint8_t key[16], int dec);
+
 //	aliases
 #define sm4_enc_ecb(ct, pt, rk) sm4_encdec(ct, pt, rk)
 #define sm4_dec_ecb(pt, ct, rk) sm4_encdec(pt, ct, rk)
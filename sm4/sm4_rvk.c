@@ -168,3 +168,13 @@ void sm4_dec_key(uint32_t rk[SM4_RK_WORDS], const uint8_t key[16])
 		rk[j] = t;
 	}
 }
+
+//	set up a key object
+
+void sm4_key_init(sm4_key_t * k, const uint8_t key[16], int dec)
+{
+	if (dec)
+		sm4_dec_key(k->rk, key);
+	else
+		sm4_enc_key(k->rk, key);
+}
@@ -0,0 +1,43 @@
+//	ct.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Statistical timing leakage tests (xct), after dudect: Reparaz, Balasch,
+//	Verbauwhede, "Dude, is my code constant time?", DATE 2017. Each kernel
+//	is timed on inputs from two classes, a fixed value and random values,
+//	in random order; a Welch t-test between the classes (with the slowest
+//	measurements cropped at several percentiles) should find no difference.
+//	Only meaningful on the target hardware, without emulation.
+
+#ifndef _CT_H_
+#define _CT_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+//	settings from the command line
+extern size_t ct_meas;						//	measurements per kernel
+extern double ct_thresh;					//	|t| limit
+
+//	deterministic pseudorandom bytes (xorshift64*); not for crypto
+void ct_fill(void *p, size_t n);
+
+//	the timed operation; "in" has the "len" bytes given to ct_test()
+typedef void (*ct_op_t)(const uint8_t *in);
+
+//	time "op" on the fixed input "fix" (all zero if NULL) against random
+//	inputs of "len" bytes, print the largest |t|, and return 1 if it is
+//	over ct_thresh
+int ct_test(const char *lab, ct_op_t op, size_t len, const uint8_t *fix);
+
+//	point the aes_api.h pointers to AES backend "i" (OTF ones excluded);
+//	returns its name, or NULL if there is no such backend
+const char *ct_aes_set(size_t i);
+
+//	the suites
+int ct_aes();								//	ct_aes.c
+int ct_gcm();								//	ct_gcm.c
+int ct_sm4();								//	ct_sm4.c
+int ct_present();							//	ct_present.c
+
+#endif	//	_CT_H_
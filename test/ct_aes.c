@@ -0,0 +1,290 @@
+//	ct_aes.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	AES timing leakage: every aes_api.h pointer of every backend. The key
+//	is the secret input of the key schedules, and the data blocks that of
+//	the block operations (under a fixed random key).
+
+#include <stdio.h>
+#include <string.h>
+
+#include "riscv_crypto.h"
+#include "test_rvkat.h"
+#include "aes/aes_api.h"
+#include "aes/aes_rvk32.h"
+#include "aes/aes_rvk64.h"
+#include "aes/aes_otf_rvk32.h"
+#include "aes/aes_otf_rvk64.h"
+#include "ct.h"
+
+typedef void (*ct_key_t)(uint32_t *rk, const uint8_t *key);
+typedef void (*ct_blk_t)(uint8_t *d, const uint8_t *s, const uint32_t *rk);
+typedef void (*ct_ecbn_t)(uint8_t *d, const uint8_t *s, size_t n,
+						  const uint32_t *rk);
+typedef void (*ct_encdec_t)(uint32_t *erk, uint32_t *drk,
+							const uint8_t *key);
+typedef void (*ct_key_n_t)(uint32_t *rk, const uint8_t *key, size_t n);
+
+//	one backend; entry points it does not have are NULL, and are then left
+//	at their defaults (saved by ct_aes() before the first selection)
+
+typedef struct {
+	const char *name;
+	int otf;								//	on-the-fly keying
+	ct_key_t enc_key[3];
+	ct_blk_t enc[3];
+	ct_key_t dec_key[3];
+	ct_blk_t dec[3];
+	ct_ecbn_t encn[3];
+	ct_ecbn_t decn[3];
+	ct_encdec_t encdec_key[3];
+	ct_key_n_t enc_key_n[3];
+} ct_aes_t;
+
+static const ct_aes_t ct_aes_tab[] = {
+#ifdef RVKINTRIN_RV32
+	{ "aes_rvk32", 0,
+	  { aes128_enc_key_rvk32, aes192_enc_key_rvk32, aes256_enc_key_rvk32 },
+	  { aes128_enc_ecb_rvk32, aes192_enc_ecb_rvk32, aes256_enc_ecb_rvk32 },
+	  { aes128_dec_key_rvk32, aes192_dec_key_rvk32, aes256_dec_key_rvk32 },
+	  { aes128_dec_ecb_rvk32, aes192_dec_ecb_rvk32, aes256_dec_ecb_rvk32 },
+	  { aes128_enc_ecbn_rvk32, aes192_enc_ecbn_rvk32,
+		aes256_enc_ecbn_rvk32 },
+	  { aes128_dec_ecbn_rvk32, aes192_dec_ecbn_rvk32,
+		aes256_dec_ecbn_rvk32 },
+	  { aes128_encdec_key_rvk32, aes192_encdec_key_rvk32,
+		aes256_encdec_key_rvk32 },
+	  { NULL, NULL, NULL } },
+	{ "aes_otf_rvk32", 1,
+	  { aes128_enc_key_rvk32, aes192_enc_key_rvk32, aes256_enc_key_rvk32 },
+	  { aes128_enc_otf_rvk32, aes192_enc_otf_rvk32, aes256_enc_otf_rvk32 },
+	  { aes128_dec_otf_key_rvk32, aes192_dec_otf_key_rvk32,
+		aes256_dec_otf_key_rvk32 },
+	  { aes128_dec_otf_rvk32, aes192_dec_otf_rvk32, aes256_dec_otf_rvk32 },
+	  { NULL, NULL, NULL }, { NULL, NULL, NULL }, { NULL, NULL, NULL },
+	  { NULL, NULL, NULL } },
+#endif
+#ifdef RVKINTRIN_RV64
+	{ "aes_rvk64", 0,
+	  { aes128_enc_key_rvk64, aes192_enc_key_rvk64, aes256_enc_key_rvk64 },
+	  { aes128_enc_ecb_rvk64, aes192_enc_ecb_rvk64, aes256_enc_ecb_rvk64 },
+	  { aes128_dec_key_rvk64, aes192_dec_key_rvk64, aes256_dec_key_rvk64 },
+	  { aes128_dec_ecb_rvk64, aes192_dec_ecb_rvk64, aes256_dec_ecb_rvk64 },
+	  { aes128_enc_ecbn_rvk64, aes192_enc_ecbn_rvk64,
+		aes256_enc_ecbn_rvk64 },
+	  { aes128_dec_ecbn_rvk64, aes192_dec_ecbn_rvk64,
+		aes256_dec_ecbn_rvk64 },
+	  { aes128_encdec_key_rvk64, aes192_encdec_key_rvk64,
+		aes256_encdec_key_rvk64 },
+	  { aes128_enc_key_n_rvk64, aes192_enc_key_n_rvk64,
+		aes256_enc_key_n_rvk64 } },
+	{ "aes_otf_rvk64", 1,
+	  { aes128_enc_key_rvk64, aes192_enc_key_rvk64, aes256_enc_key_rvk64 },
+	  { aes128_enc_otf_rvk64, aes192_enc_otf_rvk64, aes256_enc_otf_rvk64 },
+	  { aes128_dec_otf_key_rvk64, aes192_dec_otf_key_rvk64,
+		aes256_dec_otf_key_rvk64 },
+	  { aes128_dec_otf_rvk64, aes192_dec_otf_rvk64, aes256_dec_otf_rvk64 },
+	  { NULL, NULL, NULL }, { NULL, NULL, NULL }, { NULL, NULL, NULL },
+	  { NULL, NULL, NULL } },
+#endif
+	{ NULL, 0, { NULL, NULL, NULL }, { NULL, NULL, NULL },
+	  { NULL, NULL, NULL }, { NULL, NULL, NULL }, { NULL, NULL, NULL },
+	  { NULL, NULL, NULL }, { NULL, NULL, NULL }, { NULL, NULL, NULL } }
+};
+
+//	the defaults of the optional pointers
+
+static ct_ecbn_t ct_encn0[3], ct_decn0[3];
+static ct_encdec_t ct_encdec0[3];
+static ct_key_n_t ct_key_n0[3];
+
+#define CT_SET(ptr, val, def) ptr = (val) != NULL ? (val) : (def)
+
+static void ct_aes_select(const ct_aes_t *b)
+{
+	aes128_enc_key = b->enc_key[0];
+	aes192_enc_key = b->enc_key[1];
+	aes256_enc_key = b->enc_key[2];
+	aes128_enc_ecb = b->enc[0];
+	aes192_enc_ecb = b->enc[1];
+	aes256_enc_ecb = b->enc[2];
+	aes128_dec_key = b->dec_key[0];
+	aes192_dec_key = b->dec_key[1];
+	aes256_dec_key = b->dec_key[2];
+	aes128_dec_ecb = b->dec[0];
+	aes192_dec_ecb = b->dec[1];
+	aes256_dec_ecb = b->dec[2];
+	CT_SET(aes128_enc_ecbn, b->encn[0], ct_encn0[0]);
+	CT_SET(aes192_enc_ecbn, b->encn[1], ct_encn0[1]);
+	CT_SET(aes256_enc_ecbn, b->encn[2], ct_encn0[2]);
+	CT_SET(aes128_dec_ecbn, b->decn[0], ct_decn0[0]);
+	CT_SET(aes192_dec_ecbn, b->decn[1], ct_decn0[1]);
+	CT_SET(aes256_dec_ecbn, b->decn[2], ct_decn0[2]);
+	CT_SET(aes128_encdec_key, b->encdec_key[0], ct_encdec0[0]);
+	CT_SET(aes192_encdec_key, b->encdec_key[1], ct_encdec0[1]);
+	CT_SET(aes256_encdec_key, b->encdec_key[2], ct_encdec0[2]);
+	CT_SET(aes128_enc_key_n, b->enc_key_n[0], ct_key_n0[0]);
+	CT_SET(aes192_enc_key_n, b->enc_key_n[1], ct_key_n0[1]);
+	CT_SET(aes256_enc_key_n, b->enc_key_n[2], ct_key_n0[2]);
+}
+
+static void ct_aes_save()
+{
+	ct_encn0[0] = aes128_enc_ecbn;
+	ct_encn0[1] = aes192_enc_ecbn;
+	ct_encn0[2] = aes256_enc_ecbn;
+	ct_decn0[0] = aes128_dec_ecbn;
+	ct_decn0[1] = aes192_dec_ecbn;
+	ct_decn0[2] = aes256_dec_ecbn;
+	ct_encdec0[0] = aes128_encdec_key;
+	ct_encdec0[1] = aes192_encdec_key;
+	ct_encdec0[2] = aes256_encdec_key;
+	ct_key_n0[0] = aes128_enc_key_n;
+	ct_key_n0[1] = aes192_enc_key_n;
+	ct_key_n0[2] = aes256_enc_key_n;
+}
+
+const char *ct_aes_set(size_t i)
+{
+	const ct_aes_t *b;
+
+	if (ct_key_n0[0] == NULL)
+		ct_aes_save();
+	for (b = ct_aes_tab; b->name != NULL; b++) {
+		if (!b->otf && i-- == 0) {
+			ct_aes_select(b);
+			return b->name;
+		}
+	}
+
+	return NULL;
+}
+
+//	=== Timed operations ===
+
+#define CT_AES_BLOCKS 4
+#define CT_AES_KEYS 2
+
+static uint8_t ct_out[16 * CT_AES_BLOCKS];
+static uint32_t ct_rk[CT_AES_KEYS * AES256_RK_WORDS], ct_drk[AES256_RK_WORDS];
+
+//	key schedules take the key, block operations the round keys of the
+//	fixed key from ct_aes_keys()
+
+#define CT_AES_OPS(nnn)												\
+static uint32_t ct_erk##nnn[AES##nnn##_RK_WORDS],					\
+	ct_drk##nnn[AES##nnn##_RK_WORDS];								\
+static void ct_aes##nnn##_enc_key(const uint8_t *in)				\
+{																	\
+	aes##nnn##_enc_key(ct_rk, in);									\
+}																	\
+static void ct_aes##nnn##_dec_key(const uint8_t *in)				\
+{																	\
+	aes##nnn##_dec_key(ct_rk, in);									\
+}																	\
+static void ct_aes##nnn##_encdec_key(const uint8_t *in)				\
+{																	\
+	aes##nnn##_encdec_key(ct_rk, ct_drk, in);						\
+}																	\
+static void ct_aes##nnn##_enc_key_n(const uint8_t *in)				\
+{																	\
+	aes##nnn##_enc_key_n(ct_rk, in, CT_AES_KEYS);					\
+}																	\
+static void ct_aes##nnn##_enc_ecb(const uint8_t *in)				\
+{																	\
+	aes##nnn##_enc_ecb(ct_out, in, ct_erk##nnn);					\
+}																	\
+static void ct_aes##nnn##_dec_ecb(const uint8_t *in)				\
+{																	\
+	aes##nnn##_dec_ecb(ct_out, in, ct_drk##nnn);					\
+}																	\
+static void ct_aes##nnn##_enc_ecbn(const uint8_t *in)				\
+{																	\
+	aes##nnn##_enc_ecbn(ct_out, in, CT_AES_BLOCKS, ct_erk##nnn);	\
+}																	\
+static void ct_aes##nnn##_dec_ecbn(const uint8_t *in)				\
+{																	\
+	aes##nnn##_dec_ecbn(ct_out, in, CT_AES_BLOCKS, ct_drk##nnn);	\
+}
+
+CT_AES_OPS(128)
+CT_AES_OPS(192)
+CT_AES_OPS(256)
+
+static void ct_aes_keys()
+{
+	uint8_t key[32];
+
+	ct_fill(key, sizeof(key));
+	aes128_enc_key(ct_erk128, key);
+	aes128_dec_key(ct_drk128, key);
+	aes192_enc_key(ct_erk192, key);
+	aes192_dec_key(ct_drk192, key);
+	aes256_enc_key(ct_erk256, key);
+	aes256_dec_key(ct_drk256, key);
+}
+
+//	the operations; "otf" marks those that on-the-fly keying replaces
+
+static const struct {
+	const char *name;
+	ct_op_t op;
+	size_t len;
+	int otf;
+} ct_aes_ops[] = {
+	{ "aes128_enc_key", ct_aes128_enc_key, 16, 0 },
+	{ "aes128_dec_key", ct_aes128_dec_key, 16, 1 },
+	{ "aes128_encdec_key", ct_aes128_encdec_key, 16, 0 },
+	{ "aes128_enc_key_n", ct_aes128_enc_key_n, 16 * CT_AES_KEYS, 0 },
+	{ "aes128_enc_ecb", ct_aes128_enc_ecb, 16, 1 },
+	{ "aes128_dec_ecb", ct_aes128_dec_ecb, 16, 1 },
+	{ "aes128_enc_ecbn", ct_aes128_enc_ecbn, 16 * CT_AES_BLOCKS, 0 },
+	{ "aes128_dec_ecbn", ct_aes128_dec_ecbn, 16 * CT_AES_BLOCKS, 0 },
+	{ "aes192_enc_key", ct_aes192_enc_key, 24, 0 },
+	{ "aes192_dec_key", ct_aes192_dec_key, 24, 1 },
+	{ "aes192_encdec_key", ct_aes192_encdec_key, 24, 0 },
+	{ "aes192_enc_key_n", ct_aes192_enc_key_n, 24 * CT_AES_KEYS, 0 },
+	{ "aes192_enc_ecb", ct_aes192_enc_ecb, 16, 1 },
+	{ "aes192_dec_ecb", ct_aes192_dec_ecb, 16, 1 },
+	{ "aes192_enc_ecbn", ct_aes192_enc_ecbn, 16 * CT_AES_BLOCKS, 0 },
+	{ "aes192_dec_ecbn", ct_aes192_dec_ecbn, 16 * CT_AES_BLOCKS, 0 },
+	{ "aes256_enc_key", ct_aes256_enc_key, 32, 0 },
+	{ "aes256_dec_key", ct_aes256_dec_key, 32, 1 },
+	{ "aes256_encdec_key", ct_aes256_encdec_key, 32, 0 },
+	{ "aes256_enc_key_n", ct_aes256_enc_key_n, 32 * CT_AES_KEYS, 0 },
+	{ "aes256_enc_ecb", ct_aes256_enc_ecb, 16, 1 },
+	{ "aes256_dec_ecb", ct_aes256_dec_ecb, 16, 1 },
+	{ "aes256_enc_ecbn", ct_aes256_enc_ecbn, 16 * CT_AES_BLOCKS, 0 },
+	{ "aes256_dec_ecbn", ct_aes256_dec_ecbn, 16 * CT_AES_BLOCKS, 0 },
+	{ NULL, NULL, 0, 0 }
+};
+
+//	AES: timing tests
+
+int ct_aes()
+{
+	const ct_aes_t *b;
+	size_t i;
+	int fail = 0;
+	char lab[80];
+
+	if (ct_key_n0[0] == NULL)
+		ct_aes_save();
+
+	for (b = ct_aes_tab; b->name != NULL; b++) {
+		snprintf(lab, sizeof(lab), "=== AES using %s ===", b->name);
+		rvkat_info(lab);
+		ct_aes_select(b);
+		ct_aes_keys();
+
+		for (i = 0; ct_aes_ops[i].name != NULL; i++) {
+			if (b->otf && !ct_aes_ops[i].otf)
+				continue;
+			fail += ct_test(ct_aes_ops[i].name, ct_aes_ops[i].op,
+							ct_aes_ops[i].len, NULL);
+		}
+	}
+
+	return fail;
+}
@@ -0,0 +1,206 @@
+//	ct_main.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	=== Timing measurement, Welch's t-test, and the main driver for xct.
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "riscv_crypto.h"
+#include "test_rvkat.h"
+#include "rvk_cycles.h"
+#include "ct.h"
+
+size_t ct_meas = 100000;
+double ct_thresh = 4.5;
+
+//	=== Helpers ===
+
+static uint64_t ct_x = 0x13198A2E03707344;
+
+void ct_fill(void *p, size_t n)
+{
+	uint8_t *b = (uint8_t *) p;
+	uint64_t x = 0;
+	size_t i;
+
+	for (i = 0; i < n; i++) {
+		if ((i & 7) == 0) {
+			ct_x ^= ct_x >> 12;
+			ct_x ^= ct_x << 25;
+			ct_x ^= ct_x >> 27;
+			x = ct_x * 0x2545F4914F6CDD1D;
+		}
+		b[i] = (uint8_t) x;
+		x >>= 8;
+	}
+}
+
+//	=== Welch's t-test ===
+
+//	running mean and variance of both classes (Welford)
+
+typedef struct {
+	double n[2], m[2], m2[2];
+} ct_stat_t;
+
+static void ct_push(ct_stat_t *st, int c, double x)
+{
+	double d;
+
+	st->n[c] += 1.0;
+	d = x - st->m[c];
+	st->m[c] += d / st->n[c];
+	st->m2[c] += d * (x - st->m[c]);
+}
+
+static double ct_welch(const ct_stat_t *st)
+{
+	double v0, v1;
+
+	if (st->n[0] < 2.0 || st->n[1] < 2.0)
+		return 0.0;
+	v0 = st->m2[0] / (st->n[0] - 1.0);
+	v1 = st->m2[1] / (st->n[1] - 1.0);
+	if (v0 + v1 <= 0.0)
+		return 0.0;
+
+	return (st->m[0] - st->m[1]) / sqrt(v0 / st->n[0] + v1 / st->n[1]);
+}
+
+//	=== Measurement ===
+
+//	inputs are generated and timed in batches; the first one warms up and
+//	sets the crop limits, which are the 1 - 2^-k percentiles, k = 1..10
+
+#define CT_BATCH 10000
+#define CT_CROPS 10
+
+static int ct_cmp(const void *a, const void *b)
+{
+	uint64_t x = *((const uint64_t *) a), y = *((const uint64_t *) b);
+
+	return (x > y) - (x < y);
+}
+
+int ct_test(const char *lab, ct_op_t op, size_t len, const uint8_t *fix)
+{
+	ct_stat_t st[CT_CROPS + 1];
+	uint64_t crop[CT_CROPS], *tm, t0;
+	uint8_t *in, *cls;
+	size_t bat, done, i, j;
+	double p, t, tmax;
+	int c, warm;
+
+	bat = ct_meas < CT_BATCH ? ct_meas : CT_BATCH;
+	if (bat == 0)
+		return 0;
+	in = (uint8_t *) malloc(bat * len);
+	cls = (uint8_t *) malloc(bat);
+	tm = (uint64_t *) malloc(bat * sizeof(uint64_t));
+	if (in == NULL || cls == NULL || tm == NULL) {
+		free(in);
+		free(cls);
+		free(tm);
+		rvkat_info("ct_test(): out of memory");
+		return 1;
+	}
+	memset(st, 0, sizeof(st));
+
+	for (done = 0, warm = 1; done < ct_meas; warm = 0) {
+
+		//	classes in random order: 0 is fixed, 1 random
+		ct_fill(cls, bat);
+		for (i = 0; i < bat; i++) {
+			if (cls[i] & 1)
+				ct_fill(in + i * len, len);
+			else if (fix != NULL)
+				memcpy(in + i * len, fix, len);
+			else
+				memset(in + i * len, 0, len);
+		}
+
+		for (i = 0; i < bat; i++) {
+			t0 = rvk_cycles();
+			op(in + i * len);
+			tm[i] = rvk_cycles() - t0;
+		}
+
+		if (warm) {
+			qsort(tm, bat, sizeof(uint64_t), ct_cmp);
+			for (j = 0, p = 0.5; j < CT_CROPS; j++, p *= 0.5)
+				crop[j] = tm[(size_t) ((1.0 - p) * bat)];
+			continue;
+		}
+
+		for (i = 0; i < bat; i++) {
+			c = cls[i] & 1;
+			ct_push(&st[0], c, (double) tm[i]);
+			for (j = 0; j < CT_CROPS; j++) {
+				if (tm[i] < crop[j])
+					ct_push(&st[j + 1], c, (double) tm[i]);
+			}
+		}
+		done += bat;
+	}
+	free(in);
+	free(cls);
+	free(tm);
+
+	tmax = 0.0;
+	for (j = 0; j <= CT_CROPS; j++) {
+		t = fabs(ct_welch(&st[j]));
+		if (t > tmax)
+			tmax = t;
+	}
+	printf("[CT] %s: max |t| = %.2f (fixed %.1f, random %.1f "
+		   RVK_CYCLES_UNIT ")%s\n", lab, tmax, st[0].m[0], st[0].m[1],
+		   tmax > ct_thresh ? "  <-- LEAK" : "");
+	fflush(stdout);
+
+	return tmax > ct_thresh;
+}
+
+//	=== Main ===
+
+int main(int argc, char **argv)
+{
+	int opt, fail = 0;
+
+	while ((opt = getopt(argc, argv, "n:t:h")) != -1) {
+		switch (opt) {
+			case 'n':
+				ct_meas = strtoul(optarg, NULL, 0);
+				break;
+			case 't':
+				ct_thresh = strtod(optarg, NULL);
+				break;
+			default:
+				fprintf(stderr, "Usage: xct [-n meas] [-t limit]\n"
+						"  -n      measurements per kernel (%zu)\n"
+						"  -t      |t| limit (%.1f)\n",
+						ct_meas, ct_thresh);
+				return 2;
+		}
+	}
+
+#ifdef RVKINTRIN_EMULATE
+	rvkat_info("Emulated instructions: timing is of the emulation.");
+#endif
+
+	fail += ct_aes();
+	fail += ct_gcm();
+	fail += ct_sm4();
+	fail += ct_present();
+
+	if (fail) {
+		rvkat_info("RVKAT constant-time test finished: FAIL (leaks)");
+	} else {
+		rvkat_info("RVKAT constant-time test finished: PASS (no leaks)");
+	}
+
+	return fail;
+}
@@ -0,0 +1,47 @@
+//	ct_sm4.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	SM4 timing leakage: sm4_encdec() on secret blocks under a fixed key,
+//	and the key schedules on secret keys.
+
+#include "riscv_crypto.h"
+#include "test_rvkat.h"
+#include "sm4/sm4_api.h"
+#include "ct.h"
+
+static uint32_t ct_rk[SM4_RK_WORDS], ct_xrk[SM4_RK_WORDS];
+static uint8_t ct_out[16];
+
+static void ct_sm4_encdec(const uint8_t *in)
+{
+	sm4_encdec(ct_out, in, ct_rk);
+}
+
+static void ct_sm4_enc_key(const uint8_t *in)
+{
+	sm4_enc_key(ct_xrk, in);
+}
+
+static void ct_sm4_dec_key(const uint8_t *in)
+{
+	sm4_dec_key(ct_xrk, in);
+}
+
+//	SM4: timing tests
+
+int ct_sm4()
+{
+	uint8_t key[16];
+	int fail = 0;
+
+	rvkat_info("=== SM4 ===");
+	ct_fill(key, sizeof(key));
+	sm4_enc_key(ct_rk, key);
+
+	fail += ct_test("sm4_encdec", ct_sm4_encdec, 16, NULL);
+	fail += ct_test("sm4_enc_key", ct_sm4_enc_key, 16, NULL);
+	fail += ct_test("sm4_dec_key", ct_sm4_dec_key, 16, NULL);
+
+	return fail;
+}
@@ -0,0 +1,57 @@
+//	fuzz.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Differential fuzz targets (xfuzz). Each target feeds the same input to
+//	every compiled-in backend of a primitive, and to its one-shot,
+//	scatter-gather and incremental interfaces, and aborts on the first
+//	difference. Built with emulation and both RVKINTRIN_RV32 and
+//	RVKINTRIN_RV64, all of the backend pairs are in one binary.
+
+#ifndef _FUZZ_H_
+#define _FUZZ_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+//	libFuzzer entry point; the first byte selects the target
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+//	libFuzzer start-up hook (RVK_LIBFUZZER only)
+int LLVMFuzzerInitialize(int *argc, char ***argv);
+
+//	input reader: bytes and lengths are taken from the front
+typedef struct {
+	const uint8_t *p;
+	size_t n;
+} fuzz_in_t;
+
+//	next byte, or 0 when the input is exhausted
+uint8_t fuzz_byte(fuzz_in_t *in);
+
+//	a length in 0 .. max (inclusive) from two bytes
+size_t fuzz_len(fuzz_in_t *in, size_t max);
+
+//	point "*p" to up to "max" bytes of input; returns the count
+size_t fuzz_take(fuzz_in_t *in, const uint8_t **p, size_t max);
+
+//	copy up to "max" bytes of input to "d"; returns the count
+size_t fuzz_copy(fuzz_in_t *in, void *d, size_t max);
+
+//	report a mismatch and abort()
+void fuzz_fail(const char *lab);
+
+#define FUZZ_CHECK(cond, lab) do { if (!(cond)) fuzz_fail(lab); } while (0)
+
+//	point the aes_api.h pointers to AES backend "i" (OTF ones excluded);
+//	returns its name, or NULL if there is no such backend
+const char *fuzz_aes_set(size_t i);
+
+//	the targets
+void fuzz_aes(fuzz_in_t *in);				//	fuzz_aes.c
+void fuzz_ghash(fuzz_in_t *in);				//	fuzz_gcm.c
+void fuzz_gcm(fuzz_in_t *in);
+void fuzz_sha2(fuzz_in_t *in);				//	fuzz_sha2.c
+void fuzz_sha3(fuzz_in_t *in);				//	fuzz_sha3.c
+
+#endif	//	_FUZZ_H_
@@ -0,0 +1,203 @@
+//	fuzz_aes.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	AES differential fuzz target: key schedules and block encryption and
+//	decryption of all backends (rvk32, rvk64, and on-the-fly keying), the
+//	multi-block and multi-key entry points, and the key object API.
+
+#include <string.h>
+
+#include "riscv_crypto.h"
+#include "aes/aes_api.h"
+#include "aes/aes_rvk32.h"
+#include "aes/aes_rvk64.h"
+#include "aes/aes_otf_rvk32.h"
+#include "aes/aes_otf_rvk64.h"
+#include "fuzz.h"
+
+typedef void (*fuzz_key_t)(uint32_t *rk, const uint8_t *key);
+typedef void (*fuzz_blk_t)(uint8_t *d, const uint8_t *s, const uint32_t *rk);
+typedef void (*fuzz_ecbn_t)(uint8_t *d, const uint8_t *s, size_t n,
+							const uint32_t *rk);
+typedef void (*fuzz_encdec_t)(uint32_t *erk, uint32_t *drk,
+							  const uint8_t *key);
+typedef void (*fuzz_key_n_t)(uint32_t *rk, const uint8_t *key, size_t n);
+
+//	one backend; the optional entry points are NULL if it has none
+
+typedef struct {
+	const char *name;
+	int otf;								//	on-the-fly: rk not comparable
+	fuzz_key_t enc_key[3];
+	fuzz_blk_t enc[3];
+	fuzz_key_t dec_key[3];
+	fuzz_blk_t dec[3];
+	fuzz_ecbn_t encn[3];
+	fuzz_ecbn_t decn[3];
+	fuzz_encdec_t encdec_key[3];
+	fuzz_key_n_t enc_key_n[3];
+} fuzz_aes_t;
+
+static const fuzz_aes_t fuzz_aes_tab[] = {
+#ifdef RVKINTRIN_RV32
+	{ "aes_rvk32", 0,
+	  { aes128_enc_key_rvk32, aes192_enc_key_rvk32, aes256_enc_key_rvk32 },
+	  { aes128_enc_ecb_rvk32, aes192_enc_ecb_rvk32, aes256_enc_ecb_rvk32 },
+	  { aes128_dec_key_rvk32, aes192_dec_key_rvk32, aes256_dec_key_rvk32 },
+	  { aes128_dec_ecb_rvk32, aes192_dec_ecb_rvk32, aes256_dec_ecb_rvk32 },
+	  { aes128_enc_ecbn_rvk32, aes192_enc_ecbn_rvk32,
+		aes256_enc_ecbn_rvk32 },
+	  { aes128_dec_ecbn_rvk32, aes192_dec_ecbn_rvk32,
+		aes256_dec_ecbn_rvk32 },
+	  { aes128_encdec_key_rvk32, aes192_encdec_key_rvk32,
+		aes256_encdec_key_rvk32 },
+	  { NULL, NULL, NULL } },
+	{ "aes_otf_rvk32", 1,
+	  { aes128_enc_key_rvk32, aes192_enc_key_rvk32, aes256_enc_key_rvk32 },
+	  { aes128_enc_otf_rvk32, aes192_enc_otf_rvk32, aes256_enc_otf_rvk32 },
+	  { aes128_dec_otf_key_rvk32, aes192_dec_otf_key_rvk32,
+		aes256_dec_otf_key_rvk32 },
+	  { aes128_dec_otf_rvk32, aes192_dec_otf_rvk32, aes256_dec_otf_rvk32 },
+	  { NULL, NULL, NULL }, { NULL, NULL, NULL }, { NULL, NULL, NULL },
+	  { NULL, NULL, NULL } },
+#endif
+#ifdef RVKINTRIN_RV64
+	{ "aes_rvk64", 0,
+	  { aes128_enc_key_rvk64, aes192_enc_key_rvk64, aes256_enc_key_rvk64 },
+	  { aes128_enc_ecb_rvk64, aes192_enc_ecb_rvk64, aes256_enc_ecb_rvk64 },
+	  { aes128_dec_key_rvk64, aes192_dec_key_rvk64, aes256_dec_key_rvk64 },
+	  { aes128_dec_ecb_rvk64, aes192_dec_ecb_rvk64, aes256_dec_ecb_rvk64 },
+	  { aes128_enc_ecbn_rvk64, aes192_enc_ecbn_rvk64,
+		aes256_enc_ecbn_rvk64 },
+	  { aes128_dec_ecbn_rvk64, aes192_dec_ecbn_rvk64,
+		aes256_dec_ecbn_rvk64 },
+	  { aes128_encdec_key_rvk64, aes192_encdec_key_rvk64,
+		aes256_encdec_key_rvk64 },
+	  { aes128_enc_key_n_rvk64, aes192_enc_key_n_rvk64,
+		aes256_enc_key_n_rvk64 } },
+	{ "aes_otf_rvk64", 1,
+	  { aes128_enc_key_rvk64, aes192_enc_key_rvk64, aes256_enc_key_rvk64 },
+	  { aes128_enc_otf_rvk64, aes192_enc_otf_rvk64, aes256_enc_otf_rvk64 },
+	  { aes128_dec_otf_key_rvk64, aes192_dec_otf_key_rvk64,
+		aes256_dec_otf_key_rvk64 },
+	  { aes128_dec_otf_rvk64, aes192_dec_otf_rvk64, aes256_dec_otf_rvk64 },
+	  { NULL, NULL, NULL }, { NULL, NULL, NULL }, { NULL, NULL, NULL },
+	  { NULL, NULL, NULL } },
+#endif
+	{ NULL, 0, { NULL, NULL, NULL }, { NULL, NULL, NULL },
+	  { NULL, NULL, NULL }, { NULL, NULL, NULL }, { NULL, NULL, NULL },
+	  { NULL, NULL, NULL }, { NULL, NULL, NULL }, { NULL, NULL, NULL } }
+};
+
+//	point the aes_api.h pointers to a backend
+
+static void fuzz_aes_select(const fuzz_aes_t *b)
+{
+	aes128_enc_key = b->enc_key[0];
+	aes192_enc_key = b->enc_key[1];
+	aes256_enc_key = b->enc_key[2];
+	aes128_enc_ecb = b->enc[0];
+	aes192_enc_ecb = b->enc[1];
+	aes256_enc_ecb = b->enc[2];
+	aes128_dec_key = b->dec_key[0];
+	aes192_dec_key = b->dec_key[1];
+	aes256_dec_key = b->dec_key[2];
+	aes128_dec_ecb = b->dec[0];
+	aes192_dec_ecb = b->dec[1];
+	aes256_dec_ecb = b->dec[2];
+	aes128_enc_ecbn = b->encn[0];
+	aes192_enc_ecbn = b->encn[1];
+	aes256_enc_ecbn = b->encn[2];
+	aes128_dec_ecbn = b->decn[0];
+	aes192_dec_ecbn = b->decn[1];
+	aes256_dec_ecbn = b->decn[2];
+}
+
+const char *fuzz_aes_set(size_t i)
+{
+	const fuzz_aes_t *b;
+
+	for (b = fuzz_aes_tab; b->name != NULL; b++) {
+		if (!b->otf && i-- == 0) {
+			fuzz_aes_select(b);
+			return b->name;
+		}
+	}
+
+	return NULL;
+}
+
+#define FUZZ_AES_BLOCKS 64
+#define FUZZ_AES_KEYS 4
+
+void fuzz_aes(fuzz_in_t *in)
+{
+	const fuzz_aes_t *b;
+	uint8_t key[FUZZ_AES_KEYS * 32], pt[16 * FUZZ_AES_BLOCKS];
+	uint8_t ct0[16 * FUZZ_AES_BLOCKS], ct[16 * FUZZ_AES_BLOCKS],
+		x[16 * FUZZ_AES_BLOCKS];
+	uint32_t rk[FUZZ_AES_KEYS * AES256_RK_WORDS], drk[AES256_RK_WORDS],
+		erk2[AES256_RK_WORDS], drk2[AES256_RK_WORDS];
+	aes_key_t k;
+	size_t klen, n, i, w;
+	int ks;
+
+	ks = fuzz_byte(in) % 3;
+	klen = 16 + 8 * ks;
+	w = 4 * (7 + klen / 4);					//	round key words
+	memset(key, 0, sizeof(key));
+	fuzz_copy(in, key, klen);
+	for (i = klen; i < FUZZ_AES_KEYS * klen; i++)	//	related keys
+		key[i] = key[i % klen] ^ (uint8_t) (i / klen);
+	n = fuzz_copy(in, pt, sizeof(pt)) / 16;
+
+	for (b = fuzz_aes_tab; b->name != NULL; b++) {
+		fuzz_aes_select(b);					//	dec_key uses the pointers
+
+		//	single blocks
+		b->enc_key[ks](rk, key);
+		for (i = 0; i < n; i++)
+			b->enc[ks](ct + 16 * i, pt + 16 * i, rk);
+		if (b == fuzz_aes_tab)
+			memcpy(ct0, ct, 16 * n);
+		FUZZ_CHECK(memcmp(ct, ct0, 16 * n) == 0, b->name);
+
+		b->dec_key[ks](drk, key);
+		for (i = 0; i < n; i++)
+			b->dec[ks](x + 16 * i, ct + 16 * i, drk);
+		FUZZ_CHECK(memcmp(x, pt, 16 * n) == 0, "AES decrypt");
+
+		if (b->otf)
+			continue;
+
+		//	multi-block
+		b->encn[ks](x, pt, n, rk);
+		FUZZ_CHECK(memcmp(x, ct0, 16 * n) == 0, "AES ecbn");
+		b->decn[ks](x, ct0, n, drk);
+		FUZZ_CHECK(memcmp(x, pt, 16 * n) == 0, "AES ecbn");
+
+		//	both schedules in one pass
+		b->encdec_key[ks](erk2, drk2, key);
+		FUZZ_CHECK(memcmp(erk2, rk, 4 * w) == 0, "AES encdec_key");
+		FUZZ_CHECK(memcmp(drk2, drk, 4 * w) == 0, "AES encdec_key");
+
+		//	several keys at once
+		if (b->enc_key_n[ks] != NULL) {
+			b->enc_key_n[ks](rk, key, FUZZ_AES_KEYS);
+			for (i = 0; i < FUZZ_AES_KEYS; i++) {
+				b->enc_key[ks](erk2, key + klen * i);
+				FUZZ_CHECK(memcmp(erk2, rk + w * i, 4 * w) == 0,
+						   "AES enc_key_n");
+			}
+		}
+
+		//	key object API through the pointers
+		aes_enc_key_init(&k, key, klen);
+		aes_enc_ecbn_key(x, pt, n, &k);
+		FUZZ_CHECK(memcmp(x, ct0, 16 * n) == 0, "aes_enc_ecbn_key");
+		aes_dec_key_init(&k, key, klen);
+		aes_dec_ecbn_key(x, ct0, n, &k);
+		FUZZ_CHECK(memcmp(x, pt, 16 * n) == 0, "aes_dec_ecbn_key");
+	}
+}
@@ -0,0 +1,183 @@
+//	fuzz_gcm.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	GHASH and AES-GCM differential fuzz targets. Every GHASH backend in
+//	ghash_impl[] is compared with the others, and its single-block and
+//	4-block multiplications with each other. AES-GCM is run with each GHASH
+//	and AES backend pair through the one-shot, scatter-gather and key object
+//	interfaces.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "riscv_crypto.h"
+#include "gcm/gcm_api.h"
+#include "fuzz.h"
+
+//	=== GHASH ===
+
+#define FUZZ_GHASH_BLOCKS 16
+
+void fuzz_ghash(fuzz_in_t *in)
+{
+	const ghash_impl_t *g;
+	gf128_t hc, zc, z0, z, t, h[4], x[FUZZ_GHASH_BLOCKS];
+	size_t n, i;
+
+	memset(&hc, 0, sizeof(gf128_t));
+	memset(&zc, 0, sizeof(gf128_t));
+	memset(x, 0, sizeof(x));
+	fuzz_copy(in, hc.b, 16);
+	fuzz_copy(in, zc.b, 16);
+	n = fuzz_len(in, FUZZ_GHASH_BLOCKS);
+	fuzz_copy(in, x, 16 * n);
+
+	for (g = ghash_impl; g->name != NULL; g++) {
+		ghash_select(g);					//	the loops use the pointers
+
+		//	h[] = { H^4, H^3, H^2, H }
+		h[3] = hc;
+		g->rev(&h[3]);
+		for (i = 3; i > 0; i--) {
+			t = h[i];
+			g->rev(&t);
+			memset(&h[i - 1], 0, sizeof(gf128_t));
+			g->mul(&h[i - 1], &t, &h[3]);
+		}
+
+		//	block by block
+		z = zc;
+		g->rev(&z);
+		for (i = 0; i < n; i++)
+			g->mul(&z, &x[i], &h[3]);
+		g->rev(&z);
+		if (g == ghash_impl)
+			z0 = z;
+		FUZZ_CHECK(memcmp(&z, &z0, sizeof(gf128_t)) == 0, g->name);
+
+		//	four at a time
+		z = zc;
+		g->rev(&z);
+		for (i = 0; i + 4 <= n; i += 4)
+			g->mul4(&z, &x[i], h);
+		for (; i < n; i++)
+			g->mul(&z, &x[i], &h[3]);
+		g->rev(&z);
+		FUZZ_CHECK(memcmp(&z, &z0, sizeof(gf128_t)) == 0, "ghash_mul4");
+	}
+}
+
+//	=== AES-GCM ===
+
+static const struct {
+	void (*enc)(uint8_t *c, const uint8_t *m, size_t mlen,
+				const uint8_t *key, const uint8_t iv[12]);
+	int (*dec)(uint8_t *m, const uint8_t *c, size_t clen,
+			   const uint8_t *key, const uint8_t iv[12]);
+	void (*enc_v)(const struct iovec *c, const struct iovec *m, size_t n,
+				  uint8_t tag[16], const uint8_t *key, const uint8_t iv[12]);
+	int (*dec_v)(const struct iovec *m, const struct iovec *c, size_t n,
+				 const uint8_t tag[16], const uint8_t *key,
+				 const uint8_t iv[12]);
+} fuzz_gcm_tab[3] = {
+	{ aes128_enc_gcm, aes128_dec_vfy_gcm,
+	  aes128_enc_gcm_v, aes128_dec_vfy_gcm_v },
+	{ aes192_enc_gcm, aes192_dec_vfy_gcm,
+	  aes192_enc_gcm_v, aes192_dec_vfy_gcm_v },
+	{ aes256_enc_gcm, aes256_dec_vfy_gcm,
+	  aes256_enc_gcm_v, aes256_dec_vfy_gcm_v }
+};
+
+//	three segments of "buf" split at "a" and "b"
+
+static void fuzz_gcm_iov(struct iovec v[3], uint8_t *buf, size_t a,
+						 size_t b, size_t len)
+{
+	v[0].iov_base = buf;
+	v[0].iov_len = a;
+	v[1].iov_base = buf + a;
+	v[1].iov_len = b - a;
+	v[2].iov_base = buf + b;
+	v[2].iov_len = len - b;
+}
+
+#define FUZZ_GCM_MAX 512
+
+void fuzz_gcm(fuzz_in_t *in)
+{
+	const ghash_impl_t *g;
+	const char *aes;
+	uint8_t key[32], iv[12], m[FUZZ_GCM_MAX], c0[FUZZ_GCM_MAX + 16],
+		c[FUZZ_GCM_MAX + 16], x[FUZZ_GCM_MAX + 16], tag[16];
+	struct iovec mv[3], cv[3];
+	gcm_key_t gk;
+	size_t klen, mlen, a, b, i, j;
+	int ks, first = 1;
+	char lab[80];
+
+	ks = fuzz_byte(in) % 3;
+	klen = 16 + 8 * ks;
+	memset(key, 0, sizeof(key));
+	memset(iv, 0, sizeof(iv));
+	fuzz_copy(in, key, klen);
+	fuzz_copy(in, iv, 12);
+	a = fuzz_len(in, FUZZ_GCM_MAX);			//	segment boundaries
+	b = fuzz_len(in, FUZZ_GCM_MAX);
+	j = fuzz_len(in, FUZZ_GCM_MAX + 15);	//	a bit to flip
+	mlen = fuzz_copy(in, m, FUZZ_GCM_MAX);
+	a = a % (mlen + 1);
+	b = a + b % (mlen - a + 1);
+	j = j % (mlen + 16);
+
+	for (i = 0; (aes = fuzz_aes_set(i)) != NULL; i++) {
+		for (g = ghash_impl; g->name != NULL; g++) {
+			ghash_select(g);
+
+			//	one-shot
+			fuzz_gcm_tab[ks].enc(c, m, mlen, key, iv);
+			if (first)
+				memcpy(c0, c, mlen + 16);
+			first = 0;
+			snprintf(lab, sizeof(lab), "AES-GCM %s / %s", aes, g->name);
+			FUZZ_CHECK(memcmp(c, c0, mlen + 16) == 0, lab);
+			memset(x, 0, sizeof(x));
+			FUZZ_CHECK(fuzz_gcm_tab[ks].dec(x, c0, mlen + 16, key, iv) == 0,
+					   "AES-GCM verify");
+			FUZZ_CHECK(memcmp(x, m, mlen) == 0, "AES-GCM decrypt");
+
+			//	scatter-gather
+			fuzz_gcm_iov(mv, m, a, b, mlen);
+			fuzz_gcm_iov(cv, c, a, b, mlen);
+			memset(c, 0, sizeof(c));
+			fuzz_gcm_tab[ks].enc_v(cv, mv, 3, tag, key, iv);
+			FUZZ_CHECK(memcmp(c, c0, mlen) == 0, "AES-GCM _v");
+			FUZZ_CHECK(memcmp(tag, c0 + mlen, 16) == 0, "AES-GCM _v tag");
+			fuzz_gcm_iov(mv, x, a, b, mlen);
+			fuzz_gcm_iov(cv, c0, a, b, mlen);
+			memset(x, 0, sizeof(x));
+			FUZZ_CHECK(fuzz_gcm_tab[ks].dec_v(mv, cv, 3, c0 + mlen,
+											  key, iv) == 0,
+					   "AES-GCM _v verify");
+			FUZZ_CHECK(memcmp(x, m, mlen) == 0, "AES-GCM _v decrypt");
+
+			//	key object
+			FUZZ_CHECK(aes_gcm_key_init(&gk, key, klen) == 0,
+					   "aes_gcm_key_init");
+			aes_enc_gcm_key(c, m, mlen, &gk, iv);
+			FUZZ_CHECK(memcmp(c, c0, mlen + 16) == 0, "aes_enc_gcm_key");
+			memset(x, 0, sizeof(x));
+			FUZZ_CHECK(aes_dec_vfy_gcm_key(x, c0, mlen + 16, &gk, iv) == 0,
+					   "aes_dec_vfy_gcm_key");
+			FUZZ_CHECK(memcmp(x, m, mlen) == 0, "aes_dec_vfy_gcm_key");
+
+			//	a flipped bit must be detected
+			memcpy(c, c0, mlen + 16);
+			c[j] ^= 1 << (j & 7);
+			FUZZ_CHECK(fuzz_gcm_tab[ks].dec(x, c, mlen + 16, key, iv) != 0,
+					   "AES-GCM forgery");
+			FUZZ_CHECK(aes_dec_vfy_gcm_key(x, c, mlen + 16, &gk, iv) != 0,
+					   "aes_dec_vfy_gcm_key forgery");
+		}
+	}
+}
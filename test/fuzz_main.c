@@ -0,0 +1,196 @@
+//	fuzz_main.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	=== Entry point and a standalone driver for the fuzz targets.
+
+//	With RVK_LIBFUZZER, libFuzzer provides main(), e.g.:
+//	CFLAGS="-DRVKINTRIN_EMULATE=1 -DRVKINTRIN_RV32 -DRVKINTRIN_RV64
+//		-DRVK_LIBFUZZER -fsanitize=fuzzer,address" make xfuzz XCC=clang
+//	(CFLAGS from the environment; on the make command line it would
+//	replace the include paths set in the Makefile.)
+//	Otherwise the driver below runs files (a corpus, or crash reproducers)
+//	or pseudorandom inputs.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "riscv_crypto.h"
+#include "test_rvkat.h"
+#include "fuzz.h"
+
+//	=== Input ===
+
+uint8_t fuzz_byte(fuzz_in_t *in)
+{
+	if (in->n == 0)
+		return 0;
+	in->n--;
+
+	return *in->p++;
+}
+
+size_t fuzz_len(fuzz_in_t *in, size_t max)
+{
+	size_t x;
+
+	x = fuzz_byte(in);
+	x = (x << 8) | fuzz_byte(in);
+
+	return x % (max + 1);
+}
+
+size_t fuzz_take(fuzz_in_t *in, const uint8_t **p, size_t max)
+{
+	size_t n = in->n < max ? in->n : max;
+
+	*p = in->p;
+	in->p += n;
+	in->n -= n;
+
+	return n;
+}
+
+size_t fuzz_copy(fuzz_in_t *in, void *d, size_t max)
+{
+	const uint8_t *p;
+	size_t n;
+
+	n = fuzz_take(in, &p, max);
+	memcpy(d, p, n);
+
+	return n;
+}
+
+void fuzz_fail(const char *lab)
+{
+	fprintf(stderr, "[FAIL] fuzz: %s mismatch\n", lab);
+	fflush(stderr);
+	abort();
+}
+
+//	=== Targets ===
+
+static void (*const fuzz_tab[])(fuzz_in_t *) = {
+	fuzz_aes, fuzz_ghash, fuzz_gcm, fuzz_sha2, fuzz_sha3
+};
+
+#define FUZZ_TARGETS (sizeof(fuzz_tab) / sizeof(fuzz_tab[0]))
+
+//	a build with only one of RV32 / RV64 compares fewer backends
+
+static void fuzz_note()
+{
+#if !defined(RVKINTRIN_RV32) || !defined(RVKINTRIN_RV64)
+	rvkat_info("xfuzz: RV32 and RV64 backends are not compared.");
+#endif
+}
+
+#ifdef RVK_LIBFUZZER
+
+int LLVMFuzzerInitialize(int *argc, char ***argv)
+{
+	(void) argc;
+	(void) argv;
+	fuzz_note();
+
+	return 0;
+}
+
+#endif
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+	fuzz_in_t in;
+
+	if (size == 0)
+		return 0;
+	in.p = data + 1;
+	in.n = size - 1;
+	fuzz_tab[data[0] % FUZZ_TARGETS](&in);
+
+	return 0;
+}
+
+#ifndef RVK_LIBFUZZER
+
+//	=== Standalone driver ===
+
+#include <unistd.h>
+
+#define FUZZ_MAX_LEN 4096
+
+static int fuzz_file(const char *fn)
+{
+	FILE *f;
+	uint8_t *buf;
+	size_t n;
+
+	f = fopen(fn, "rb");
+	if (f == NULL) {
+		perror(fn);
+		return -1;
+	}
+	buf = (uint8_t *) malloc(1 << 20);
+	if (buf == NULL) {
+		fclose(f);
+		return -1;
+	}
+	n = fread(buf, 1, 1 << 20, f);
+	fclose(f);
+	LLVMFuzzerTestOneInput(buf, n);
+	free(buf);
+
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	uint8_t buf[FUZZ_MAX_LEN];
+	uint64_t x = 0x9E3779B97F4A7C15;
+	unsigned long cnt = 10000, i;
+	size_t n, j;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "n:s:h")) != -1) {
+		switch (opt) {
+			case 'n':
+				cnt = strtoul(optarg, NULL, 0);
+				break;
+			case 's':
+				x ^= strtoull(optarg, NULL, 0);
+				break;
+			default:
+				fprintf(stderr, "Usage: xfuzz [-n count] [-s seed] "
+						"[input files]\n");
+				return 2;
+		}
+	}
+	fuzz_note();
+
+	if (optind < argc) {					//	given inputs only
+		for (; optind < argc; optind++) {
+			if (fuzz_file(argv[optind]) != 0)
+				return 1;
+		}
+		rvkat_info("xfuzz: inputs passed");
+		return 0;
+	}
+
+	for (i = 0; i < cnt; i++) {				//	xorshift64* inputs
+		for (j = 0; j < sizeof(buf); j++) {
+			x ^= x >> 12;
+			x ^= x << 25;
+			x ^= x >> 27;
+			buf[j] = (uint8_t) ((x * 0x2545F4914F6CDD1D) >> 56);
+		}
+		n = 1 + ((buf[1] << 8) | buf[2]) % FUZZ_MAX_LEN;
+		buf[0] = i % FUZZ_TARGETS;
+		LLVMFuzzerTestOneInput(buf, n);
+	}
+	rvkat_info("xfuzz: random inputs passed");
+
+	return 0;
+}
+
+#endif	//	RVK_LIBFUZZER
@@ -0,0 +1,124 @@
+//	fuzz_sha2.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	SHA-2 differential fuzz target: the SHA-512 compression functions on
+//	arbitrary states, SHA-256 with and without a precomputed schedule, and
+//	the one-shot, scatter-gather and incremental interfaces of all six
+//	variants with each SHA-512 backend.
+
+#include <string.h>
+
+#include "riscv_crypto.h"
+#include "sha2/sha2_api.h"
+#include "fuzz.h"
+
+typedef struct {
+	const char *name;
+	size_t mdlen;
+	void (*init256)(sha256_t *);			//	one of these two
+	void (*init512)(sha512_t *);
+	void (*hash)(uint8_t *md, const void *m, size_t mlen);
+	void (*hash_v)(uint8_t *md, const struct iovec *iov, size_t n);
+} fuzz_sha2_t;
+
+static const fuzz_sha2_t fuzz_sha2_tab[] = {
+	{ "SHA2-224", 28, sha224_init, NULL, sha2_224, sha2_224_v },
+	{ "SHA2-256", 32, sha256_init, NULL, sha2_256, sha2_256_v },
+	{ "SHA2-384", 48, NULL, sha384_init, sha2_384, sha2_384_v },
+	{ "SHA2-512", 64, NULL, sha512_init, sha2_512, sha2_512_v },
+	{ "SHA2-512/224", 28, NULL, sha512_224_init, sha2_512_224,
+	  sha2_512_224_v },
+	{ "SHA2-512/256", 32, NULL, sha512_256_init, sha2_512_256,
+	  sha2_512_256_v },
+	{ NULL, 0, NULL, NULL, NULL, NULL }
+};
+
+static void (*const fuzz_cf512[])(void *) = {
+#ifdef RVKINTRIN_RV64
+	sha2_cf512_rvk64,
+#endif
+#ifdef RVKINTRIN_RV32
+	sha2_cf512_rvk32,
+#endif
+	NULL
+};
+
+#define FUZZ_SHA2_SEGS 4
+
+void fuzz_sha2(fuzz_in_t *in)
+{
+	const fuzz_sha2_t *h;
+	uint64_t s0[8 + 16], s[8 + 16];
+	uint32_t t[8 + 16], wk[64];
+	uint8_t md0[6][64], md[64], m[4096];
+	size_t seg[FUZZ_SHA2_SEGS], i, j, k, n;
+	struct iovec v[FUZZ_SHA2_SEGS];
+	union {
+		sha256_t s256;
+		sha512_t s512;
+	} c;
+
+	memset(s0, 0, sizeof(s0));
+	fuzz_copy(in, s0, sizeof(s0));
+
+	//	SHA-512 compression of an arbitrary state and block
+	for (i = 0; fuzz_cf512[i] != NULL; i++) {
+		memcpy(s, s0, sizeof(s));
+		fuzz_cf512[i](s);
+		if (i == 0)
+			memcpy(md0[0], s, 64);
+		FUZZ_CHECK(memcmp(s, md0[0], 64) == 0, "sha2_cf512");
+	}
+
+	//	SHA-256 with the message schedule computed separately
+	memcpy(t, s0, sizeof(t));
+	sha2_cf256_rvk(t);
+	memcpy(md0[0], t, 32);
+	memcpy(t, s0, sizeof(t));
+	sha2_wk256_rvk(wk, (const uint8_t *) &t[8]);
+	sha2_cf256_wk_rvk(t, wk);
+	FUZZ_CHECK(memcmp(t, md0[0], 32) == 0, "sha2_cf256_wk_rvk");
+
+	//	segment lengths for the _v and incremental interfaces
+	for (i = 0; i < FUZZ_SHA2_SEGS; i++)
+		seg[i] = fuzz_len(in, 300);
+	n = fuzz_copy(in, m, sizeof(m));
+	for (i = 0, j = 0; i < FUZZ_SHA2_SEGS; i++) {
+		seg[i] = i + 1 < FUZZ_SHA2_SEGS ? seg[i] % (n - j + 1) : n - j;
+		v[i].iov_base = m + j;
+		v[i].iov_len = seg[i];
+		j += seg[i];
+	}
+
+	sha256_compress = sha2_cf256_rvk;
+	sha256_schedule = sha2_wk256_rvk;
+	sha256_compress_wk = sha2_cf256_wk_rvk;
+	for (i = 0; fuzz_cf512[i] != NULL; i++) {
+		sha512_compress = fuzz_cf512[i];
+		for (k = 0, h = fuzz_sha2_tab; h->name != NULL; k++, h++) {
+			if (i > 0 && h->init256 != NULL)	//	no SHA-512 here
+				continue;
+			h->hash(md, m, n);
+			if (i == 0)
+				memcpy(md0[k], md, h->mdlen);
+			FUZZ_CHECK(memcmp(md, md0[k], h->mdlen) == 0, h->name);
+
+			h->hash_v(md, v, FUZZ_SHA2_SEGS);
+			FUZZ_CHECK(memcmp(md, md0[k], h->mdlen) == 0, h->name);
+
+			if (h->init256 != NULL) {
+				h->init256(&c.s256);
+				for (j = 0; j < FUZZ_SHA2_SEGS; j++)
+					sha256_update(&c.s256, v[j].iov_base, seg[j]);
+				sha256_final_len(&c.s256, md, h->mdlen);
+			} else {
+				h->init512(&c.s512);
+				for (j = 0; j < FUZZ_SHA2_SEGS; j++)
+					sha512_update(&c.s512, v[j].iov_base, seg[j]);
+				sha512_final_len(&c.s512, md, h->mdlen);
+			}
+			FUZZ_CHECK(memcmp(md, md0[k], h->mdlen) == 0, h->name);
+		}
+	}
+}
@@ -0,0 +1,162 @@
+//	fuzz_sha3.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	SHA-3 differential fuzz target: the 24- and 12-round permutations of
+//	the rvb32 and rvb64 backends on arbitrary states, and SHA-3, SHAKE and
+//	KangarooTwelve through their one-shot, scatter-gather and incremental
+//	interfaces with each backend.
+
+#include <string.h>
+
+#include "riscv_crypto.h"
+#include "sha3/sha3_api.h"
+#include "sha3/kangaroo12.h"
+#include "fuzz.h"
+
+static const struct {
+	void (*p24)(void *);
+	void (*p12)(void *);
+} fuzz_f1600[] = {
+#ifdef RVKINTRIN_RV64
+	{ sha3_f1600_rvb64, sha3_p1600_12_rvb64 },
+#endif
+#ifdef RVKINTRIN_RV32
+	{ sha3_f1600_rvb32, sha3_p1600_12_rvb32 },
+#endif
+	{ NULL, NULL }
+};
+
+//	SHA3-224 .. SHA3-512 and SHAKE128/256 (as mdlen for sha3_init)
+
+static const struct {
+	const char *name;
+	int mdlen;
+	int xof;
+} fuzz_sha3_tab[6] = {
+	{ "SHA3-224", 28, 0 }, { "SHA3-256", 32, 0 },
+	{ "SHA3-384", 48, 0 }, { "SHA3-512", 64, 0 },
+	{ "SHAKE128", 16, 1 }, { "SHAKE256", 32, 1 }
+};
+
+#define FUZZ_SHA3_SEGS 4
+#define FUZZ_SHA3_OUT 512
+#define FUZZ_KT128_MAX (2 * KT128_CHUNK + 512)
+
+void fuzz_sha3(fuzz_in_t *in)
+{
+	static uint8_t km[FUZZ_KT128_MAX];
+	uint64_t s0[25], s[25], t24[25], t12[25];
+	uint8_t m[4096], md0[FUZZ_SHA3_OUT], md[FUZZ_SHA3_OUT];
+	size_t seg[FUZZ_SHA3_SEGS], out[FUZZ_SHA3_SEGS], i, j, n, o, l, olen,
+		klen;
+	struct iovec v[FUZZ_SHA3_SEGS];
+	sha3_ctx_t c;
+	kt128_ctx_t kc;
+	int a;
+
+	memset(s0, 0, sizeof(s0));
+	fuzz_copy(in, s0, sizeof(s0));
+
+	//	permutations
+	for (i = 0; fuzz_f1600[i].p24 != NULL; i++) {
+		memcpy(s, s0, sizeof(s));
+		fuzz_f1600[i].p24(s);
+		if (i == 0)
+			memcpy(t24, s, sizeof(s));
+		FUZZ_CHECK(memcmp(s, t24, sizeof(s)) == 0, "Keccak-f[1600]");
+		memcpy(s, s0, sizeof(s));
+		fuzz_f1600[i].p12(s);
+		if (i == 0)
+			memcpy(t12, s, sizeof(s));
+		FUZZ_CHECK(memcmp(s, t12, sizeof(s)) == 0, "Keccak-p[1600,12]");
+	}
+
+	//	algorithm, output length and split points
+	a = fuzz_byte(in) % 6;
+	olen = fuzz_sha3_tab[a].xof ? 1 + fuzz_len(in, FUZZ_SHA3_OUT - 1) :
+		(size_t) fuzz_sha3_tab[a].mdlen;
+	for (i = 0; i < FUZZ_SHA3_SEGS; i++) {
+		seg[i] = fuzz_len(in, 300);
+		out[i] = fuzz_len(in, 200);
+	}
+	klen = fuzz_byte(in) & 7 ? 0 : fuzz_len(in, FUZZ_KT128_MAX);
+	n = fuzz_copy(in, m, sizeof(m));
+	for (i = 0, j = 0; i < FUZZ_SHA3_SEGS; i++) {
+		seg[i] = i + 1 < FUZZ_SHA3_SEGS ? seg[i] % (n - j + 1) : n - j;
+		v[i].iov_base = m + j;
+		v[i].iov_len = seg[i];
+		j += seg[i];
+	}
+
+	for (i = 0; fuzz_f1600[i].p24 != NULL; i++) {
+		sha3_keccakp = fuzz_f1600[i].p24;
+		sha3_keccakp12 = fuzz_f1600[i].p12;
+
+		//	one-shot
+		if (fuzz_sha3_tab[a].xof) {
+			sha3_init(&c, fuzz_sha3_tab[a].mdlen);
+			sha3_update(&c, m, n);
+			shake_xof(&c);
+			shake_out(md, olen, &c);
+		} else {
+			sha3(md, olen, m, n);
+		}
+		if (i == 0)
+			memcpy(md0, md, olen);
+		FUZZ_CHECK(memcmp(md, md0, olen) == 0, fuzz_sha3_tab[a].name);
+
+		//	incremental absorb (and squeeze)
+		sha3_init(&c, fuzz_sha3_tab[a].mdlen);
+		for (j = 0; j < FUZZ_SHA3_SEGS; j++)
+			sha3_update(&c, v[j].iov_base, seg[j]);
+		if (fuzz_sha3_tab[a].xof) {
+			shake_xof(&c);
+			for (j = 0, o = 0; j < FUZZ_SHA3_SEGS; j++) {
+				l = out[j] % (olen - o + 1);
+				shake_out(md + o, l, &c);
+				o += l;
+			}
+			shake_out(md + o, olen - o, &c);
+		} else {
+			sha3_final(md, &c);
+		}
+		FUZZ_CHECK(memcmp(md, md0, olen) == 0, fuzz_sha3_tab[a].name);
+
+		//	scatter-gather
+		if (!fuzz_sha3_tab[a].xof) {
+			sha3_v(md, olen, v, FUZZ_SHA3_SEGS);
+			FUZZ_CHECK(memcmp(md, md0, olen) == 0, "sha3_v");
+		}
+	}
+
+	//	KT128; now and then a message of several chunks, made by repeating
+	//	the input. The customization string is the tail of the message.
+	if (klen == 0) {
+		klen = n;
+		memcpy(km, m, n);
+	} else {
+		for (j = 0; j < klen; j++)
+			km[j] = n > 0 ? m[j % n] ^ (uint8_t) (j / n) : (uint8_t) j;
+	}
+	l = seg[0] % (klen + 1);				//	customization string length
+	for (i = 0; fuzz_f1600[i].p24 != NULL; i++) {
+		sha3_keccakp = fuzz_f1600[i].p24;
+		sha3_keccakp12 = fuzz_f1600[i].p12;
+
+		kt128(md, olen, km, klen - l, km + klen - l, l);
+		if (i == 0)
+			memcpy(md0, md, olen);
+		FUZZ_CHECK(memcmp(md, md0, olen) == 0, "KT128");
+
+		kt128_init(&kc);
+		for (j = 0, o = 0; j < FUZZ_SHA3_SEGS; j++) {
+			n = j + 1 < FUZZ_SHA3_SEGS ?
+				(seg[j] * 97) % (klen - l - o + 1) : klen - l - o;
+			kt128_update(&kc, km + o, n);
+			o += n;
+		}
+		kt128_final(md, olen, &kc, km + klen - l, l);
+		FUZZ_CHECK(memcmp(md, md0, olen) == 0, "KT128 incremental");
+	}
+}
@@ -0,0 +1,44 @@
+//	stress.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Helpers for the stress tests (xstress). These are long-running tests
+//	kept out of the unit tests: Monte Carlo, long messages and randomized
+//	differential tests of the backends, with timing output.
+
+#ifndef _STRESS_H_
+#define _STRESS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <time.h>
+
+//	settings from the command line
+extern int stress_long;						//	run the 1 GiB messages
+extern size_t stress_reps;					//	randomized test iterations
+
+//	deterministic pseudorandom numbers (xorshift64*); not for crypto
+uint64_t stress_rand(void);
+void stress_fill(void *p, size_t n);
+
+//	timing: stress_stop() prints seconds, and MB/s and cycles/byte if
+//	"bytes" is nonzero
+typedef struct {
+	clock_t t;
+	uint64_t c;
+} stress_tm_t;
+
+void stress_start(stress_tm_t *tm);
+void stress_stop(stress_tm_t *tm, const char *lab, uint64_t bytes);
+
+//	feed "len" bytes of a repeating "pat" (of "plen" bytes) to "upd" in
+//	pseudorandom-sized, unaligned pieces
+typedef void (*stress_upd_t)(void *ctx, const uint8_t *m, size_t n);
+int stress_feed(stress_upd_t upd, void *ctx, const char *pat, size_t plen,
+				uint64_t len);
+
+//	the suites
+int stress_sha2();							//	stress_sha2.c
+int stress_sha3();							//	stress_sha3.c
+
+#endif	//	_STRESS_H_
@@ -0,0 +1,131 @@
+//	stress_main.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	=== Main driver for the stress tests.
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "riscv_crypto.h"
+#include "test_rvkat.h"
+#include "rvk_cycles.h"
+#include "stress.h"
+
+int stress_long = 1;
+size_t stress_reps = 10000;
+
+//	=== Helpers ===
+
+static uint64_t stress_x = 0x243F6A8885A308D3;
+
+uint64_t stress_rand(void)
+{
+	stress_x ^= stress_x >> 12;
+	stress_x ^= stress_x << 25;
+	stress_x ^= stress_x >> 27;
+
+	return stress_x * 0x2545F4914F6CDD1D;
+}
+
+void stress_fill(void *p, size_t n)
+{
+	uint8_t *b = (uint8_t *) p;
+	uint64_t x = 0;
+	size_t i;
+
+	for (i = 0; i < n; i++) {
+		if ((i & 7) == 0)
+			x = stress_rand();
+		b[i] = (uint8_t) x;
+		x >>= 8;
+	}
+}
+
+void stress_start(stress_tm_t *tm)
+{
+	tm->t = clock();
+	tm->c = rvk_cycles();
+}
+
+void stress_stop(stress_tm_t *tm, const char *lab, uint64_t bytes)
+{
+	double s;
+	uint64_t c;
+
+	c = rvk_cycles() - tm->c;
+	s = ((double) (clock() - tm->t)) / CLOCKS_PER_SEC;
+
+	printf("[TIME] %s: %.3f s", lab, s);
+	if (bytes > 0) {
+		if (s > 0.0)
+			printf(", %.1f MB/s", 1E-6 * bytes / s);
+		printf(", %.2f " RVK_CYCLES_UNIT "/B", ((double) c) / bytes);
+	}
+	printf("\n");
+	fflush(stdout);
+}
+
+//	a window of the pattern, so that any phase can be fed in one piece
+
+#define STRESS_FEED_MAX	65536
+
+int stress_feed(stress_upd_t upd, void *ctx, const char *pat, size_t plen,
+				uint64_t len)
+{
+	uint8_t *buf;
+	uint64_t pos;
+	size_t i, n;
+
+	buf = (uint8_t *) malloc(STRESS_FEED_MAX + plen);
+	if (buf == NULL)
+		return -1;
+	for (i = 0; i < STRESS_FEED_MAX + plen; i++)
+		buf[i] = pat[i % plen];
+
+	for (pos = 0; pos < len; pos += n) {
+		n = 1 + stress_rand() % STRESS_FEED_MAX;
+		if (n > len - pos)
+			n = len - pos;
+		upd(ctx, buf + pos % plen, n);
+	}
+	free(buf);
+
+	return 0;
+}
+
+//	=== Main ===
+
+int main(int argc, char **argv)
+{
+	int opt, fail = 0;
+
+	while ((opt = getopt(argc, argv, "qn:h")) != -1) {
+		switch (opt) {
+			case 'q':
+				stress_long = 0;
+				break;
+			case 'n':
+				stress_reps = strtoul(optarg, NULL, 0);
+				break;
+			default:
+				fprintf(stderr, "Usage: xstress [-q] [-n reps]\n"
+						"  -q      skip the 1 GiB messages\n"
+						"  -n      randomized test iterations (%zu)\n",
+						stress_reps);
+				return 2;
+		}
+	}
+
+	fail += stress_sha2();
+	fail += stress_sha3();
+
+	if (fail) {
+		rvkat_info("RVKAT stress test finished: FAIL (there were errors)");
+	} else {
+		rvkat_info("RVKAT stress test finished: PASS (no errors)");
+	}
+
+	return fail;
+}
@@ -0,0 +1,470 @@
+//	stress_sha2.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	SHA-2 stress tests: SHAVS Monte Carlo, one million 'a' and the 1 GiB
+//	"extremely long message", and randomized differential tests of the
+//	compression functions against a portable C reference, and of the
+//	one-shot, scatter-gather and incremental interfaces across backends.
+
+#include <string.h>
+#include <stdlib.h>
+
+#include "riscv_crypto.h"
+#include "test_rvkat.h"
+#include "sha2/sha2_api.h"
+#include "stress.h"
+
+//	=== Reference ===
+
+//	reference compression functions on the sha256_t / sha512_t layout:
+//	chaining value in s[0..7], the big-endian message block at &s[8]
+
+static const uint32_t ref_k256[64] = {
+	0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5,
+	0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+	0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3,
+	0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+	0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC,
+	0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+	0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7,
+	0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+	0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13,
+	0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+	0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3,
+	0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+	0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5,
+	0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+	0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208,
+	0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+static const uint64_t ref_k512[80] = {
+	0x428A2F98D728AE22, 0x7137449123EF65CD,
+	0xB5C0FBCFEC4D3B2F, 0xE9B5DBA58189DBBC,
+	0x3956C25BF348B538, 0x59F111F1B605D019,
+	0x923F82A4AF194F9B, 0xAB1C5ED5DA6D8118,
+	0xD807AA98A3030242, 0x12835B0145706FBE,
+	0x243185BE4EE4B28C, 0x550C7DC3D5FFB4E2,
+	0x72BE5D74F27B896F, 0x80DEB1FE3B1696B1,
+	0x9BDC06A725C71235, 0xC19BF174CF692694,
+	0xE49B69C19EF14AD2, 0xEFBE4786384F25E3,
+	0x0FC19DC68B8CD5B5, 0x240CA1CC77AC9C65,
+	0x2DE92C6F592B0275, 0x4A7484AA6EA6E483,
+	0x5CB0A9DCBD41FBD4, 0x76F988DA831153B5,
+	0x983E5152EE66DFAB, 0xA831C66D2DB43210,
+	0xB00327C898FB213F, 0xBF597FC7BEEF0EE4,
+	0xC6E00BF33DA88FC2, 0xD5A79147930AA725,
+	0x06CA6351E003826F, 0x142929670A0E6E70,
+	0x27B70A8546D22FFC, 0x2E1B21385C26C926,
+	0x4D2C6DFC5AC42AED, 0x53380D139D95B3DF,
+	0x650A73548BAF63DE, 0x766A0ABB3C77B2A8,
+	0x81C2C92E47EDAEE6, 0x92722C851482353B,
+	0xA2BFE8A14CF10364, 0xA81A664BBC423001,
+	0xC24B8B70D0F89791, 0xC76C51A30654BE30,
+	0xD192E819D6EF5218, 0xD69906245565A910,
+	0xF40E35855771202A, 0x106AA07032BBD1B8,
+	0x19A4C116B8D2D0C8, 0x1E376C085141AB53,
+	0x2748774CDF8EEB99, 0x34B0BCB5E19B48A8,
+	0x391C0CB3C5C95A63, 0x4ED8AA4AE3418ACB,
+	0x5B9CCA4F7763E373, 0x682E6FF3D6B2B8A3,
+	0x748F82EE5DEFB2FC, 0x78A5636F43172F60,
+	0x84C87814A1F0AB72, 0x8CC702081A6439EC,
+	0x90BEFFFA23631E28, 0xA4506CEBDE82BDE9,
+	0xBEF9A3F7B2C67915, 0xC67178F2E372532B,
+	0xCA273ECEEA26619C, 0xD186B8C721C0C207,
+	0xEADA7DD6CDE0EB1E, 0xF57D4F7FEE6ED178,
+	0x06F067AA72176FBA, 0x0A637DC5A2C898A6,
+	0x113F9804BEF90DAE, 0x1B710B35131C471B,
+	0x28DB77F523047D84, 0x32CAAB7B40C72493,
+	0x3C9EBE0A15C9BEBC, 0x431D67C49C100D4C,
+	0x4CC5D4BECB3E42B6, 0x597F299CFC657E2A,
+	0x5FCB6FAB3AD6FAEC, 0x6C44198C4A475817
+};
+
+#define ROR32(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+#define ROR64(x, n) (((x) >> (n)) | ((x) << (64 - (n))))
+
+static void ref_cf256(void *s)
+{
+	uint32_t *sp = (uint32_t *) s;
+	const uint8_t *mp = (const uint8_t *) (sp + 8);
+	uint32_t w[64], v[8], t1, t2;
+	int i;
+
+	for (i = 0; i < 16; i++) {
+		w[i] = (((uint32_t) mp[4 * i]) << 24) |
+			(((uint32_t) mp[4 * i + 1]) << 16) |
+			(((uint32_t) mp[4 * i + 2]) << 8) | ((uint32_t) mp[4 * i + 3]);
+	}
+	for (i = 16; i < 64; i++) {
+		w[i] = w[i - 16] + w[i - 7] +
+			(ROR32(w[i - 15], 7) ^ ROR32(w[i - 15], 18) ^ (w[i - 15] >> 3)) +
+			(ROR32(w[i - 2], 17) ^ ROR32(w[i - 2], 19) ^ (w[i - 2] >> 10));
+	}
+
+	memcpy(v, sp, sizeof(v));
+	for (i = 0; i < 64; i++) {
+		t1 = v[7] + (ROR32(v[4], 6) ^ ROR32(v[4], 11) ^ ROR32(v[4], 25)) +
+			((v[4] & v[5]) ^ (~v[4] & v[6])) + ref_k256[i] + w[i];
+		t2 = (ROR32(v[0], 2) ^ ROR32(v[0], 13) ^ ROR32(v[0], 22)) +
+			((v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]));
+		memmove(v + 1, v, 7 * sizeof(uint32_t));
+		v[4] += t1;
+		v[0] = t1 + t2;
+	}
+	for (i = 0; i < 8; i++)
+		sp[i] += v[i];
+}
+
+static void ref_cf512(void *s)
+{
+	uint64_t *sp = (uint64_t *) s;
+	const uint8_t *mp = (const uint8_t *) (sp + 8);
+	uint64_t w[80], v[8], t1, t2;
+	int i, j;
+
+	for (i = 0; i < 16; i++) {
+		w[i] = 0;
+		for (j = 0; j < 8; j++)
+			w[i] = (w[i] << 8) | mp[8 * i + j];
+	}
+	for (i = 16; i < 80; i++) {
+		w[i] = w[i - 16] + w[i - 7] +
+			(ROR64(w[i - 15], 1) ^ ROR64(w[i - 15], 8) ^ (w[i - 15] >> 7)) +
+			(ROR64(w[i - 2], 19) ^ ROR64(w[i - 2], 61) ^ (w[i - 2] >> 6));
+	}
+
+	memcpy(v, sp, sizeof(v));
+	for (i = 0; i < 80; i++) {
+		t1 = v[7] + (ROR64(v[4], 14) ^ ROR64(v[4], 18) ^ ROR64(v[4], 41)) +
+			((v[4] & v[5]) ^ (~v[4] & v[6])) + ref_k512[i] + w[i];
+		t2 = (ROR64(v[0], 28) ^ ROR64(v[0], 34) ^ ROR64(v[0], 39)) +
+			((v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]));
+		memmove(v + 1, v, 7 * sizeof(uint64_t));
+		v[4] += t1;
+		v[0] = t1 + t2;
+	}
+	for (i = 0; i < 8; i++)
+		sp[i] += v[i];
+}
+
+//	=== Algorithms and backends ===
+
+typedef struct {
+	const char *name;
+	size_t mdlen;
+	void (*init256)(sha256_t *);			//	one of these two
+	void (*init512)(sha512_t *);
+	void (*hash)(uint8_t *md, const void *m, size_t mlen);
+	void (*hash_v)(uint8_t *md, const struct iovec *iov, size_t n);
+	const char *mct;						//	Monte Carlo, seed 00 01 02 ..
+	const char *ma;							//	one million 'a'
+	const char *gib;						//	1 GiB message, or NULL
+} stress_sha2_t;
+
+static const stress_sha2_t stress_sha2_tab[] = {
+	{ "SHA2-224", 28, sha224_init, NULL, sha2_224, sha2_224_v,
+	  "EA26B2485EFCE7AF3176205DEF46988AC5CC97BBCF8D38189F2D7225",
+	  "20794655980C91D8BBB4C1EA97618A4BF03F42581948B2EE4EE7AD67",
+	  NULL },
+	{ "SHA2-256", 32, sha256_init, NULL, sha2_256, sha2_256_v,
+	  "7130007FCFCCE9C242775219B64B0A7DEBE03C553BF165E0D7820187158CF17D",
+	  "CDC76E5C9914FB9281A1C7E284D73E67F1809A48A497200E046D39CCC7112CD0",
+	  "50E72A0E26442FE2552DC3938AC58658228C0CBFB1D2CA872AE435266FCD055E" },
+	{ "SHA2-384", 48, NULL, sha384_init, sha2_384, sha2_384_v,
+	  "98FA01F3FBF3D3F13578FA7CA0D4FD47FC58B144C5497B532728A1002D03A393"
+	  "55D09C12F14E608F7434827D6650F129",
+	  "9D0E1809716474CB086E834E310A4A1CED149E9C00F248527972CEC5704C2A5B"
+	  "07B8B3DC38ECC4EBAE97DDD87F3D8985",
+	  NULL },
+	{ "SHA2-512", 64, NULL, sha512_init, sha2_512, sha2_512_v,
+	  "8F9DC356D661494F98B353226B6232C525382CFE6D249A92E9D256996AFEB970"
+	  "C9B682EEB6B99C59D146AA080181CB765F33169F9C6DEFDBDE416D666E44E77B",
+	  "E718483D0CE769644E2E42C7BC15B4638E1F98B13B2044285632A803AFA973EB"
+	  "DE0FF244877EA60A4CB0432CE577C31BEB009C5C2C49AA2E4EADB217AD8CC09B",
+	  "B47C933421EA2DB149AD6E10FCE6C7F93D0752380180FFD7F4629A712134831D"
+	  "77BE6091B819ED352C2967A2E2D4FA5050723C9630691F1A05A7281DBE6C1086" },
+	{ "SHA2-512/224", 28, NULL, sha512_224_init, sha2_512_224, sha2_512_224_v,
+	  "BFF5F8BF6E8CF40C739E0F0B356B43E32AC1EA7581ED22AD0853262A",
+	  "37AB331D76F0D36DE422BD0EDEB22A28ACCD487B7A8453AE965DD287",
+	  NULL },
+	{ "SHA2-512/256", 32, NULL, sha512_256_init, sha2_512_256, sha2_512_256_v,
+	  "9CA5984976D34B04AAF85886FBF41A9B33BDB9DEADC6813DB8437B5EE20A65C8",
+	  "9A59A052930187A97038CAE692F30708AA6491923EF5194394DC68D56C74FB21",
+	  NULL },
+	{ NULL, 0, NULL, NULL, NULL, NULL, NULL, NULL, NULL }
+};
+
+//	the SHA-512 compression functions; SHA-256 has just sha2_cf256_rvk()
+
+static const struct {
+	const char *name;
+	void (*cf)(void *);
+} stress_cf512[] = {
+#ifdef RVKINTRIN_RV64
+	{ "sha2_cf512_rvk64", sha2_cf512_rvk64 },
+#endif
+#ifdef RVKINTRIN_RV32
+	{ "sha2_cf512_rvk32", sha2_cf512_rvk32 },
+#endif
+	{ NULL, NULL }
+};
+
+//	=== Incremental interface ===
+
+typedef union {
+	sha256_t s256;
+	sha512_t s512;
+} stress_sha2_ctx_t;
+
+static void stress_sha2_init(stress_sha2_ctx_t *c, const stress_sha2_t *h)
+{
+	if (h->init256 != NULL)
+		h->init256(&c->s256);
+	else
+		h->init512(&c->s512);
+}
+
+static void stress_upd256(void *ctx, const uint8_t *m, size_t n)
+{
+	sha256_update((sha256_t *) ctx, m, n);
+}
+
+static void stress_upd512(void *ctx, const uint8_t *m, size_t n)
+{
+	sha512_update((sha512_t *) ctx, m, n);
+}
+
+static void stress_sha2_upd(stress_sha2_ctx_t *c, const stress_sha2_t *h,
+							const uint8_t *m, size_t n)
+{
+	if (h->init256 != NULL)
+		stress_upd256(&c->s256, m, n);
+	else
+		stress_upd512(&c->s512, m, n);
+}
+
+static void stress_sha2_final(stress_sha2_ctx_t *c, const stress_sha2_t *h,
+							  uint8_t *md)
+{
+	if (h->init256 != NULL)
+		sha256_final_len(&c->s256, md, h->mdlen);
+	else
+		sha512_final_len(&c->s512, md, h->mdlen);
+}
+
+//	=== Tests ===
+
+//	compression functions against the reference on random states
+
+static int stress_sha2_kern()
+{
+	uint32_t s0[8 + 24], s1[8 + 24], s2[8 + 24], wk[64];
+	uint64_t t0[8 + 24], t1[8 + 24];
+	stress_tm_t tm;
+	size_t r, i;
+	int flag, fail = 0;
+	char lab[80];
+
+	flag = 0;
+	stress_start(&tm);
+	for (r = 0; r < stress_reps; r++) {
+		stress_fill(s0, sizeof(s0));
+		memcpy(s1, s0, sizeof(s0));
+		memcpy(s2, s0, sizeof(s0));
+		ref_cf256(s0);
+		sha2_cf256_rvk(s1);
+		sha2_wk256_rvk(wk, (const uint8_t *) &s2[8]);
+		sha2_cf256_wk_rvk(s2, wk);
+		flag |= memcmp(s0, s1, 32) != 0 || memcmp(s0, s2, 32) != 0;
+	}
+	stress_stop(&tm, "sha2_cf256_rvk() vs. reference", 64 * stress_reps);
+	fail += rvkat_chkret("sha2_cf256_rvk() vs. reference", 0, flag);
+
+	for (i = 0; stress_cf512[i].name != NULL; i++) {
+		snprintf(lab, sizeof(lab), "%s() vs. reference", stress_cf512[i].name);
+		flag = 0;
+		stress_start(&tm);
+		for (r = 0; r < stress_reps; r++) {
+			stress_fill(t0, sizeof(t0));
+			memcpy(t1, t0, sizeof(t0));
+			ref_cf512(t0);
+			stress_cf512[i].cf(t1);
+			flag |= memcmp(t0, t1, 64) != 0;
+		}
+		stress_stop(&tm, lab, 128 * stress_reps);
+		fail += rvkat_chkret(lab, 0, flag);
+	}
+
+	return fail;
+}
+
+//	SHAVS Monte Carlo: MD[i] = H(MD[i-3] || MD[i-2] || MD[i-1]), 100 x 1000
+
+static int stress_sha2_mct(const stress_sha2_t *h, const char *be)
+{
+	uint8_t m[3 * 64], md[64];
+	size_t d = h->mdlen;
+	stress_tm_t tm;
+	int i, j;
+	char lab[80];
+
+	for (i = 0; i < (int) d; i++)
+		md[i] = i;
+
+	stress_start(&tm);
+	for (j = 0; j < 100; j++) {
+		memcpy(m, md, d);
+		memcpy(m + d, md, d);
+		memcpy(m + 2 * d, md, d);
+		for (i = 3; i < 1003; i++) {
+			h->hash(md, m, 3 * d);
+			memmove(m, m + d, 2 * d);
+			memcpy(m + 2 * d, md, d);
+		}
+	}
+	snprintf(lab, sizeof(lab), "%s MCT (%s)", h->name, be);
+	stress_stop(&tm, lab, 100000 * 3 * d);
+
+	return rvkat_chkhex(lab, md, d, h->mct);
+}
+
+//	one million 'a' and the 1 GiB message; fed in random pieces
+
+static const char stress_pat[] =
+	"abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmno";
+
+static int stress_sha2_long(const stress_sha2_t *h, const char *be)
+{
+	stress_sha2_ctx_t c;
+	uint8_t md[64];
+	stress_tm_t tm;
+	uint64_t len;
+	int fail = 0;
+	char lab[80];
+
+	snprintf(lab, sizeof(lab), "%s 1M x 'a' (%s)", h->name, be);
+	stress_sha2_init(&c, h);
+	stress_start(&tm);
+	stress_feed(h->init256 != NULL ? stress_upd256 : stress_upd512,
+				&c, "a", 1, 1000000);
+	stress_sha2_final(&c, h, md);
+	stress_stop(&tm, lab, 1000000);
+	fail += rvkat_chkhex(lab, md, h->mdlen, h->ma);
+
+	if (h->gib == NULL || !stress_long)
+		return fail;
+
+	len = ((uint64_t) 1) << 30;
+	snprintf(lab, sizeof(lab), "%s 1 GiB (%s)", h->name, be);
+	stress_sha2_init(&c, h);
+	stress_start(&tm);
+	stress_feed(h->init256 != NULL ? stress_upd256 : stress_upd512,
+				&c, stress_pat, 64, len);
+	stress_sha2_final(&c, h, md);
+	stress_stop(&tm, lab, len);
+	fail += rvkat_chkhex(lab, md, h->mdlen, h->gib);
+
+	return fail;
+}
+
+//	random messages: one-shot, scatter-gather and incremental hashing
+//	must agree with each other, and across the SHA-512 backends
+
+#define STRESS_MSG_MAX 2048
+
+static int stress_sha2_diff()
+{
+	const stress_sha2_t *h;
+	stress_sha2_ctx_t c;
+	uint8_t m[STRESS_MSG_MAX], md0[6][64], md[64];
+	struct iovec v[3];
+	stress_tm_t tm;
+	size_t r, n, i, j, a, b, l;
+	int k, flag = 0;
+
+	stress_start(&tm);
+	for (r = 0; r < stress_reps / 10; r++) {
+		n = stress_rand() % (STRESS_MSG_MAX + 1);
+		stress_fill(m, n);
+		a = stress_rand() % (n + 1);
+		b = a + stress_rand() % (n - a + 1);
+		v[0].iov_base = m;
+		v[0].iov_len = a;
+		v[1].iov_base = m + a;
+		v[1].iov_len = b - a;
+		v[2].iov_base = m + b;
+		v[2].iov_len = n - b;
+
+		for (i = 0; stress_cf512[i].name != NULL; i++) {
+			sha512_compress = stress_cf512[i].cf;
+			for (k = 0, h = stress_sha2_tab; h->name != NULL; k++, h++) {
+				if (i > 0 && h->init256 != NULL)
+					continue;
+				h->hash(md, m, n);
+				if (i == 0)
+					memcpy(md0[k], md, h->mdlen);
+				flag |= memcmp(md, md0[k], h->mdlen) != 0;
+
+				h->hash_v(md, v, 3);
+				flag |= memcmp(md, md0[k], h->mdlen) != 0;
+
+				stress_sha2_init(&c, h);
+				for (j = 0; j < n; j += l) {
+					l = 1 + stress_rand() % 300;
+					if (l > n - j)
+						l = n - j;
+					stress_sha2_upd(&c, h, m + j, l);
+				}
+				stress_sha2_final(&c, h, md);
+				flag |= memcmp(md, md0[k], h->mdlen) != 0;
+			}
+		}
+	}
+	stress_stop(&tm, "SHA2 interfaces and backends", 0);
+
+	return rvkat_chkret("SHA2 interfaces and backends", 0, flag);
+}
+
+//	SHA2: stress tests
+
+int stress_sha2()
+{
+	const stress_sha2_t *h;
+	size_t i;
+	int fail = 0;
+	char lab[80];
+
+	sha256_compress = sha2_cf256_rvk;
+	sha256_schedule = sha2_wk256_rvk;
+	sha256_compress_wk = sha2_cf256_wk_rvk;
+
+	rvkat_info("=== SHA2 compression functions vs. reference ===");
+	fail += stress_sha2_kern();
+
+	for (i = 0; stress_cf512[i].name != NULL; i++) {
+		sha512_compress = stress_cf512[i].cf;
+		snprintf(lab, sizeof(lab), "=== SHA2 using %s() ===",
+				 stress_cf512[i].name);
+		rvkat_info(lab);
+
+		for (h = stress_sha2_tab; h->name != NULL; h++) {
+			if (i > 0 && h->init256 != NULL)	//	done already
+				continue;
+			fail += stress_sha2_mct(h, h->init256 != NULL ?
+									"sha2_cf256_rvk" : stress_cf512[i].name);
+		}
+		for (h = stress_sha2_tab; h->name != NULL; h++) {
+			if (i > 0 && h->init256 != NULL)
+				continue;
+			fail += stress_sha2_long(h, h->init256 != NULL ?
+									 "sha2_cf256_rvk" : stress_cf512[i].name);
+		}
+	}
+
+	rvkat_info("=== SHA2 randomized differential ===");
+	fail += stress_sha2_diff();
+
+	return fail;
+}
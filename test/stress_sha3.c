@@ -0,0 +1,445 @@
+//	stress_sha3.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	SHA-3 and SHAKE stress tests: SHA3VS / SHAKE Monte Carlo, variable
+//	output lengths, long messages, and randomized differential tests of
+//	the Keccak-p backends against a portable C reference.
+
+#include <string.h>
+#include <stdlib.h>
+
+#include "riscv_crypto.h"
+#include "test_rvkat.h"
+#include "sha3/sha3_api.h"
+#include "stress.h"
+
+//	=== Reference ===
+
+//	the last "nr" rounds of Keccak-p[1600] on 25 lanes
+
+#define ROL64(x, n) (((x) << (n)) | ((x) >> (64 - (n))))
+
+static void ref_keccakp(uint64_t s[25], int nr)
+{
+	static const uint64_t rc[24] = {
+		0x0000000000000001, 0x0000000000008082,
+		0x800000000000808A, 0x8000000080008000,
+		0x000000000000808B, 0x0000000080000001,
+		0x8000000080008081, 0x8000000000008009,
+		0x000000000000008A, 0x0000000000000088,
+		0x0000000080008009, 0x000000008000000A,
+		0x000000008000808B, 0x800000000000008B,
+		0x8000000000008089, 0x8000000000008003,
+		0x8000000000008002, 0x8000000000000080,
+		0x000000000000800A, 0x800000008000000A,
+		0x8000000080008081, 0x8000000000008080,
+		0x0000000080000001, 0x8000000080008008
+	};
+	static const int rho[24] = {
+		1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 2, 14,
+		27, 41, 56, 8, 25, 43, 62, 18, 39, 61, 20, 44
+	};
+	static const int pi[24] = {
+		10, 7, 11, 17, 18, 3, 5, 16, 8, 21, 24, 4,
+		15, 23, 19, 13, 12, 2, 20, 14, 22, 9, 6, 1
+	};
+	uint64_t t, bc[5];
+	int i, j, r;
+
+	for (r = 24 - nr; r < 24; r++) {
+
+		//	theta
+		for (i = 0; i < 5; i++)
+			bc[i] = s[i] ^ s[i + 5] ^ s[i + 10] ^ s[i + 15] ^ s[i + 20];
+		for (i = 0; i < 5; i++) {
+			t = bc[(i + 4) % 5] ^ ROL64(bc[(i + 1) % 5], 1);
+			for (j = 0; j < 25; j += 5)
+				s[j + i] ^= t;
+		}
+
+		//	rho and pi
+		t = s[1];
+		for (i = 0; i < 24; i++) {
+			j = pi[i];
+			bc[0] = s[j];
+			s[j] = ROL64(t, rho[i]);
+			t = bc[0];
+		}
+
+		//	chi
+		for (j = 0; j < 25; j += 5) {
+			for (i = 0; i < 5; i++)
+				bc[i] = s[j + i];
+			for (i = 0; i < 5; i++)
+				s[j + i] ^= (~bc[(i + 1) % 5]) & bc[(i + 2) % 5];
+		}
+
+		//	iota
+		s[0] ^= rc[r];
+	}
+}
+
+//	=== Algorithms and backends ===
+
+typedef struct {
+	const char *name;
+	int mdlen;								//	SHAKE: security level
+	int xof;
+	int olen;								//	output for the long tests
+	const char *mct;						//	Monte Carlo, seed 00 01 02 ..
+	int mctlen;								//	SHAKE: final output length
+	const char *vot;						//	SHAKE: variable output
+	const char *ma;							//	one million 'a'
+	const char *gib;						//	1 GiB message, or NULL
+} stress_sha3_t;
+
+static const stress_sha3_t stress_sha3_tab[] = {
+	{ "SHA3-224", 28, 0, 28,
+	  "9D6A8DDFF698641052C77D2B2B66E4B03CA2117A2EDCB4CEB3FAC9DC", 0, NULL,
+	  "D69335B93325192E516A912E6D19A15CB51C6ED5C15243E7A7FD653C",
+	  NULL },
+	{ "SHA3-256", 32, 0, 32,
+	  "830AE73DDB0987E4313536121121989818A24D5BBF31DC5B5348070643D34FFB",
+	  0, NULL,
+	  "5C8875AE474A3634BA4FD55EC85BFFD661F32ACA75C6D699D0CDCB6C115891C1",
+	  "ECBBC42CBF296603ACB2C6BC0410EF4378BAFB24B710357F12DF607758B33E2B" },
+	{ "SHA3-384", 48, 0, 48,
+	  "D4E0E43F224665D6EFCC78DF99C5E2CB554CBCFE6D5DE57F1A0A0D4F2D3A1A4D"
+	  "498D0725DED9659F86375C6AD486E9FB", 0, NULL,
+	  "EEE9E24D78C1855337983451DF97C8AD9EEDF256C6334F8E948D252D5E0E7684"
+	  "7AA0774DDB90A842190D2C558B4B8340",
+	  NULL },
+	{ "SHA3-512", 64, 0, 64,
+	  "3C54A611395CBCE196A582F37E0E0AF2E1FCC5A94A31469F1F7D6A3DDD47FFBB"
+	  "3BD8C55243ECD0981BCF3A804D5B5949778FA9E81F7CD35B9ED11A6E60E4B7AB",
+	  0, NULL,
+	  "3C3A876DA14034AB60627C077BB98F7E120A2A5370212DFFB3385A18D4F38859"
+	  "ED311D0A9D5141CE9CC5C66EE689B266A8AA18ACE8282A0E0DB596C90B0A7B87",
+	  NULL },
+	{ "SHAKE128", 16, 1, 32,				//	MCT: first 32 bytes
+	  "45E91319B0D4F53ACA8499B48E2EA4961E6DFD413C14D9F0DEAC9C7789C8C473",
+	  281,
+	  "7561C678196E1A207C3409ABE0B7194253FC733BFC096667FB9334BC7CE72102",
+	  "9D222C79C4FF9D092CF6CA86143AA411E369973808EF97093255826C5572EF58",
+	  "F4E546891FA8BACEA5A159301FEEBAA4B67C9DD8D8787D82CAF3B6BD8C5BC363" },
+	{ "SHAKE256", 32, 1, 64,
+	  "A97DB12937ED4C899A2F1518865F3BBB8A2DFBD809FD393D91B0125FD50D2A29",
+	  356,
+	  "791A6D8D6EA55821F6E4FCE58A0BC969E35AF668B3CA6BE7E44D5BD21846D6D8",
+	  "3578A7A4CA9137569CDF76ED617D31BB994FCA9C1BBF8B184013DE8234DFD13A"
+	  "3FD124D4DF76C0A539EE7DD2F6E1EC346124C815D9410E145EB561BCD97B18AB",
+	  NULL },
+	{ NULL, 0, 0, 0, NULL, 0, NULL, NULL, NULL }
+};
+
+static const struct {
+	const char *name;
+	void (*p24)(void *);
+	void (*p12)(void *);
+} stress_f1600[] = {
+#ifdef RVKINTRIN_RV32
+	{ "sha3_f1600_rvb32", sha3_f1600_rvb32, sha3_p1600_12_rvb32 },
+#endif
+#ifdef RVKINTRIN_RV64
+	{ "sha3_f1600_rvb64", sha3_f1600_rvb64, sha3_p1600_12_rvb64 },
+#endif
+	{ NULL, NULL, NULL }
+};
+
+//	one-shot hash or XOF
+
+static void stress_sha3_hash(const stress_sha3_t *h, uint8_t *md,
+							 size_t olen, const uint8_t *m, size_t n)
+{
+	sha3_ctx_t c;
+
+	if (h->xof) {
+		sha3_init(&c, h->mdlen);
+		shake_update(&c, m, n);
+		shake_xof(&c);
+		shake_out(md, olen, &c);
+	} else {
+		sha3(md, h->mdlen, m, n);
+	}
+}
+
+static void stress_upd(void *ctx, const uint8_t *m, size_t n)
+{
+	sha3_update((sha3_ctx_t *) ctx, m, n);
+}
+
+//	=== Tests ===
+
+//	permutations against the reference on random states
+
+static int stress_sha3_kern()
+{
+	uint64_t s0[4 * 25], s1[4 * 25];
+	stress_tm_t tm;
+	size_t r, i;
+	int k, flag, fail = 0;
+	char lab[80];
+
+	for (i = 0; stress_f1600[i].name != NULL; i++) {
+
+		snprintf(lab, sizeof(lab), "%s() vs. reference", stress_f1600[i].name);
+		sha3_keccakp = stress_f1600[i].p24;
+		sha3_keccakp12 = stress_f1600[i].p12;
+		flag = 0;
+		stress_start(&tm);
+		for (r = 0; r < stress_reps; r++) {
+			stress_fill(s0, sizeof(s0));
+			memcpy(s1, s0, sizeof(s0));
+			ref_keccakp(s0, 24);
+			stress_f1600[i].p24(s1);
+			flag |= memcmp(s0, s1, 200) != 0;
+			ref_keccakp(s0, 12);
+			stress_f1600[i].p12(s1);
+			flag |= memcmp(s0, s1, 200) != 0;
+
+			for (k = 0; k < 4; k++)			//	the four-state versions
+				ref_keccakp(s0 + 25 * k, 24);
+			sha3_keccakp4(s1);
+			flag |= memcmp(s0, s1, sizeof(s0)) != 0;
+			for (k = 0; k < 4; k++)
+				ref_keccakp(s0 + 25 * k, 12);
+			sha3_keccakp12x4(s1);
+			flag |= memcmp(s0, s1, sizeof(s0)) != 0;
+		}
+		stress_stop(&tm, lab, 200 * 10 * stress_reps);
+		fail += rvkat_chkret(lab, 0, flag);
+	}
+
+	return fail;
+}
+
+//	SHA3VS Monte Carlo: MD[i] = H(MD[i-1]), 100 x 1000. SHAKE: Msg[i] is
+//	the leftmost 128 bits of Output[i-1] (zero padded), and the next
+//	output length lo + (rightmost 16 bits of Output[i]) mod (hi - lo + 1).
+
+#define STRESS_SHAKE_LO 2
+#define STRESS_SHAKE_HI 512
+
+static int stress_sha3_mct(const stress_sha3_t *h, const char *be)
+{
+	uint8_t m[16], md[STRESS_SHAKE_HI];
+	size_t d, len;
+	stress_tm_t tm;
+	uint64_t tot = 0;
+	int i, j, fail = 0;
+	char lab[80];
+
+	d = h->xof ? 16 : h->mdlen;
+	for (i = 0; i < (int) d; i++)
+		md[i] = i;
+	len = h->xof ? STRESS_SHAKE_HI : d;
+
+	stress_start(&tm);
+	for (j = 0; j < 100; j++) {
+		for (i = 0; i < 1000; i++) {
+			if (h->xof) {
+				memset(m, 0, 16);
+				memcpy(m, md, d < 16 ? d : 16);
+				stress_sha3_hash(h, md, len, m, 16);
+				tot += len;
+				d = len;
+				len = STRESS_SHAKE_LO + (((md[d - 2] << 8) | md[d - 1]) %
+						(STRESS_SHAKE_HI - STRESS_SHAKE_LO + 1));
+			} else {
+				stress_sha3_hash(h, md, d, md, d);
+				tot += d;
+			}
+		}
+	}
+	snprintf(lab, sizeof(lab), "%s MCT (%s)", h->name, be);
+	stress_stop(&tm, lab, tot);
+
+	if (h->xof) {
+		fail += rvkat_chkret(lab, h->mctlen, d);
+		d = 32;
+	}
+	fail += rvkat_chkhex(lab, md, d, h->mct);
+
+	return fail;
+}
+
+//	SHAKE variable output: Msg[i] has i bytes (7 * j + i), output length
+//	1 + (37 * i) mod 600, i = 0 .. 299; all outputs go to SHA3-256
+
+static int stress_shake_vot(const stress_sha3_t *h, const char *be)
+{
+	uint8_t m[300], md[600], acc[32];
+	sha3_ctx_t c;
+	size_t i, j, olen;
+	char lab[80];
+
+	sha3_init(&c, 32);
+	for (i = 0; i < 300; i++) {
+		for (j = 0; j < i; j++)
+			m[j] = (uint8_t) (7 * j + i);
+		olen = 1 + (37 * i) % 600;
+		stress_sha3_hash(h, md, olen, m, i);
+		sha3_update(&c, md, olen);
+	}
+	sha3_final(acc, &c);
+	snprintf(lab, sizeof(lab), "%s VOT (%s)", h->name, be);
+
+	return rvkat_chkhex(lab, acc, 32, h->vot);
+}
+
+//	one million 'a' and the 1 GiB message; fed in random pieces
+
+static const char stress_pat[] =
+	"abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmno";
+
+static void stress_sha3_out(const stress_sha3_t *h, sha3_ctx_t *c,
+							uint8_t *md)
+{
+	if (h->xof) {
+		shake_xof(c);
+		shake_out(md, h->olen, c);
+	} else {
+		sha3_final(md, c);
+	}
+}
+
+static int stress_sha3_long(const stress_sha3_t *h, const char *be)
+{
+	sha3_ctx_t c;
+	uint8_t md[64];
+	stress_tm_t tm;
+	uint64_t len;
+	int fail = 0;
+	char lab[80];
+
+	snprintf(lab, sizeof(lab), "%s 1M x 'a' (%s)", h->name, be);
+	sha3_init(&c, h->mdlen);
+	stress_start(&tm);
+	stress_feed(stress_upd, &c, "a", 1, 1000000);
+	stress_sha3_out(h, &c, md);
+	stress_stop(&tm, lab, 1000000);
+	fail += rvkat_chkhex(lab, md, h->olen, h->ma);
+
+	if (h->gib == NULL || !stress_long)
+		return fail;
+
+	len = ((uint64_t) 1) << 30;
+	snprintf(lab, sizeof(lab), "%s 1 GiB (%s)", h->name, be);
+	sha3_init(&c, h->mdlen);
+	stress_start(&tm);
+	stress_feed(stress_upd, &c, stress_pat, 64, len);
+	stress_sha3_out(h, &c, md);
+	stress_stop(&tm, lab, len);
+	fail += rvkat_chkhex(lab, md, h->olen, h->gib);
+
+	return fail;
+}
+
+//	random messages and output lengths: one-shot, scatter-gather and
+//	incremental absorb and squeeze must agree, across the backends;
+//	a shorter XOF output is a prefix of a longer one
+
+#define STRESS_MSG_MAX 2048
+
+static int stress_sha3_diff()
+{
+	const stress_sha3_t *h;
+	sha3_ctx_t c;
+	uint8_t m[STRESS_MSG_MAX], md0[6][STRESS_MSG_MAX], md[STRESS_MSG_MAX];
+	struct iovec v[3];
+	stress_tm_t tm;
+	size_t r, n, i, j, a, b, l, p, olen;
+	int k, flag = 0;
+
+	stress_start(&tm);
+	for (r = 0; r < stress_reps / 10; r++) {
+		n = stress_rand() % (STRESS_MSG_MAX + 1);
+		stress_fill(m, n);
+		a = stress_rand() % (n + 1);
+		b = a + stress_rand() % (n - a + 1);
+		v[0].iov_base = m;
+		v[0].iov_len = a;
+		v[1].iov_base = m + a;
+		v[1].iov_len = b - a;
+		v[2].iov_base = m + b;
+		v[2].iov_len = n - b;
+		olen = 1 + stress_rand() % STRESS_MSG_MAX;
+
+		for (i = 0; stress_f1600[i].name != NULL; i++) {
+			sha3_keccakp = stress_f1600[i].p24;
+			for (k = 0, h = stress_sha3_tab; h->name != NULL; k++, h++) {
+				l = h->xof ? olen : (size_t) h->mdlen;
+				stress_sha3_hash(h, md, l, m, n);
+				if (i == 0)
+					memcpy(md0[k], md, l);
+				flag |= memcmp(md, md0[k], l) != 0;
+
+				sha3_init(&c, h->mdlen);	//	absorb in pieces
+				for (j = 0; j < n; j += p) {
+					p = 1 + stress_rand() % 300;
+					if (p > n - j)
+						p = n - j;
+					sha3_update(&c, m + j, p);
+				}
+				if (h->xof) {				//	squeeze in pieces
+					shake_xof(&c);
+					for (j = 0; j < l; j += p) {
+						p = 1 + stress_rand() % 300;
+						if (p > l - j)
+							p = l - j;
+						shake_out(md + j, p, &c);
+					}
+				} else {
+					sha3_final(md, &c);
+				}
+				flag |= memcmp(md, md0[k], l) != 0;
+
+				if (h->xof) {				//	prefix
+					p = stress_rand() % (l + 1);
+					stress_sha3_hash(h, md, p, m, n);
+					flag |= memcmp(md, md0[k], p) != 0;
+				} else {
+					sha3_v(md, h->mdlen, v, 3);
+					flag |= memcmp(md, md0[k], l) != 0;
+				}
+			}
+		}
+	}
+	stress_stop(&tm, "SHA3 interfaces and backends", 0);
+
+	return rvkat_chkret("SHA3 interfaces and backends", 0, flag);
+}
+
+//	FIPS 202: stress tests
+
+int stress_sha3()
+{
+	const stress_sha3_t *h;
+	size_t i;
+	int fail = 0;
+	char lab[80];
+
+	rvkat_info("=== Keccak-p permutations vs. reference ===");
+	fail += stress_sha3_kern();
+
+	for (i = 0; stress_f1600[i].name != NULL; i++) {
+		sha3_keccakp = stress_f1600[i].p24;
+		snprintf(lab, sizeof(lab), "=== SHA3 using %s() ===",
+				 stress_f1600[i].name);
+		rvkat_info(lab);
+
+		for (h = stress_sha3_tab; h->name != NULL; h++) {
+			fail += stress_sha3_mct(h, stress_f1600[i].name);
+			if (h->xof)
+				fail += stress_shake_vot(h, stress_f1600[i].name);
+		}
+		for (h = stress_sha3_tab; h->name != NULL; h++)
+			fail += stress_sha3_long(h, stress_f1600[i].name);
+	}
+
+	rvkat_info("=== SHA3 randomized differential ===");
+	fail += stress_sha3_diff();
+
+	return fail;
+}
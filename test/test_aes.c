@@ -4,11 +4,13 @@
 
 //	Unit tests for AES-128/192/256 (FIPS 197)
 
+#include <string.h>
 #include "riscv_crypto.h"
 
 #include "aes/aes_api.h"
 #include "aes/aes_rvk32.h"
 #include "aes/aes_rvk64.h"
+#include "aes/aes_otf_rvk32.h"
 #include "aes/aes_otf_rvk64.h"
 
 #include "test_rvkat.h"
@@ -102,6 +104,152 @@ int test_aes_ecb_tv()
 	return fail;
 }
 
+//	Multi-block ECB against the single-block functions
+
+int test_aes_ecbn()
+{
+	uint8_t pt[7 * 16], ct[7 * 16], xt[7 * 16], key[32];
+	uint32_t rk[AES256_RK_WORDS];
+	size_t i;
+	int flag = 0;
+
+	for (i = 0; i < sizeof(pt); i++)
+		pt[i] = i;
+	for (i = 0; i < sizeof(key); i++)
+		key[i] = 0x5A ^ i;
+
+	aes128_enc_key(rk, key);
+	aes128_enc_ecbn(ct, pt, 7, rk);
+	for (i = 0; i < 7; i++) {
+		aes128_enc_ecb(xt, pt + 16 * i, rk);
+		flag |= memcmp(xt, ct + 16 * i, 16) != 0;
+	}
+	aes128_dec_key(rk, key);
+	aes128_dec_ecbn(xt, ct, 7, rk);
+	flag |= memcmp(xt, pt, sizeof(pt)) != 0;
+
+	aes192_enc_key(rk, key);
+	aes192_enc_ecbn(ct, pt, 7, rk);
+	for (i = 0; i < 7; i++) {
+		aes192_enc_ecb(xt, pt + 16 * i, rk);
+		flag |= memcmp(xt, ct + 16 * i, 16) != 0;
+	}
+	aes192_dec_key(rk, key);
+	aes192_dec_ecbn(xt, ct, 7, rk);
+	flag |= memcmp(xt, pt, sizeof(pt)) != 0;
+
+	aes256_enc_key(rk, key);
+	aes256_enc_ecbn(ct, pt, 7, rk);
+	for (i = 0; i < 7; i++) {
+		aes256_enc_ecb(xt, pt + 16 * i, rk);
+		flag |= memcmp(xt, ct + 16 * i, 16) != 0;
+	}
+	aes256_dec_key(rk, key);
+	aes256_dec_ecbn(xt, ct, 7, rk);
+	flag |= memcmp(xt, pt, sizeof(pt)) != 0;
+
+	return rvkat_chkret("AES-128/192/256 multi-block ECB", 0, flag);
+}
+
+//	Misaligned source and destination against aligned buffers; the
+//	multi-block functions are only tested if "bulk" is set
+
+int test_aes_align(int bulk)
+{
+	uint64_t ab[2 * 19], xb[2 * 19 + 1];
+	uint8_t pt[19 * 16], ct[19 * 16 + 8], *xp, key[16];
+	uint32_t erk[AES128_RK_WORDS], drk[AES128_RK_WORDS];
+	size_t i, j, n;
+	int flag = 0;
+
+	for (i = 0; i < sizeof(pt); i++)
+		pt[i] = 0x3C ^ (5 * i);
+	for (i = 0; i < sizeof(key); i++)
+		key[i] = i;
+	aes128_enc_key(erk, key);
+	aes128_dec_key(drk, key);
+
+	xp = ((uint8_t *) xb);
+	for (n = 1; n <= 19; n += 6) {			//	partial and full batches
+		for (i = 0; i < n; i++)
+			aes128_enc_ecb((uint8_t *) &ab[2 * i], pt + 16 * i, erk);
+		for (i = 0; i < 8; i++) {
+			memcpy(ct + i, pt, 16 * n);
+			for (j = 0; bulk && j < 8; j++) {
+				aes128_enc_ecbn(xp + j, ct + i, n, erk);
+				flag |= memcmp(xp + j, ab, 16 * n) != 0;
+				aes128_dec_ecbn(ct + i, xp + j, n, drk);
+				flag |= memcmp(ct + i, pt, 16 * n) != 0;
+			}
+			aes128_enc_ecb(xp + 7 - i, ct + i, erk);
+			flag |= memcmp(xp + 7 - i, ab, 16) != 0;
+			aes128_dec_ecb(xp + 7 - i, xp + 7 - i, drk);
+			flag |= memcmp(xp + 7 - i, pt, 16) != 0;
+		}
+	}
+
+	return rvkat_chkret("AES-128 misaligned ECB", 0, flag);
+}
+
+//	Combined and batched key schedules against the single-key functions
+
+int test_aes_keys()
+{
+	uint8_t key[3 * 32];
+	uint32_t erk[3 * AES256_RK_WORDS], drk[AES256_RK_WORDS];
+	uint32_t rk[AES256_RK_WORDS];
+	size_t i;
+	int flag = 0, fail = 0;
+
+	for (i = 0; i < sizeof(key); i++)
+		key[i] = 0xA5 ^ (7 * i);
+
+	aes128_encdec_key(erk, drk, key);
+	aes128_enc_key(rk, key);
+	flag |= memcmp(erk, rk, 4 * AES128_RK_WORDS) != 0;
+	aes128_dec_key(rk, key);
+	flag |= memcmp(drk, rk, 4 * AES128_RK_WORDS) != 0;
+
+	aes192_encdec_key(erk, drk, key);
+	aes192_enc_key(rk, key);
+	flag |= memcmp(erk, rk, 4 * AES192_RK_WORDS) != 0;
+	aes192_dec_key(rk, key);
+	flag |= memcmp(drk, rk, 4 * AES192_RK_WORDS) != 0;
+
+	aes256_encdec_key(erk, drk, key);
+	aes256_enc_key(rk, key);
+	flag |= memcmp(erk, rk, 4 * AES256_RK_WORDS) != 0;
+	aes256_dec_key(rk, key);
+	flag |= memcmp(drk, rk, 4 * AES256_RK_WORDS) != 0;
+
+	fail += rvkat_chkret("AES-128/192/256 combined key schedule", 0, flag);
+	flag = 0;
+
+	//	three keys: one interleaved pair and one left over
+	aes128_enc_key_n(erk, key, 3);
+	for (i = 0; i < 3; i++) {
+		aes128_enc_key(rk, key + 16 * i);
+		flag |= memcmp(erk + AES128_RK_WORDS * i, rk,
+					   4 * AES128_RK_WORDS) != 0;
+	}
+	aes192_enc_key_n(erk, key, 3);
+	for (i = 0; i < 3; i++) {
+		aes192_enc_key(rk, key + 24 * i);
+		flag |= memcmp(erk + AES192_RK_WORDS * i, rk,
+					   4 * AES192_RK_WORDS) != 0;
+	}
+	aes256_enc_key_n(erk, key, 3);
+	for (i = 0; i < 3; i++) {
+		aes256_enc_key(rk, key + 32 * i);
+		flag |= memcmp(erk + AES256_RK_WORDS * i, rk,
+					   4 * AES256_RK_WORDS) != 0;
+	}
+
+	fail += rvkat_chkret("AES-128/192/256 batched key schedule", 0, flag);
+
+	return fail;
+}
+
 //	AES implementation tests
 
 int test_aes()
@@ -127,7 +275,50 @@ int test_aes()
 	aes192_dec_ecb = aes192_dec_ecb_rvk32;
 	aes256_dec_ecb = aes256_dec_ecb_rvk32;
 
+	aes128_enc_ecbn = aes128_enc_ecbn_rvk32;
+	aes192_enc_ecbn = aes192_enc_ecbn_rvk32;
+	aes256_enc_ecbn = aes256_enc_ecbn_rvk32;
+
+	aes128_dec_ecbn = aes128_dec_ecbn_rvk32;
+	aes192_dec_ecbn = aes192_dec_ecbn_rvk32;
+	aes256_dec_ecbn = aes256_dec_ecbn_rvk32;
+
+	aes128_encdec_key = aes128_encdec_key_rvk32;
+	aes192_encdec_key = aes192_encdec_key_rvk32;
+	aes256_encdec_key = aes256_encdec_key_rvk32;
+
+	fail += test_aes_ecb_tv();
+	fail += test_aes_ecbn();
+	fail += test_aes_align(1);
+	fail += test_aes_keys();
+
+	rvkat_info("=== AES32 / On-the-fly keying ===");
+
+	aes128_enc_ecb = aes128_enc_otf_rvk32;	//	set UUT = OTF/32
+	aes192_enc_ecb = aes192_enc_otf_rvk32;
+	aes256_enc_ecb = aes256_enc_otf_rvk32;
+
+	aes128_dec_key = aes128_dec_otf_key_rvk32;
+	aes192_dec_key = aes192_dec_otf_key_rvk32;
+	aes256_dec_key = aes256_dec_otf_key_rvk32;
+
+	aes128_dec_ecb = aes128_dec_otf_rvk32;
+	aes192_dec_ecb = aes192_dec_otf_rvk32;
+	aes256_dec_ecb = aes256_dec_otf_rvk32;
+
 	fail += test_aes_ecb_tv();
+
+	aes128_enc_ecb = aes128_enc_ecb_rvk32;	//	restore for ecbn users
+	aes192_enc_ecb = aes192_enc_ecb_rvk32;
+	aes256_enc_ecb = aes256_enc_ecb_rvk32;
+
+	aes128_dec_key = aes128_dec_key_rvk32;
+	aes192_dec_key = aes192_dec_key_rvk32;
+	aes256_dec_key = aes256_dec_key_rvk32;
+
+	aes128_dec_ecb = aes128_dec_ecb_rvk32;
+	aes192_dec_ecb = aes192_dec_ecb_rvk32;
+	aes256_dec_ecb = aes256_dec_ecb_rvk32;
 #endif
 
 #ifdef RVKINTRIN_RV64
@@ -149,7 +340,26 @@ int test_aes()
 	aes192_dec_ecb = aes192_dec_ecb_rvk64;
 	aes256_dec_ecb = aes256_dec_ecb_rvk64;
 
+	aes128_enc_ecbn = aes128_enc_ecbn_rvk64;
+	aes192_enc_ecbn = aes192_enc_ecbn_rvk64;
+	aes256_enc_ecbn = aes256_enc_ecbn_rvk64;
+
+	aes128_dec_ecbn = aes128_dec_ecbn_rvk64;
+	aes192_dec_ecbn = aes192_dec_ecbn_rvk64;
+	aes256_dec_ecbn = aes256_dec_ecbn_rvk64;
+
+	aes128_encdec_key = aes128_encdec_key_rvk64;
+	aes192_encdec_key = aes192_encdec_key_rvk64;
+	aes256_encdec_key = aes256_encdec_key_rvk64;
+
+	aes128_enc_key_n = aes128_enc_key_n_rvk64;
+	aes192_enc_key_n = aes192_enc_key_n_rvk64;
+	aes256_enc_key_n = aes256_enc_key_n_rvk64;
+
 	fail += test_aes_ecb_tv();
+	fail += test_aes_ecbn();
+	fail += test_aes_align(1);
+	fail += test_aes_keys();
 #endif
 
 #ifdef RVKINTRIN_RV64
@@ -159,7 +369,24 @@ int test_aes()
 	aes192_enc_ecb = aes192_enc_otf_rvk64;
 	aes256_enc_ecb = aes256_enc_otf_rvk64;
 
+	aes128_dec_key = aes128_dec_otf_key_rvk64;
+	aes192_dec_key = aes192_dec_otf_key_rvk64;
+	aes256_dec_key = aes256_dec_otf_key_rvk64;
+
+	aes128_dec_ecb = aes128_dec_otf_rvk64;
+	aes192_dec_ecb = aes192_dec_otf_rvk64;
+	aes256_dec_ecb = aes256_dec_otf_rvk64;
+
 	fail += test_aes_ecb_tv();
+	fail += test_aes_align(0);
+
+	aes128_dec_key = aes128_dec_key_rvk64;	//	restore for ecbn users
+	aes192_dec_key = aes192_dec_key_rvk64;
+	aes256_dec_key = aes256_dec_key_rvk64;
+
+	aes128_dec_ecb = aes128_dec_ecb_rvk64;
+	aes192_dec_ecb = aes192_dec_ecb_rvk64;
+	aes256_dec_ecb = aes256_dec_ecb_rvk64;
 #endif
 
 	return fail;
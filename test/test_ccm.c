@@ -0,0 +1,188 @@
+//	test_ccm.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Unit tests for AES-CCM (SP 800-38C Appendix C) and AES-CMAC
+//	(SP 800-38B Appendix D, RFC 4493).
+
+#include <string.h>
+#include "riscv_crypto.h"
+#include "test_rvkat.h"
+
+#include "aes/aes_api.h"
+#include "aes/aes_rvk32.h"
+#include "aes/aes_rvk64.h"
+#include "ccm/ccm_api.h"
+#include "cmac/cmac_api.h"
+
+//	AES-CCM test vectors
+
+int test_ccm_tv()
+{
+	uint8_t k[32], n[16], a[128], pt[128], ct[160], xt[128];
+	size_t i, alen, mlen, nlen;
+	int flag, fail = 0;
+
+	//	SP 800-38C Example 1
+
+	rvkat_gethex(k, sizeof(k), "404142434445464748494A4B4C4D4E4F");
+	nlen = rvkat_gethex(n, sizeof(n), "10111213141516");
+	alen = rvkat_gethex(a, sizeof(a), "0001020304050607");
+	mlen = rvkat_gethex(pt, sizeof(pt), "20212223");
+	aes128_enc_ccm(ct, pt, mlen, a, alen, k, n, nlen, 4);
+	fail += rvkat_chkhex("CCM AES-128 Example 1", ct, mlen + 4,
+		"7162015B4DAC255D");
+
+	//	SP 800-38C Example 2
+
+	nlen = rvkat_gethex(n, sizeof(n), "1011121314151617");
+	alen = rvkat_gethex(a, sizeof(a), "000102030405060708090A0B0C0D0E0F");
+	mlen = rvkat_gethex(pt, sizeof(pt), "202122232425262728292A2B2C2D2E2F");
+	aes128_enc_ccm(ct, pt, mlen, a, alen, k, n, nlen, 6);
+	fail += rvkat_chkhex("CCM AES-128 Example 2", ct, mlen + 6,
+		"D2A1F0E051EA5F62081A7792073D593D1FC64FBFACCD");
+
+	//	SP 800-38C Example 3
+
+	nlen = rvkat_gethex(n, sizeof(n), "101112131415161718191A1B");
+	alen = rvkat_gethex(a, sizeof(a),
+		"000102030405060708090A0B0C0D0E0F10111213");
+	mlen = rvkat_gethex(pt, sizeof(pt),
+		"202122232425262728292A2B2C2D2E2F3031323334353637");
+	aes128_enc_ccm(ct, pt, mlen, a, alen, k, n, nlen, 8);
+	fail += rvkat_chkhex("CCM AES-128 Example 3", ct, mlen + 8,
+		"E3B201A9F5B71A7A9B1CEAECCD97E70B"
+		"6176AAD9A4428AA5484392FBC1B09951");
+	memset(xt, 0, mlen);
+	flag = aes128_dec_vfy_ccm(xt, ct, mlen + 8, a, alen, k, n, nlen, 8) ||
+		memcmp(xt, pt, mlen) != 0;
+	fail += rvkat_chkret("CCM AES-128 Example 3 decrypt", 0, flag);
+	ct[5] ^= 0x01;							//	corrupt it
+	flag = aes128_dec_vfy_ccm(xt, ct, mlen + 8, a, alen, k, n, nlen, 8);
+	fail += rvkat_chkret("CCM AES-128 Example 3 forgery", 1, flag);
+
+	//	AES-256, no AAD, 100-byte payload, 13-byte nonce
+
+	for (i = 0; i < 32; i++)
+		k[i] = i;
+	for (i = 0; i < 100; i++)
+		pt[i] = i;
+	nlen = rvkat_gethex(n, sizeof(n), "00112233445566778899AABBCC");
+	aes256_enc_ccm(ct, pt, 100, NULL, 0, k, n, nlen, 16);
+	fail += rvkat_chkhex("CCM AES-256 100/0", ct, 116,
+		"72453E7B3FBCF9421C19387AF8AEFFA8EF7B03E717C861563DE2DC14F387205A"
+		"468D8578CD44FE728247E7727EE8B91BDF055E16139D56713F5A3C2A4F43C242"
+		"10A5E5BA3758953780FCDE86335423ED85B2A37E4F973B24D2C9A8AE04A14B11"
+		"24ACA16F70A2E78B425241E296E0BE2742F5C2B0");
+	memcpy(xt, ct, 116);					//	in-place
+	flag = aes256_dec_vfy_ccm(xt, xt, 116, NULL, 0, k, n, nlen, 16) ||
+		memcmp(xt, pt, 100) != 0;
+	fail += rvkat_chkret("CCM AES-256 100/0 decrypt", 0, flag);
+
+	//	AES-192, 70 bytes of AAD, no payload
+
+	for (i = 0; i < 70; i++)
+		a[i] = i;
+	aes192_enc_ccm(ct, NULL, 0, a, 70, k, n, nlen, 10);
+	fail += rvkat_chkhex("CCM AES-192 0/70", ct, 10,
+		"BB3E11B09DD5CAA72E4C");
+	flag = aes192_dec_vfy_ccm(xt, ct, 10, a, 70, k, n, nlen, 10);
+	fail += rvkat_chkret("CCM AES-192 0/70 verify", 0, flag);
+
+	//	parameter checks
+
+	flag = aes128_enc_ccm(ct, pt, 16, a, 0, k, n, 6, 16) == 0 ||
+		aes128_enc_ccm(ct, pt, 16, a, 0, k, n, 14, 16) == 0 ||
+		aes128_enc_ccm(ct, pt, 16, a, 0, k, n, 13, 5) == 0 ||
+		aes128_enc_ccm(ct, pt, 16, a, 0, k, n, 13, 18) == 0 ||
+		aes128_dec_vfy_ccm(xt, ct, 3, a, 0, k, n, 13, 4) == 0;
+	fail += rvkat_chkret("CCM parameter checks", 0, flag);
+
+	return fail;
+}
+
+//	AES-CMAC test vectors
+
+int test_cmac_tv()
+{
+	uint8_t k[32], m[64], tag[16];
+	int fail = 0;
+
+	rvkat_gethex(m, sizeof(m),
+		"6BC1BEE22E409F96E93D7E117393172A"
+		"AE2D8A571E03AC9C9EB76FAC45AF8E51"
+		"30C81C46A35CE411E5FBC1191A0A52EF"
+		"F69F2445DF4F9B17AD2B417BE66C3710");
+
+	rvkat_gethex(k, sizeof(k), "2B7E151628AED2A6ABF7158809CF4F3C");
+	aes128_cmac(tag, m, 0, k);
+	fail += rvkat_chkhex("CMAC AES-128 #1", tag, 16,
+		"BB1D6929E95937287FA37D129B756746");
+	aes128_cmac(tag, m, 16, k);
+	fail += rvkat_chkhex("CMAC AES-128 #2", tag, 16,
+		"070A16B46B4D4144F79BDD9DD04A287C");
+	aes128_cmac(tag, m, 40, k);
+	fail += rvkat_chkhex("CMAC AES-128 #3", tag, 16,
+		"DFA66747DE9AE63030CA32611497C827");
+	aes128_cmac(tag, m, 64, k);
+	fail += rvkat_chkhex("CMAC AES-128 #4", tag, 16,
+		"51F0BEBF7E3B9D92FC49741779363CFE");
+
+	rvkat_gethex(k, sizeof(k),
+		"8E73B0F7DA0E6452C810F32B809079E562F8EAD2522C6B7B");
+	aes192_cmac(tag, m, 40, k);
+	fail += rvkat_chkhex("CMAC AES-192 #3", tag, 16,
+		"8A1DE5BE2EB31AAD089A82E6EE908B0E");
+
+	rvkat_gethex(k, sizeof(k),
+		"603DEB1015CA71BE2B73AEF0857D7781"
+		"1F352C073B6108D72D9810A30914DFF4");
+	aes256_cmac(tag, m, 40, k);
+	fail += rvkat_chkhex("CMAC AES-256 #3", tag, 16,
+		"AAF3D8F1DE5640C232F5B169B9C911E6");
+
+	return fail;
+}
+
+//	CCM and CMAC implementation tests
+
+int test_ccm()
+{
+	int fail = 0;
+
+#ifdef RVKINTRIN_RV32
+	rvkat_info("=== AES-CCM, AES-CMAC using aes_rvk32 ===");
+
+	aes128_enc_key = aes128_enc_key_rvk32;	//	set UUT = AES32
+	aes192_enc_key = aes192_enc_key_rvk32;
+	aes256_enc_key = aes256_enc_key_rvk32;
+	aes128_enc_ecb = aes128_enc_ecb_rvk32;
+	aes192_enc_ecb = aes192_enc_ecb_rvk32;
+	aes256_enc_ecb = aes256_enc_ecb_rvk32;
+	aes128_enc_ecbn = aes128_enc_ecbn_rvk32;
+	aes192_enc_ecbn = aes192_enc_ecbn_rvk32;
+	aes256_enc_ecbn = aes256_enc_ecbn_rvk32;
+
+	fail += test_ccm_tv();
+	fail += test_cmac_tv();
+#endif
+
+#ifdef RVKINTRIN_RV64
+	rvkat_info("=== AES-CCM, AES-CMAC using aes_rvk64 ===");
+
+	aes128_enc_key = aes128_enc_key_rvk64;	//	set UUT = AES64
+	aes192_enc_key = aes192_enc_key_rvk64;
+	aes256_enc_key = aes256_enc_key_rvk64;
+	aes128_enc_ecb = aes128_enc_ecb_rvk64;
+	aes192_enc_ecb = aes192_enc_ecb_rvk64;
+	aes256_enc_ecb = aes256_enc_ecb_rvk64;
+	aes128_enc_ecbn = aes128_enc_ecbn_rvk64;
+	aes192_enc_ecbn = aes192_enc_ecbn_rvk64;
+	aes256_enc_ecbn = aes256_enc_ecbn_rvk64;
+
+	fail += test_ccm_tv();
+	fail += test_cmac_tv();
+#endif
+
+	return fail;
+}
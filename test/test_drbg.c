@@ -0,0 +1,232 @@
+//	test_drbg.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Unit tests for the SP 800-90A DRBGs and the entropy source wrapper.
+
+#include <string.h>
+#include "riscv_crypto.h"
+#include "test_rvkat.h"
+
+#include "aes/aes_api.h"
+#include "aes/aes_rvk32.h"
+#include "aes/aes_rvk64.h"
+#include "sha2/sha2_api.h"
+#include "drbg/drbg_api.h"
+
+#if defined(__unix__) && !defined(RVK_NO_ATFORK)
+#define TEST_FORK
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
+
+//	CTR_DRBG (AES-256, no df) test vectors
+
+int test_ctr_drbg_tv()
+{
+	ctr_drbg_t d;
+	uint8_t ent[48], pers[48], add[16], out[128];
+	size_t i;
+	int flag, fail = 0;
+
+	for (i = 0; i < 48; i++) {
+		ent[i] = i;
+		pers[i] = 0x80 + i;
+	}
+	ctr_drbg_instantiate(&d, ent, pers, 48);
+	ctr_drbg_generate(&d, out, 64, NULL, 0);
+	fail += rvkat_chkhex("CTR_DRBG AES-256 #1", out, 64,
+		"EBD27EC6A7BB9D4B9880E6249B10528CD073D9762FDCE686DA5DB09763DBEC50"
+		"A944DCE1528158937FC3C716B740AD79AADB12B1E551EAB0EA345384F79F3CC2");
+	ctr_drbg_generate(&d, out, 64, NULL, 0);
+	fail += rvkat_chkhex("CTR_DRBG AES-256 #2", out, 64,
+		"90B6D215AD8F7C0D3B948AD668884C5F5F04D032F42D99163E73090F6AA2D5B4"
+		"8C52CC6AFFA45006B6585288C405F40331AAC2C7DD6886F127DEAF759E514321");
+
+	//	reseed and additional input
+
+	ctr_drbg_instantiate(&d, ent, NULL, 0);
+	ctr_drbg_generate(&d, out, 16, NULL, 0);
+	for (i = 0; i < 48; i++)
+		ent[i] = 0x40 + i;
+	ctr_drbg_reseed(&d, ent, (const uint8_t *) "add", 3);
+	for (i = 0; i < 16; i++)
+		add[i] = 0xA0 + i;
+	ctr_drbg_generate(&d, out, 100, add, 16);
+	fail += rvkat_chkhex("CTR_DRBG AES-256 #3", out, 100,
+		"3EE86C443447EE85AF810C04AC1AB04B486F6890175372C36E7D23CA387467C9"
+		"0C5DEE5213F7C0FA22C86D846495CF7727EB4DB40E6F43DBD7BB672F34171045"
+		"D93A165E7F01E4E30FF76C53E06787B77EBE9A4D558FF9E84731C61E41D558B6"
+		"D3A3A7FB");
+
+	//	parameter checks and reseed requirement
+
+	flag = ctr_drbg_instantiate(&d, ent, pers, 49) != -1 ||
+		ctr_drbg_generate(&d, out, 16, pers, 49) != -1 ||
+		ctr_drbg_generate(&d, out, CTR_DRBG_MAX_REQUEST + 1, NULL, 0) != -1;
+	d.rc = CTR_DRBG_RESEED_INTERVAL + 1;
+	flag |= ctr_drbg_generate(&d, out, 16, NULL, 0) != 1;
+	fail += rvkat_chkret("CTR_DRBG parameter checks", 0, flag);
+	ctr_drbg_clear(&d);
+
+	return fail;
+}
+
+//	Hash_DRBG (SHA-256) test vectors
+
+int test_hash_drbg_tv()
+{
+	hash_drbg_t d;
+	uint8_t ent[32], nonce[16], out[128];
+	size_t i;
+	int fail = 0;
+
+	for (i = 0; i < 32; i++)
+		ent[i] = i;
+	for (i = 0; i < 16; i++)
+		nonce[i] = 0x20 + i;
+
+	hash_drbg_instantiate(&d, ent, 32, nonce, 16,
+						  (const uint8_t *) "pers", 4);
+	hash_drbg_generate(&d, out, 64, NULL, 0);
+	fail += rvkat_chkhex("Hash_DRBG SHA-256 #1", out, 64,
+		"86EC693C2083352B90938A4AD5FC12325D1AD830D692DD7DCFBE5DD9B24C482D"
+		"FEC8D3B19D70EDC1F0F47D7729AA76032C9AEDF77D3F9B8E53E8580896229BEC");
+	hash_drbg_generate(&d, out, 64, NULL, 0);
+	fail += rvkat_chkhex("Hash_DRBG SHA-256 #2", out, 64,
+		"0AC399B1389AE081E782B67FE7FACBB6D7ECB1BE926D21B304D13D3622661946"
+		"4B0E1C305B2B6CC62FA1A4EDB56AF146B05684B8BF3D4C77E45EEE3DCF2746C6");
+
+	//	reseed and additional input
+
+	hash_drbg_instantiate(&d, ent, 32, nonce, 16, NULL, 0);
+	for (i = 0; i < 32; i++)
+		ent[i] = 0x40 + i;
+	hash_drbg_reseed(&d, ent, 32, (const uint8_t *) "more", 4);
+	hash_drbg_generate(&d, out, 100, (const uint8_t *) "add", 3);
+	fail += rvkat_chkhex("Hash_DRBG SHA-256 #3", out, 100,
+		"D7536B6ECAC6AB49E25B650E48B3010192044E964F85900F16C45FF13BE2B514"
+		"843653D2F70C2F143537E392495A888197DBEF25BD73039CB28F855D994977E0"
+		"CC69FA4FCAEFB2318686E3AB55E91578001105FE9E418F8950B29B00CCEB38DC"
+		"785CFC19");
+	hash_drbg_clear(&d);
+
+	return fail;
+}
+
+//	mock entropy sources for the error paths
+
+static uint32_t es16_seed_dead(void)
+{
+	return (uint32_t) ES16_DEAD << 30;
+}
+
+static uint32_t es16_seed_wait(void)
+{
+	return (uint32_t) ES16_WAIT << 30;
+}
+
+int test_es16_rnd()
+{
+	uint32_t (*es16_save)(void) = es16_seed;
+	uint8_t a[100], b[100];
+	size_t i;
+	int flag, fail = 0;
+
+	es16_seed = es16_seed_dead;
+	fail += rvkat_chkret("ES16 DEAD", -1, es16_get_seed(a, 32));
+	es16_seed = es16_seed_wait;
+	fail += rvkat_chkret("ES16 poll timeout", -2, es16_get_seed(a, 32));
+
+	//	no entropy: rvk_random() fails rather than run unseeded
+	es16_seed = es16_seed_none;
+	rvk_random_reset();
+	fail += rvkat_chkret("rvk_random() without entropy", -1,
+						 rvk_random(a, 16));
+	es16_seed = es16_save;
+
+	memset(a, 0, sizeof(a));
+	memset(b, 0, sizeof(b));
+	flag = rvk_random(a, sizeof(a)) != 0 || rvk_random(b, sizeof(b)) != 0 ||
+		memcmp(a, b, sizeof(a)) == 0;
+	fail += rvkat_chkret("rvk_random()", 0, flag);
+
+	//	small requests from the cache, across a refill and a reset
+
+	flag = 0;
+	for (i = 0; i < RVK_RANDOM_CACHE / 12 + 8; i++) {
+		if (i == 300)
+			rvk_random_reset();
+		memcpy(b, a, 12);
+		flag |= rvk_random(a, 12) != 0 || memcmp(a, b, 12) == 0;
+	}
+	fail += rvkat_chkret("rvk_random() cached", 0, flag);
+
+#ifdef TEST_FORK
+	//	two forked children and the parent all draw from the (inherited)
+	//	cache; each must get different output
+
+	flag = 0;
+	for (i = 0; i < 2; i++) {
+		int fd[2], st;
+		pid_t pid;
+
+		if (pipe(fd) != 0) {
+			flag = 1;
+			break;
+		}
+		pid = fork();
+		if (pid == 0) {
+			close(fd[0]);
+			st = rvk_random(a, 16) != 0 ||
+				write(fd[1], a, 16) != 16;
+			_exit(st);
+		}
+		close(fd[1]);
+		flag |= pid < 0 || read(fd[0], b + 16 * i, 16) != 16 ||
+			waitpid(pid, &st, 0) != pid || st != 0;
+		close(fd[0]);
+	}
+	flag |= rvk_random(a, 16) != 0 ||
+		memcmp(a, b, 16) == 0 || memcmp(a, b + 16, 16) == 0 ||
+		memcmp(b, b + 16, 16) == 0;
+	fail += rvkat_chkret("rvk_random() after fork", 0, flag);
+#endif
+
+	return fail;
+}
+
+//	DRBG tests
+
+int test_drbg()
+{
+	int fail = 0;
+
+	sha256_compress = sha2_cf256_rvk;
+
+#ifdef RVKINTRIN_RV32
+	rvkat_info("=== CTR_DRBG, Hash_DRBG using aes_rvk32 ===");
+
+	aes256_enc_key = aes256_enc_key_rvk32;	//	set UUT = AES32
+	aes256_enc_ecb = aes256_enc_ecb_rvk32;
+	aes256_enc_ecbn = aes256_enc_ecbn_rvk32;
+
+	fail += test_ctr_drbg_tv();
+	fail += test_hash_drbg_tv();
+	fail += test_es16_rnd();
+#endif
+
+#ifdef RVKINTRIN_RV64
+	rvkat_info("=== CTR_DRBG, Hash_DRBG using aes_rvk64 ===");
+
+	aes256_enc_key = aes256_enc_key_rvk64;	//	set UUT = AES64
+	aes256_enc_ecb = aes256_enc_ecb_rvk64;
+	aes256_enc_ecbn = aes256_enc_ecbn_rvk64;
+
+	fail += test_ctr_drbg_tv();
+	fail += test_hash_drbg_tv();
+	fail += test_es16_rnd();
+#endif
+
+	return fail;
+}
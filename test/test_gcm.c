@@ -112,6 +112,111 @@ int test_gcm_tv()
 	return fail;
 }
 
+//	scatter-gather GCM against the contiguous interface
+
+int test_gcm_v_tv()
+{
+	const size_t seg[] = { 1, 15, 17, 0, 40, 3, 124 };
+	uint8_t pt[200], ct[216], xt[200], tag[16], k[16], iv[12];
+	struct iovec mv[7], cv[7];
+	size_t i, o;
+	int flag, fail = 0;
+
+	for (i = 0; i < sizeof(pt); i++)
+		pt[i] = i * 7 + 1;
+	for (i = 0; i < 16; i++)
+		k[i] = 0xF0 ^ i;
+	memset(iv, 0xA5, 12);
+
+	o = 0;
+	for (i = 0; i < 7; i++) {
+		mv[i].iov_base = pt + o;
+		mv[i].iov_len = seg[i];
+		cv[i].iov_base = xt + o;
+		cv[i].iov_len = seg[i];
+		o += seg[i];
+	}
+
+	aes128_enc_gcm(ct, pt, sizeof(pt), k, iv);
+	aes128_enc_gcm_v(cv, mv, 7, tag, k, iv);
+	flag = memcmp(xt, ct, sizeof(pt)) != 0 ||
+		memcmp(tag, ct + sizeof(pt), 16) != 0;
+	fail += rvkat_chkret("GCM AES-128 scatter-gather encrypt", 0, flag);
+
+	flag = aes128_dec_vfy_gcm_v(cv, cv, 7, tag, k, iv) != 0 ||
+		memcmp(xt, pt, sizeof(pt)) != 0;	//	in-place
+	fail += rvkat_chkret("GCM AES-128 scatter-gather decrypt", 0, flag);
+
+	tag[RAND_CNST & 15] ^= 0x01;			//	corrupt
+	flag = aes128_dec_vfy_gcm_v(cv, mv, 7, tag, k, iv);
+	fail += rvkat_chkret("GCM AES-128 scatter-gather corrupt", 1, flag);
+
+	return fail;
+}
+
+//	verify-then-decrypt: in place, overlapping, across tiles, and forgery
+
+#define GCM_2P_LEN (2 * 0x4000 + 37)		//	crosses the default GCM_TILE
+
+int test_gcm_2p_tv()
+{
+	static uint8_t pt[GCM_2P_LEN], ct[GCM_2P_LEN + 16];
+	static uint8_t buf[GCM_2P_LEN + 16 + 64];
+	const int shift[] = { 0, 5, -5, 16, -31 };
+	uint8_t k[32], iv[12];
+	size_t i;
+	int flag, fail = 0;
+
+	for (i = 0; i < GCM_2P_LEN; i++)
+		pt[i] = (i * 13) ^ (i >> 9);
+	for (i = 0; i < 32; i++)
+		k[i] = 0x11 * i;
+	memset(iv, 0x5A, 12);
+	aes256_enc_gcm(ct, pt, GCM_2P_LEN, k, iv);
+
+	flag = 0;
+	for (i = 0; i < sizeof(shift) / sizeof(shift[0]); i++) {
+		memcpy(buf + 32, ct, GCM_2P_LEN + 16);
+		flag |= aes256_dec_vfy_gcm(buf + 32 + shift[i], buf + 32,
+								   GCM_2P_LEN + 16, k, iv) != 0 ||
+			memcmp(buf + 32 + shift[i], pt, GCM_2P_LEN) != 0;
+	}
+	fail += rvkat_chkret("GCM AES-256 in-place / overlap decrypt", 0, flag);
+
+	memcpy(buf, ct, GCM_2P_LEN + 16);		//	forgery: no output at all
+	buf[RAND_CNST % GCM_2P_LEN] ^= 0x04;
+	memset(pt, 0xEE, GCM_2P_LEN);
+	flag = aes256_dec_vfy_gcm(pt, buf, GCM_2P_LEN + 16, k, iv) != 1;
+	for (i = 0; i < GCM_2P_LEN; i++)
+		flag |= pt[i] != 0xEE;
+	fail += rvkat_chkret("GCM AES-256 forgery leaves output alone", 0, flag);
+
+	return fail;
+}
+
+//	every registered GHASH backend, and the tuner
+
+int test_gcm_ghash()
+{
+	const ghash_impl_t *g;
+	int fail = 0;
+
+	for (g = ghash_impl; g->name != NULL; g++) {
+		rvkat_info(g->name);
+		ghash_select(g);
+		fail += test_gcm_tv();
+	}
+
+	g = ghash_tune(100);
+	fail += rvkat_chkret("GHASH tuner", 0, g == NULL);
+	if (g != NULL) {
+		rvkat_info(g->name);
+		fail += test_gcm_tv();
+	}
+
+	return fail;
+}
+
 //	GCM implementation tests
 
 int test_gcm()
@@ -122,23 +227,35 @@ int test_gcm()
 	rvkat_info("=== GCM using ghash_mul_rv64() ===");
 	ghash_rev = ghash_rev_rv64;			//	set UUT = ghash_mul_rv64
 	ghash_mul = ghash_mul_rv64;
+	ghash_mul4 = ghash_mul4_rv64;
 	fail += test_gcm_tv();
+	fail += test_gcm_v_tv();
+	fail += test_gcm_2p_tv();
 #endif
 
 #ifdef RVKINTRIN_RV32
 	rvkat_info("=== GCM using ghash_mul_rv32() ===");
 	ghash_rev = ghash_rev_rv32;			//	set UUT = ghash_mul_rv32
 	ghash_mul = ghash_mul_rv32;
+	ghash_mul4 = ghash_mul4_loop;
 	fail += test_gcm_tv();
+	fail += test_gcm_v_tv();
+	fail += test_gcm_2p_tv();
 #endif
 
 #ifdef RVKINTRIN_RV32
 	rvkat_info("=== GCM using ghash_mul_rv32_kar() ===");
 	ghash_rev = ghash_rev_rv32;			//	set UUT = ghash_mul_rv32_kar
 	ghash_mul = ghash_mul_rv32_kar;
+	ghash_mul4 = ghash_mul4_rv32_kar;
 	fail += test_gcm_tv();
+	fail += test_gcm_v_tv();
+	fail += test_gcm_2p_tv();
 #endif
 
+	rvkat_info("=== GCM using the ghash_impl[] backends ===");
+	fail += test_gcm_ghash();
+
 	return fail;
 }
 
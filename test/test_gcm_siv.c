@@ -0,0 +1,147 @@
+//	test_gcm_siv.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Unit tests for POLYVAL and AES-GCM-SIV (RFC 8452 Appendices A and C).
+
+#include <string.h>
+#include "riscv_crypto.h"
+#include "test_rvkat.h"
+
+#include "aes/aes_api.h"
+#include "aes/aes_rvk32.h"
+#include "aes/aes_rvk64.h"
+#include "gcm/gcm_siv_api.h"
+#include "gcm/gcm_gfmul.h"
+
+//	AES-GCM-SIV test vectors
+
+int test_gcm_siv_tv()
+{
+	uint8_t k[32], n[12], a[100], pt[100], ct[116], xt[116];
+	gf128_t z, x, h;
+	size_t i, alen, mlen;
+	int flag, fail = 0;
+
+	//	RFC 8452 Appendix A, POLYVAL of two blocks
+
+	rvkat_gethex(h.b, 16, "25629347589242761D31F826BA4B757B");
+	z.d[0] = 0;
+	z.d[1] = 0;
+	rvkat_gethex(x.b, 16, "4F4F95668C83DFB6401762BB2D01A262");
+	polyval_mul(&z, &x, &h);
+	rvkat_gethex(x.b, 16, "D1A24DDD2721D006BBE45F20D3C9F362");
+	polyval_mul(&z, &x, &h);
+	fail += rvkat_chkhex("POLYVAL", z.b, 16,
+		"F7A3B47B846119FAE5B7866CF5E5B77E");
+
+	//	RFC 8452 C.1, empty message
+
+	rvkat_gethex(k, sizeof(k), "01000000000000000000000000000000");
+	rvkat_gethex(n, sizeof(n), "030000000000000000000000");
+	aes128_enc_gcm_siv(ct, pt, 0, a, 0, k, n);
+	fail += rvkat_chkhex("GCM-SIV AES-128 0/0", ct, 16,
+		"DC20E2D83F25705BB49E439ECA56DE25");
+
+	//	RFC 8452 C.1, 8-byte message
+
+	mlen = rvkat_gethex(pt, sizeof(pt), "0100000000000000");
+	aes128_enc_gcm_siv(ct, pt, mlen, a, 0, k, n);
+	fail += rvkat_chkhex("GCM-SIV AES-128 8/0", ct, mlen + 16,
+		"B5D839330AC7B786578782FFF6013B815B287C22493A364C");
+
+	//	RFC 8452 C.1, 8-byte message with 1 byte of AAD
+
+	mlen = rvkat_gethex(pt, sizeof(pt), "0200000000000000");
+	alen = rvkat_gethex(a, sizeof(a), "01");
+	aes128_enc_gcm_siv(ct, pt, mlen, a, alen, k, n);
+	fail += rvkat_chkhex("GCM-SIV AES-128 8/1", ct, mlen + 16,
+		"1E6DABA35669F4273B0A1A2560969CDF790D99759ABD1508");
+	flag = aes128_dec_vfy_gcm_siv(xt, ct, mlen + 16, a, alen, k, n) ||
+		memcmp(xt, pt, mlen) != 0;
+	fail += rvkat_chkret("GCM-SIV AES-128 8/1 decrypt", 0, flag);
+
+	//	RFC 8452 C.2, 48-byte message
+
+	rvkat_gethex(k, sizeof(k),
+		"01000000000000000000000000000000"
+		"00000000000000000000000000000000");
+	mlen = rvkat_gethex(pt, sizeof(pt),
+		"01000000000000000000000000000000"
+		"02000000000000000000000000000000"
+		"03000000000000000000000000000000");
+	aes256_enc_gcm_siv(ct, pt, mlen, a, 0, k, n);
+	fail += rvkat_chkhex("GCM-SIV AES-256 48/0", ct, mlen + 16,
+		"C00D121893A9FA603F48CCC1CA3C57CE7499245EA0046DB16C53C7C66FE717E3"
+		"9CF6C748837B61F6EE3ADCEE17534ED5790BC96880A99BA804BD12C0E6A22CC4");
+
+	//	100-byte message, 70 bytes of AAD: four-block POLYVAL and tails
+
+	for (i = 0; i < 32; i++)
+		k[i] = i;
+	for (i = 0; i < 100; i++) {
+		pt[i] = i;
+		a[i] = i;
+	}
+	rvkat_gethex(n, sizeof(n), "00112233445566778899AABB");
+
+	aes128_enc_gcm_siv(ct, pt, 100, a, 70, k, n);
+	fail += rvkat_chkhex("GCM-SIV AES-128 100/70", ct, 116,
+		"4C452151289438751FC000A105B89764FF4D76F2C4CCAF89527246F18186E8EF"
+		"FD7466DD1FAB474AD9E82C270DD94C69F02BB5FE68602FB9F835034AA4AC5523"
+		"3DB2D65D77CE643EC4E185EB1CD2442F240C77263160FB477E0E3C22F4430A47"
+		"16B11D7415B7E1A3BC600FDE7F68A08659F6BDA0");
+
+	aes256_enc_gcm_siv(ct, pt, 100, a, 70, k, n);
+	fail += rvkat_chkhex("GCM-SIV AES-256 100/70", ct, 116,
+		"B2E42ADF126E91B23C4EA6A69887EA403C05105B8F239CA809AB59970AE24899"
+		"1A95073F8D988E2657EC66BF57FD3A06F9498956FCDBD2071CECD3E83705E609"
+		"48786EAD841B2D38DD2A276858436BE5846C16208A424EE1B31A6436620D5EA6"
+		"4523F04D94F7ECB4907DE30A18F520816AA4B1A5");
+
+	memcpy(xt, ct, 116);					//	in-place
+	flag = aes256_dec_vfy_gcm_siv(xt, xt, 116, a, 70, k, n) ||
+		memcmp(xt, pt, 100) != 0;
+	fail += rvkat_chkret("GCM-SIV AES-256 100/70 decrypt", 0, flag);
+
+	a[69] ^= 0x01;							//	corrupt AAD
+	flag = aes256_dec_vfy_gcm_siv(xt, ct, 116, a, 70, k, n);
+	fail += rvkat_chkret("GCM-SIV AES-256 100/70 forgery", 1, flag);
+
+	return fail;
+}
+
+//	GCM-SIV implementation tests
+
+int test_gcm_siv()
+{
+	int fail = 0;
+
+#ifdef RVKINTRIN_RV64
+	rvkat_info("=== GCM-SIV using polyval_mul_rv64(), aes_rvk64 ===");
+
+	aes128_enc_key = aes128_enc_key_rvk64;	//	set UUT = AES64
+	aes256_enc_key = aes256_enc_key_rvk64;
+	aes128_enc_ecbn = aes128_enc_ecbn_rvk64;
+	aes256_enc_ecbn = aes256_enc_ecbn_rvk64;
+	polyval_mul = polyval_mul_rv64;			//	set UUT = polyval_mul_rv64
+	polyval_mul4 = polyval_mul4_rv64;
+
+	fail += test_gcm_siv_tv();
+#endif
+
+#ifdef RVKINTRIN_RV32
+	rvkat_info("=== GCM-SIV using polyval_mul_rv32_kar(), aes_rvk32 ===");
+
+	aes128_enc_key = aes128_enc_key_rvk32;	//	set UUT = AES32
+	aes256_enc_key = aes256_enc_key_rvk32;
+	aes128_enc_ecbn = aes128_enc_ecbn_rvk32;
+	aes256_enc_ecbn = aes256_enc_ecbn_rvk32;
+	polyval_mul = polyval_mul_rv32_kar;		//	set UUT = polyval_mul_rv32_kar
+	polyval_mul4 = polyval_mul4_rv32_kar;
+
+	fail += test_gcm_siv_tv();
+#endif
+
+	return fail;
+}
@@ -0,0 +1,253 @@
+//	test_job.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Unit tests for the batched job ring.
+
+#include <string.h>
+#include "riscv_crypto.h"
+#include "test_rvkat.h"
+
+#include "aes/aes_api.h"
+#include "aes/aes_rvk32.h"
+#include "aes/aes_rvk64.h"
+#include "gcm/gcm_api.h"
+#include "gcm/gcm_gfmul.h"
+#include "sha2/sha2_api.h"
+#include "job/job_api.h"
+
+//	a GCM job
+
+static void job_gcm_set(rvk_job_t *j, int alg, int op,
+						const uint8_t *key, size_t klen, const uint8_t *iv,
+						const uint8_t *aad, size_t alen,
+						const uint8_t *src, size_t len,
+						uint8_t *dst, uint8_t *tag)
+{
+	memset(j, 0, sizeof(rvk_job_t));
+	j->alg = alg;
+	j->op = op;
+	j->key = key;
+	j->klen = klen;
+	j->iv = iv;
+	j->aad = aad;
+	j->alen = alen;
+	j->src = src;
+	j->len = len;
+	j->dst = dst;
+	j->tag = tag;
+}
+
+//	known-answer tests, all in one mixed batch
+
+int test_job_tv()
+{
+	uint8_t k1[16], k2[32], k3[16], iv[12], iv3[12], a[20], m[64];
+	uint8_t c1[64], t1[16], c2[64], t2[16], c3[64], t3[16], c4[64], t4[16];
+	uint8_t x1[64], x2[64], md[32], mac[32];
+	rvk_job_t j[8], *done[8];
+	rvk_ring_t r;
+	size_t alen, mlen, m3len, n;
+	int i, fail = 0;
+
+	//	GCM Test Case 4 (AES-128), 10 (AES-192) and 16 (AES-256)
+
+	rvkat_gethex(k1, sizeof(k1), "FEFFE9928665731C6D6A8F9467308308");
+	rvkat_gethex(k2, sizeof(k2), "FEFFE9928665731C6D6A8F9467308308"
+		"FEFFE9928665731C6D6A8F9467308308");
+	rvkat_gethex(iv, sizeof(iv), "CAFEBABEFACEDBADDECAF888");
+	alen = rvkat_gethex(a, sizeof(a),
+		"FEEDFACEDEADBEEFFEEDFACEDEADBEEFABADDAD2");
+	mlen = rvkat_gethex(m, sizeof(m),
+		"D9313225F88406E5A55909C5AFF5269A86A7A9531534F7DA2E4C303D8A318A72"
+		"1C3C0C95956809532FCF0E2449A6B525B16AEDF5AA0DE657BA637B39");
+
+	rvk_ring_init(&r);
+	job_gcm_set(&j[0], RVK_JOB_AES128_GCM, RVK_JOB_ENC, k1, 16, iv,
+		a, alen, m, mlen, c1, t1);
+	job_gcm_set(&j[1], RVK_JOB_AES256_GCM, RVK_JOB_ENC, k2, 32, iv,
+		a, alen, m, mlen, c2, t2);
+
+	//	SM4-GCM, RFC 8998 Appendix A.1
+
+	rvkat_gethex(k3, sizeof(k3), "0123456789ABCDEFFEDCBA9876543210");
+	rvkat_gethex(iv3, sizeof(iv3), "00001234567800000000ABCD");
+	m3len = rvkat_gethex(x2, sizeof(x2),
+		"AAAAAAAAAAAAAAAABBBBBBBBBBBBBBBBCCCCCCCCCCCCCCCCDDDDDDDDDDDDDDDD"
+		"EEEEEEEEEEEEEEEEFFFFFFFFFFFFFFFFEEEEEEEEEEEEEEEEAAAAAAAAAAAAAAAA");
+	job_gcm_set(&j[2], RVK_JOB_SM4_GCM, RVK_JOB_ENC, k3, 16, iv3,
+		a, alen, x2, m3len, c3, t3);
+
+	//	SHA-256 "abc" and HMAC-SHA256 RFC 4231 Test Case 2
+
+	memset(&j[3], 0, sizeof(rvk_job_t));
+	j[3].alg = RVK_JOB_SHA256;
+	j[3].src = (const uint8_t *) "abc";
+	j[3].len = 3;
+	j[3].dst = md;
+	memset(&j[4], 0, sizeof(rvk_job_t));
+	j[4].alg = RVK_JOB_HMAC_SHA256;
+	j[4].key = (const uint8_t *) "Jefe";
+	j[4].klen = 4;
+	j[4].src = (const uint8_t *) "what do ya want for nothing?";
+	j[4].len = 28;
+	j[4].dst = mac;
+
+	//	an invalid job
+	memset(&j[5], 0, sizeof(rvk_job_t));
+	j[5].alg = 99;
+
+	job_gcm_set(&j[6], RVK_JOB_AES192_GCM, RVK_JOB_ENC, k2, 24, iv,
+		a, alen, m, mlen, c4, t4);
+
+	for (i = 0; i < 7; i++)
+		rvk_ring_submit(&r, &j[i]);
+	n = rvk_ring_poll(&r, done, 8);
+
+	fail += rvkat_chkret("Job batch size", 7, n);
+	fail += rvkat_chkhex("Job AES-128-GCM TC4", c1, mlen,
+		"42831EC2217774244B7221B784D0D49CE3AA212F2C02A4E035C17E2329ACA12E"
+		"21D514B25466931C7D8F6A5AAC84AA051BA30B396A0AAC973D58E091");
+	fail += rvkat_chkhex("Job AES-128-GCM TC4 tag", t1, 16,
+		"5BC94FBC3221A5DB94FAE95AE7121A47");
+	fail += rvkat_chkhex("Job AES-192-GCM TC10", c4, mlen,
+		"3980CA0B3C00E841EB06FAC4872A2757859E1CEAA6EFD984628593B40CA1E19C"
+		"7D773D00C144C525AC619D18C84A3F4718E2448B2FE324D9CCDA2710");
+	fail += rvkat_chkhex("Job AES-192-GCM TC10 tag", t4, 16,
+		"2519498E80F1478F37BA55BD6D27618C");
+	fail += rvkat_chkhex("Job AES-256-GCM TC16", c2, mlen,
+		"522DC1F099567D07F47F37A32A84427D643A8CDCBFE5C0C97598A2BD2555D1AA"
+		"8CB08E48590DBB3DA7B08B1056828838C5F61E6393BA7A0ABCC9F662");
+	fail += rvkat_chkhex("Job AES-256-GCM TC16 tag", t2, 16,
+		"76FC6ECE0F4E1768CDDF8853BB2D551B");
+	fail += rvkat_chkhex("Job SM4-GCM RFC 8998", c3, m3len,
+		"17F399F08C67D5EE19D0DC9969C4BB7D5FD46FD3756489069157B282BB200735"
+		"D82710CA5C22F0CCFA7CBF93D496AC15A56834CBCF98C397B4024A2691233B8D");
+	fail += rvkat_chkhex("Job SM4-GCM RFC 8998 tag", t3, 16,
+		"83DE3541E4C2B58177E065A9BF7B62EC");
+	fail += rvkat_chkhex("Job SHA-256", md, 32,
+		"BA7816BF8F01CFEA414140DE5DAE2223B00361A396177A9CB410FF61F20015AD");
+	fail += rvkat_chkhex("Job HMAC-SHA256", mac, 32,
+		"5BDCC146BF60754E6A042426089575C75A003F089D2739839DEC58B964EC3843");
+	fail += rvkat_chkret("Job invalid", RVK_JOB_INVALID, j[5].status);
+
+	//	decrypt (one good, one forged) in the same group
+
+	job_gcm_set(&j[0], RVK_JOB_AES128_GCM, RVK_JOB_DEC, k1, 16, iv,
+		a, alen, c1, mlen, x1, t1);
+	memcpy(t2, t1, 16);
+	t2[15] ^= 0x80;
+	job_gcm_set(&j[1], RVK_JOB_AES128_GCM, RVK_JOB_DEC, k1, 16, iv,
+		a, alen, c1, mlen, x2, t2);
+	rvk_ring_submit(&r, &j[0]);
+	rvk_ring_submit(&r, &j[1]);
+	rvk_ring_poll(&r, done, 8);
+	fail += rvkat_chkret("Job GCM decrypt", 0,
+		j[0].status != RVK_JOB_OK || memcmp(x1, m, mlen) != 0);
+	fail += rvkat_chkret("Job GCM forgery", RVK_JOB_AUTH, j[1].status);
+
+	//	forged empty message without an output buffer
+
+	job_gcm_set(&j[0], RVK_JOB_AES128_GCM, RVK_JOB_DEC, k1, 16, iv,
+		a, alen, NULL, 0, NULL, t2);
+	rvk_ring_submit(&r, &j[0]);
+	rvk_ring_poll(&r, done, 8);
+	fail += rvkat_chkret("Job GCM empty forgery", RVK_JOB_AUTH, j[0].status);
+
+#if SIZE_MAX > 0xFFFFFFFF
+	//	one byte over the GCM plaintext limit of 2^36 - 32 bytes
+
+	job_gcm_set(&j[0], RVK_JOB_AES128_GCM, RVK_JOB_ENC, k1, 16, iv,
+		a, alen, m, ((size_t) 1 << 36) - 31, c1, t1);
+	rvk_ring_submit(&r, &j[0]);
+	rvk_ring_poll(&r, done, 8);
+	fail += rvkat_chkret("Job GCM length limit", RVK_JOB_INVALID,
+		j[0].status);
+#endif
+
+	return fail;
+}
+
+//	a full ring of same-key jobs against the single-message interface
+
+int test_job_batch()
+{
+	static uint8_t m[RVK_RING_SIZE * 40], c[RVK_RING_SIZE * 56];
+	static uint8_t x[RVK_RING_SIZE * 40];
+	uint8_t k[16], iv[12], tag[RVK_RING_SIZE][16];
+	rvk_job_t j[RVK_RING_SIZE + 1], *done[RVK_RING_SIZE];
+	rvk_ring_t r;
+	size_t i, l, o, n;
+	int flag, fail = 0;
+
+	for (i = 0; i < sizeof(m); i++)
+		m[i] = i ^ (i >> 7);
+	for (i = 0; i < 16; i++)
+		k[i] = 0x55 ^ i;
+	memset(iv, 0x3C, 12);
+
+	rvk_ring_init(&r);
+	for (i = 0; i < RVK_RING_SIZE; i++) {
+		l = (7 * i) % 40;					//	0..39 bytes
+		job_gcm_set(&j[i], RVK_JOB_AES128_GCM, RVK_JOB_ENC, k, 16, iv,
+			NULL, 0, m + 40 * i, l, x + 40 * i, tag[i]);
+		j[i].iv = (i & 1) ? iv : k;			//	two nonces
+		rvk_ring_submit(&r, &j[i]);
+	}
+	flag = rvk_ring_submit(&r, &j[RVK_RING_SIZE]) == 0;
+	fail += rvkat_chkret("Job ring full", 0, flag);
+
+	n = rvk_ring_poll(&r, done, RVK_RING_SIZE);
+	flag = n != RVK_RING_SIZE;
+	for (i = 0; i < n; i++) {
+		l = j[i].len;
+		o = 56 * i;
+		aes128_enc_gcm(c + o, m + 40 * i, l, k, j[i].iv);
+		flag |= done[i] != &j[i] || j[i].status != RVK_JOB_OK ||
+			memcmp(c + o, x + 40 * i, l) != 0 ||
+			memcmp(c + o + l, tag[i], 16) != 0;
+	}
+	fail += rvkat_chkret("Job batch == gcm_api", 0, flag);
+	fail += rvkat_chkret("Job ring empty", 0, rvk_ring_poll(&r, done, 1));
+
+	return fail;
+}
+
+int test_job()
+{
+	int fail = 0;
+
+	sha256_compress = sha2_cf256_rvk;
+
+#ifdef RVKINTRIN_RV32
+	rvkat_info("=== Job ring using aes_rvk32 ===");
+
+	aes128_enc_key = aes128_enc_key_rvk32;	//	set UUT = AES32
+	aes256_enc_key = aes256_enc_key_rvk32;
+	aes128_enc_ecb = aes128_enc_ecb_rvk32;
+	aes128_enc_ecbn = aes128_enc_ecbn_rvk32;
+	aes256_enc_ecbn = aes256_enc_ecbn_rvk32;
+	ghash_rev = ghash_rev_rv32;
+	ghash_mul = ghash_mul_rv32_kar;
+
+	fail += test_job_tv();
+	fail += test_job_batch();
+#endif
+
+#ifdef RVKINTRIN_RV64
+	rvkat_info("=== Job ring using aes_rvk64 ===");
+
+	aes128_enc_key = aes128_enc_key_rvk64;	//	set UUT = AES64
+	aes256_enc_key = aes256_enc_key_rvk64;
+	aes128_enc_ecb = aes128_enc_ecb_rvk64;
+	aes128_enc_ecbn = aes128_enc_ecbn_rvk64;
+	aes256_enc_ecbn = aes256_enc_ecbn_rvk64;
+	ghash_rev = ghash_rev_rv64;
+	ghash_mul = ghash_mul_rv64;
+
+	fail += test_job_tv();
+	fail += test_job_batch();
+#endif
+
+	return fail;
+}
@@ -11,9 +11,18 @@
 
 int test_aes();		//	test_aes.c
 int test_gcm();		//	test_gcm.c
+int test_gcm_siv();	//	test_gcm_siv.c
+int test_xts();		//	test_xts.c
+int test_ccm();		//	test_ccm.c
+int test_par();		//	test_par.c
+int test_job();		//	test_job.c
+int test_slab();	//	test_slab.c
+int test_mem();		//	test_mem.c
+int test_drbg();	//	test_drbg.c
 int test_sha2();	//	test_sha2.c
 int test_sha3();	//	test_sha3.c
 int test_sm3();		//	test_sm3.c
+int test_merkle();	//	test_merkle.c
 int test_sm4();		//	test_sm4.c
 int test_present(); //	test_present.c
 int test_zkr(); 	//	test_zkr.c
@@ -26,11 +35,20 @@ int main()
 
 	fail += test_aes();
 	fail += test_gcm();
+	fail += test_gcm_siv();
+	fail += test_xts();
+	fail += test_ccm();
+	fail += test_par();
+	fail += test_job();
+	fail += test_slab();
+	fail += test_mem();
 	fail += test_sha2();
 	fail += test_sha3();
 	fail += test_sm3();
+	fail += test_merkle();
 	fail += test_sm4();
 	fail += test_present();
+	fail += test_drbg();
 #ifdef RVKINTRIN_ZKR
 	fail += test_zkr();
 #endif
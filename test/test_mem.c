@@ -0,0 +1,51 @@
+//	test_mem.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Unit tests for constant-time comparison and zeroization helpers.
+
+#include <string.h>
+#include "riscv_crypto.h"
+#include "test_rvkat.h"
+
+#include "rvk_mem.h"
+
+int test_mem()
+{
+	uint8_t a[37], b[37];
+	size_t i, j;
+	int flag, fail = 0;
+
+	rvkat_info("=== Memory helpers ===");
+
+	for (i = 0; i < sizeof(a); i++) {
+		a[i] = (uint8_t) (0x5A ^ (i * 0x3B));
+	}
+	memcpy(b, a, sizeof(b));
+
+	//	every length (word and tail paths), every byte, every bit
+	flag = 0;
+	for (i = 0; i <= sizeof(a); i++) {
+		flag |= rvk_memeq_ct(a, b, i) != 1;
+		for (j = 0; j < 8 * i; j++) {
+			b[j >> 3] ^= 1 << (j & 7);
+			flag |= rvk_memeq_ct(a, b, i) != 0;
+			b[j >> 3] ^= 1 << (j & 7);
+		}
+	}
+	flag |= rvk_memeq_ct(a + 1, b + 1, sizeof(a) - 1) != 1;
+	fail += rvkat_chkret("rvk_memeq_ct()", 0, flag);
+
+	//	clears exactly the given range
+	memset(b, 0xFF, sizeof(b));
+	rvk_memzero(b + 3, 29);
+	flag = b[2] != 0xFF || b[32] != 0xFF;
+	for (i = 3; i < 32; i++) {
+		flag |= b[i] != 0;
+	}
+	rvk_memzero(b, 0);
+	flag |= b[0] != 0xFF;
+	fail += rvkat_chkret("rvk_memzero()", 0, flag);
+
+	return fail;
+}
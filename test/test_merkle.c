@@ -0,0 +1,135 @@
+//	test_merkle.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Unit tests for the hash tree builder.
+
+#include <string.h>
+#include "riscv_crypto.h"
+#include "test_rvkat.h"
+
+#include "sha2/sha2_api.h"
+#include "sha3/sha3_api.h"
+#include "sm3/sm3_api.h"
+#include "par/par_api.h"
+#include "merkle/merkle_api.h"
+
+//	enough leaves for levels that are split over the pool
+#define MERKLE_TEST_N (4 * RVK_MERKLE_CHUNK + 13)
+
+static uint8_t mk_leaf[MERKLE_TEST_N][32];
+static uint8_t mk_node[2 * MERKLE_TEST_N + RVK_MERKLE_LEVELS][32];
+static uint8_t mk_ref[MERKLE_TEST_N][32];
+
+//	root the slow way: one single-call hash per node, level by level
+
+static void merkle_ref(uint8_t root[32], int alg, size_t n)
+{
+	size_t i;
+
+	memcpy(mk_ref, mk_leaf, 32 * n);
+	while (n > 1) {
+		for (i = 0; i < n / 2; i++) {
+			switch (alg) {
+				case RVK_MERKLE_SHA256:
+					sha2_256(mk_ref[i], mk_ref[2 * i], 64);
+					break;
+				case RVK_MERKLE_SHA3_256:
+					sha3(mk_ref[i], 32, mk_ref[2 * i], 64);
+					break;
+				case RVK_MERKLE_SM3:
+					sm3_256(mk_ref[i], mk_ref[2 * i], 64);
+					break;
+			}
+		}
+		if (n & 1)
+			memcpy(mk_ref[n / 2], mk_ref[n - 1], 32);
+		n = (n + 1) / 2;
+	}
+	memcpy(root, mk_ref[0], 32);
+}
+
+//	build, then update a few leaves, against the reference
+
+static int test_merkle_alg(int alg, size_t n)
+{
+	merkle_t t;
+	uint8_t root[32];
+	size_t i, j;
+	int flag;
+
+	for (i = 0; i < 32 * n; i++)
+		mk_leaf[i / 32][i % 32] = (uint8_t) (i * 0x2F + (i >> 8) + alg);
+
+	flag = merkle_nodes(n) > 2 * MERKLE_TEST_N + RVK_MERKLE_LEVELS;
+	flag |= merkle_init(&t, alg, mk_node, n) != 0;
+	memcpy(mk_node, mk_leaf, 32 * n);
+	merkle_build(&t);
+	merkle_ref(root, alg, n);
+	flag |= memcmp(merkle_root(&t), root, 32) != 0;
+
+	mk_leaf[n / 3][7] ^= 0x01;				//	a single leaf
+	merkle_update(&t, n / 3, &mk_leaf[n / 3], 1);
+	merkle_ref(root, alg, n);
+	flag |= memcmp(merkle_root(&t), root, 32) != 0;
+
+	j = n < 3 ? 0 : n - 3;					//	a range at the end
+	for (i = j; i < n; i++)
+		mk_leaf[i][0] ^= 0x80;
+	merkle_update(&t, j, &mk_leaf[j], n - j);
+	merkle_ref(root, alg, n);
+	flag |= memcmp(merkle_root(&t), root, 32) != 0;
+
+	return flag;
+}
+
+static int test_merkle_run()
+{
+	int flag = 0, fail = 0;
+	merkle_t t;
+
+	flag |= test_merkle_alg(RVK_MERKLE_SHA256, 1);
+	flag |= test_merkle_alg(RVK_MERKLE_SHA256, 7);
+	flag |= test_merkle_alg(RVK_MERKLE_SHA256, MERKLE_TEST_N);
+	fail += rvkat_chkret("Merkle SHA-256", 0, flag);
+
+	flag = test_merkle_alg(RVK_MERKLE_SHA3_256, 6);
+	flag |= test_merkle_alg(RVK_MERKLE_SHA3_256, MERKLE_TEST_N);
+	fail += rvkat_chkret("Merkle SHA3-256", 0, flag);
+
+	flag = test_merkle_alg(RVK_MERKLE_SM3, 5);
+	flag |= test_merkle_alg(RVK_MERKLE_SM3, MERKLE_TEST_N);
+	fail += rvkat_chkret("Merkle SM3", 0, flag);
+
+	flag = merkle_init(&t, 0, mk_node, 4) != -1;
+	flag |= merkle_init(&t, RVK_MERKLE_SM3, mk_node, 0) != -1;
+	fail += rvkat_chkret("Merkle invalid parameters", 0, flag);
+
+	return fail;
+}
+
+int test_merkle()
+{
+	int fail = 0;
+
+	rvkat_info("=== Merkle trees ===");
+
+	sha256_compress = sha2_cf256_rvk;		//	set UUT
+	sha256_schedule = sha2_wk256_rvk;
+	sha256_compress_wk = sha2_cf256_wk_rvk;
+	sm3_compress = sm3_cf256_rvk;
+#ifdef RVKINTRIN_RV64
+	sha3_keccakp = sha3_f1600_rvb64;
+#else
+	sha3_keccakp = sha3_f1600_rvb32;
+#endif
+
+	fail += test_merkle_run();
+	if (rvk_pool_init(4) > 0) {
+		rvkat_info("worker pool: 4 threads");
+		fail += test_merkle_run();
+		rvk_pool_free();
+	}
+
+	return fail;
+}
@@ -0,0 +1,180 @@
+//	test_par.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	The parallel bulk modes must match the serial ones exactly.
+
+#include <string.h>
+#include "riscv_crypto.h"
+#include "test_rvkat.h"
+
+#include "aes/aes_api.h"
+#include "aes/aes_rvk32.h"
+#include "aes/aes_rvk64.h"
+#include "gcm/gcm_api.h"
+#include "gcm/gcm_gfmul.h"
+#include "xts/xts_api.h"
+#include "par/par_api.h"
+
+//	a bit over four chunks
+#define PAR_TEST_LEN (4 * RVK_PAR_CHUNK + 1000)
+
+static uint8_t par_m[PAR_TEST_LEN + 16];
+static uint8_t par_c[PAR_TEST_LEN + 16];
+static uint8_t par_x[PAR_TEST_LEN + 16];
+
+//	serial CTR reference, one block at a time
+
+static void ref_ctr256(uint8_t * d, const uint8_t * s, size_t len,
+					   const uint32_t * rk, const uint8_t ctr[16])
+{
+	uint8_t c[16], b[16];
+	size_t i, j;
+
+	memcpy(c, ctr, 16);
+	for (i = 0; i < len; i += 16) {
+		aes256_enc_ecb(b, c, rk);
+		for (j = 0; j < 16 && i + j < len; j++)
+			d[i + j] = s[i + j] ^ b[j];
+		for (j = 15; j < 16 && ++c[j] == 0; j--)
+			;
+	}
+}
+
+int test_par_eq()
+{
+	const size_t gcm_len[] = { 0, 1, 16, 100, RVK_PAR_CHUNK,
+		RVK_PAR_CHUNK + 5, PAR_TEST_LEN };
+	uint32_t rk[AES256_RK_WORDS];
+	uint8_t k[64], iv[16];
+	size_t i, l;
+	int flag, fail = 0;
+
+	for (i = 0; i < sizeof(par_m); i++)
+		par_m[i] = (i * 0x9D) ^ (i >> 8);
+	for (i = 0; i < 64; i++)
+		k[i] = 0x31 * i + 7;
+	for (i = 0; i < 16; i++)
+		iv[i] = 0xA0 + i;
+
+	//	ECB
+
+	aes256_enc_key(rk, k);
+	aes256_enc_ecbn(par_c, par_m, PAR_TEST_LEN / 16, rk);
+	aes256_enc_ecb_par(par_x, par_m, PAR_TEST_LEN / 16, rk);
+	flag = memcmp(par_c, par_x, PAR_TEST_LEN / 16 * 16) != 0;
+	aes128_enc_key(rk, k);
+	aes128_enc_ecbn(par_c, par_m, PAR_TEST_LEN / 16, rk);
+	aes128_enc_ecb_par(par_x, par_m, PAR_TEST_LEN / 16, rk);
+	flag |= memcmp(par_c, par_x, PAR_TEST_LEN / 16 * 16) != 0;
+	aes128_dec_key(rk, k);
+	aes128_dec_ecb_par(par_x, par_x, PAR_TEST_LEN / 16, rk);
+	flag |= memcmp(par_m, par_x, PAR_TEST_LEN / 16 * 16) != 0;
+	fail += rvkat_chkret("ECB parallel == serial", 0, flag);
+
+	//	CTR, with a carry out of the low 64 counter bits
+
+	aes256_enc_key(rk, k);
+	memset(iv + 8, 0xFF, 6);
+	ref_ctr256(par_c, par_m, PAR_TEST_LEN - 3, rk, iv);
+	aes256_ctr_par(par_x, par_m, PAR_TEST_LEN - 3, rk, iv);
+	flag = memcmp(par_c, par_x, PAR_TEST_LEN - 3) != 0;
+	aes256_ctr_par(par_x, par_x, PAR_TEST_LEN - 3, rk, iv);
+	flag |= memcmp(par_m, par_x, PAR_TEST_LEN - 3) != 0;
+	fail += rvkat_chkret("CTR parallel == serial", 0, flag);
+
+	//	GCM
+
+	flag = 0;
+	for (i = 0; i < sizeof(gcm_len) / sizeof(gcm_len[0]); i++) {
+		l = gcm_len[i];
+		aes256_enc_gcm(par_c, par_m, l, k, iv);
+		aes256_enc_gcm_par(par_x, par_m, l, k, iv);
+		flag |= memcmp(par_c, par_x, l + 16) != 0;
+		flag |= aes256_dec_vfy_gcm_par(par_x, par_c, l + 16, k, iv) != 0 ||
+			memcmp(par_m, par_x, l) != 0;
+		aes128_enc_gcm(par_c, par_m, l, k, iv);
+		aes128_enc_gcm_par(par_x, par_m, l, k, iv);
+		flag |= memcmp(par_c, par_x, l + 16) != 0;
+	}
+	fail += rvkat_chkret("GCM parallel == serial", 0, flag);
+	par_c[RVK_PAR_CHUNK + 77] ^= 0x10;		//	corrupt it
+	flag = aes128_dec_vfy_gcm_par(par_x, par_c, PAR_TEST_LEN + 16, k, iv);
+	fail += rvkat_chkret("GCM parallel forgery", 1, flag);
+
+	//	XTS, 512-byte sectors
+
+	l = PAR_TEST_LEN / 512;
+	aes256_enc_xts_sec(par_c, par_m, 512, l, k, 1000);
+	aes256_enc_xts_sec_par(par_x, par_m, 512, l, k, 1000);
+	flag = memcmp(par_c, par_x, 512 * l) != 0;
+	aes256_dec_xts_sec_par(par_x, par_x, 512, l, k, 1000);
+	flag |= memcmp(par_m, par_x, 512 * l) != 0;
+	aes128_enc_xts_sec(par_c, par_m, 4096, l / 8, k, 7);
+	aes128_enc_xts_sec_par(par_x, par_m, 4096, l / 8, k, 7);
+	flag |= memcmp(par_c, par_x, 4096 * (l / 8)) != 0;
+	fail += rvkat_chkret("XTS parallel == serial", 0, flag);
+
+	return fail;
+}
+
+//	run serially, then on the pool (if built with RVK_PTHREAD)
+
+int test_par_run()
+{
+	int fail = 0;
+
+	fail += test_par_eq();
+	if (rvk_pool_init(4) > 0) {
+		rvkat_info("worker pool: 4 threads");
+		fail += test_par_eq();
+		rvk_pool_free();
+	}
+
+	return fail;
+}
+
+int test_par()
+{
+	int fail = 0;
+
+#ifdef RVKINTRIN_RV32
+	rvkat_info("=== Parallel ECB, CTR, GCM, XTS using aes_rvk32 ===");
+
+	aes128_enc_key = aes128_enc_key_rvk32;	//	set UUT = AES32
+	aes256_enc_key = aes256_enc_key_rvk32;
+	aes128_enc_ecb = aes128_enc_ecb_rvk32;
+	aes256_enc_ecb = aes256_enc_ecb_rvk32;
+	aes128_enc_ecbn = aes128_enc_ecbn_rvk32;
+	aes256_enc_ecbn = aes256_enc_ecbn_rvk32;
+	aes128_dec_key = aes128_dec_key_rvk32;
+	aes256_dec_key = aes256_dec_key_rvk32;
+	aes128_dec_ecbn = aes128_dec_ecbn_rvk32;
+	aes256_dec_ecbn = aes256_dec_ecbn_rvk32;
+	ghash_rev = ghash_rev_rv32;
+	ghash_mul = ghash_mul_rv32_kar;
+
+	fail += test_par_run();
+#endif
+
+#ifdef RVKINTRIN_RV64
+	rvkat_info("=== Parallel ECB, CTR, GCM, XTS using aes_rvk64 ===");
+
+	aes128_enc_key = aes128_enc_key_rvk64;	//	set UUT = AES64
+	aes256_enc_key = aes256_enc_key_rvk64;
+	aes128_enc_ecb = aes128_enc_ecb_rvk64;
+	aes256_enc_ecb = aes256_enc_ecb_rvk64;
+	aes128_enc_ecbn = aes128_enc_ecbn_rvk64;
+	aes256_enc_ecbn = aes256_enc_ecbn_rvk64;
+	aes128_dec_key = aes128_dec_key_rvk64;
+	aes256_dec_key = aes256_dec_key_rvk64;
+	aes128_dec_ecbn = aes128_dec_ecbn_rvk64;
+	aes256_dec_ecbn = aes256_dec_ecbn_rvk64;
+	ghash_rev = ghash_rev_rv64;
+	ghash_mul = ghash_mul_rv64;
+
+	fail += test_par_run();
+#endif
+
+	return fail;
+}
@@ -7,6 +7,9 @@
 #include "riscv_crypto.h"
 #include "test_rvkat.h"
 #include "sha2/sha2_api.h"
+#include "sha2/sha2_hmac.h"
+
+#include <string.h>
 
 //	SHA2-224/256 testvectors
 
@@ -37,6 +40,7 @@ int test_sha2_256_tv()
 	};
 
 	uint8_t md[32], d[256];
+	struct iovec v[4];
 	int fail = 0;
 	int i;
 
@@ -58,14 +62,59 @@ int test_sha2_256_tv()
 		fail += rvkat_chkhex("SHA2-256", md, 32, sha256_tv[i][1]);
 	}
 
+	//	scatter-gather, last padding vector in segments of 1, 0, 62, rest
+	v[0].iov_base = d;
+	v[0].iov_len = 1;
+	v[1].iov_base = d + 1;
+	v[1].iov_len = 0;
+	v[2].iov_base = d + 1;
+	v[2].iov_len = 62;
+	v[3].iov_base = d + 63;
+	v[3].iov_len = rvkat_gethex(d, sizeof(d), sha256_tv[i - 1][0]) - 63;
+	sha2_256_v(md, v, 4);
+	fail += rvkat_chkhex("SHA2-256 scatter-gather", md, 32,
+						 sha256_tv[i - 1][1]);
+
 	return fail;
 }
 
+//	precomputed schedules and the 64-byte batch interface
+
+int test_sha2_wk()
+{
+	uint8_t m[5 * 64], md[5 * 32], h[32];
+	uint32_t wk[64];
+	sha256_t s0, s1;
+	size_t i;
+	int flag = 0;
+
+	for (i = 0; i < sizeof(m); i++)
+		m[i] = (uint8_t) (i * 0x1D + (i >> 5));
+
+	//	same result as a normal compression of the same block
+	sha256_init(&s0);
+	memcpy(&s0.s[8], m, 64);
+	s1 = s0;
+	sha256_compress(s0.s);
+	sha256_schedule(wk, m);
+	sha256_compress_wk(s1.s, wk);
+	flag |= memcmp(s0.s, s1.s, 32) != 0;
+
+	sha256_64B_batch(md, m, 5);
+	for (i = 0; i < 5; i++) {
+		sha2_256(h, m + 64 * i, 64);
+		flag |= memcmp(h, md + 32 * i, 32) != 0;
+	}
+
+	return rvkat_chkret("SHA2-256 precomputed schedule / 64B batch", 0, flag);
+}
+
 //	SHA2-384/512 test vectors
 
 int test_sha2_512_tv()
 {
 	uint8_t md[64], d[256];
+	struct iovec v[3];
 	size_t dlen;
 	int fail = 0;
 
@@ -87,6 +136,21 @@ int test_sha2_512_tv()
 				   "501D289E4900F7E4331B99DEC4B5433A"
 				   "C7D329EEB6DD26545E96E55B874BE909");
 
+	//	the same in segments straddling the 128-byte block
+	v[0].iov_base = "abcdefghbcdefghicdefghijdefghijk";
+	v[0].iov_len = 32;
+	v[1].iov_base = "efghijklfghijklmghijklmnhijklmno"
+		"ijklmnopjklmnopqklmnopqrlmnopqrs";
+	v[1].iov_len = 64;
+	v[2].iov_base = "mnopqrstnopqrstu";
+	v[2].iov_len = 16;
+	sha2_512_v(md, v, 3);
+	fail += rvkat_chkhex("SHA2-512 scatter-gather", md, 64,
+				   "8E959B75DAE313DA8CF4F72814FC143F"
+				   "8F7779C6EB9F7FA17299AEADB6889018"
+				   "501D289E4900F7E4331B99DEC4B5433A"
+				   "C7D329EEB6DD26545E96E55B874BE909");
+
 	//	SHA2-384
 	sha2_384(md, "", 0);
 	fail += rvkat_chkhex("SHA2-384", md, 48,
@@ -107,6 +171,200 @@ int test_sha2_512_tv()
 				   "135F0B5CDFB0DAC6C3A292DD70371AB4"
 				   "B79DA1997D7992906AC7213502662920");
 
+	//	SHA2-512/224
+	sha2_512_224(md, "abc", 3);
+	fail += rvkat_chkhex("SHA2-512/224", md, 28,
+				   "4634270F707B6A54DAAE7530460842E2"
+				   "0E37ED265CEEE9A43E8924AA");
+	md[28] = 0xEE;							//	truncation: no overrun
+	sha2_512_224_v(md, v, 3);
+	fail += rvkat_chkhex("SHA2-512/224 scatter-gather", md, 29,
+				   "23FEC5BB94D60B23308192640B0C4533"
+				   "35D664734FE40E7268674AF9EE");
+
+	//	SHA2-512/256
+	sha2_512_256(md, "abc", 3);
+	fail += rvkat_chkhex("SHA2-512/256", md, 32,
+				   "53048E2681941EF99B2E29B76B4C7DAB"
+				   "E4C2D0C634FC6D46E0E2F13107E7AF23");
+	sha2_512_256_v(md, v, 3);
+	fail += rvkat_chkhex("SHA2-512/256 scatter-gather", md, 32,
+				   "3928E184FB8690F840DA3988121D31BE"
+				   "65CB9D3EF83EE6146FEAC861E19B563A");
+
+	return fail;
+}
+
+//	HMAC-SHA256 (RFC 4231) and HKDF-SHA256 (RFC 5869) test vectors
+
+int test_hmac_256_tv()
+{
+	hmac_sha256_key_t k;
+	hmac_sha256_t ctx;
+	uint8_t key[131], d[300], mac[32], okm[100];
+	size_t i;
+	int flag, fail = 0;
+
+	memset(key, 0x0B, 20);
+	hmac_sha256_key(&k, key, 20);
+	hmac_sha256(mac, &k, "Hi There", 8);
+	fail += rvkat_chkhex("HMAC-SHA256 #1", mac, 32,
+				   "B0344C61D8DB38535CA8AFCEAF0BF12B"
+				   "881DC200C9833DA726E9376C2E32CFF7");
+
+	hmac_sha256_key(&k, (const uint8_t *) "Jefe", 4);
+	hmac_sha256_init(&ctx, &k);			//	incremental
+	hmac_sha256_update(&ctx, (const uint8_t *) "what do ya want ", 16);
+	hmac_sha256_update(&ctx, (const uint8_t *) "for nothing?", 12);
+	hmac_sha256_final(&ctx, mac);
+	fail += rvkat_chkhex("HMAC-SHA256 #2", mac, 32,
+				   "5BDCC146BF60754E6A042426089575C7"
+				   "5A003F089D2739839DEC58B964EC3843");
+
+	memset(key, 0xAA, 131);
+	hmac_sha256_key(&k, key, 131);
+	hmac_sha256(mac, &k,
+				"Test Using Larger Than Block-Size Key - Hash Key First", 54);
+	fail += rvkat_chkhex("HMAC-SHA256 #6", mac, 32,
+				   "60E431591EE0B67F0D8A26AACBF5B77F"
+				   "8E0BC6213728C5140546040F0EE37F54");
+
+	//	RFC 5869 A.1
+
+	memset(key, 0x0B, 22);
+	for (i = 0; i < 13; i++)
+		d[i] = i;
+	for (i = 0; i < 10; i++)
+		d[16 + i] = 0xF0 + i;
+	hkdf_sha256(okm, 42, d, 13, key, 22, d + 16, 10);
+	fail += rvkat_chkhex("HKDF-SHA256 A.1", okm, 42,
+				   "3CB25F25FAACD57A90434F64D0362F2A"
+				   "2D2D0A90CF1A5A4C5DB02D56ECC4C5BF"
+				   "34007208D5B887185865");
+
+	//	RFC 5869 A.2: long inputs
+
+	for (i = 0; i < 256; i++)
+		d[i] = i;
+	hkdf_sha256(okm, 82, d + 0x60, 80, d, 80, d + 0xB0, 80);
+	fail += rvkat_chkhex("HKDF-SHA256 A.2", okm, 82,
+				   "B11E398DC80327A1C8E7F78C596A4934"
+				   "4F012EDA2D4EFAD8A050CC4C19AFA97C"
+				   "59045A99CAC7827271CB41C65E590E09"
+				   "DA3275600C2F09B8367793A9ACA3DB71"
+				   "CC30C58179EC3E87C14C01D5C1F3434F"
+				   "1D87");
+
+	//	RFC 5869 A.3: empty salt and info
+
+	hkdf_sha256(okm, 42, NULL, 0, key, 22, NULL, 0);
+	fail += rvkat_chkhex("HKDF-SHA256 A.3", okm, 42,
+				   "8DA4E775A563C18F715F802A063C5A31"
+				   "B8A11F5C5EE1879EC3454E5F3C738D2D"
+				   "9D201395FAA4B61A96C8");
+
+	//	info longer than the expand template
+
+	for (i = 0; i < 300; i++)
+		d[i] = i;
+	hkdf_sha256(okm, 100, (const uint8_t *) "salt", 4, key, 22, d, 300);
+	fail += rvkat_chkhex("HKDF-SHA256 info/300", okm, 100,
+				   "BB402BB4519600B06FD3BED56BE69204"
+				   "67EC5540F60CD4E104F6347422ABF23C"
+				   "75858B7F94DFA4C9CC14903B9678B270"
+				   "083E840AD2585D79D6270F3EFF4C9375"
+				   "B00945E132B52E978C86AFDAF71E6EA8"
+				   "C467468CB641A61072A1E4DF06C63346"
+				   "A3A28ED5");
+
+	flag = hkdf_sha256(okm, 255 * 32 + 1, NULL, 0, key, 22, NULL, 0);
+	fail += rvkat_chkret("HKDF-SHA256 length limit", -1, flag);
+
+	return fail;
+}
+
+//	HMAC-SHA384/512 (RFC 4231) and HKDF-SHA384 test vectors
+
+int test_hmac_512_tv()
+{
+	hmac_sha512_key_t k;
+	uint8_t key[131], d[500], mac[64], okm[150];
+	size_t i;
+	int fail = 0;
+
+	memset(key, 0x0B, 20);
+	hmac_sha384_key(&k, key, 20);
+	hmac_sha384(mac, &k, "Hi There", 8);
+	fail += rvkat_chkhex("HMAC-SHA384 #1", mac, 48,
+				   "AFD03944D84895626B0825F4AB46907F"
+				   "15F9DADBE4101EC682AA034C7CEBC59C"
+				   "FAEA9EA9076EDE7F4AF152E8B2FA9CB6");
+
+	hmac_sha512_key(&k, key, 20);
+	hmac_sha512(mac, &k, "Hi There", 8);
+	fail += rvkat_chkhex("HMAC-SHA512 #1", mac, 64,
+				   "87AA7CDEA5EF619D4FF0B4241A1D6CB0"
+				   "2379F4E2CE4EC2787AD0B30545E17CDE"
+				   "DAA833B7D6B8A702038B274EAEA3F4E4"
+				   "BE9D914EEB61F1702E696C203A126854");
+
+	hmac_sha384_key(&k, (const uint8_t *) "Jefe", 4);
+	hmac_sha384(mac, &k, "what do ya want for nothing?", 28);
+	fail += rvkat_chkhex("HMAC-SHA384 #2", mac, 48,
+				   "AF45D2E376484031617F78D2B58A6B1B"
+				   "9C7EF464F5A01B47E42EC3736322445E"
+				   "8E2240CA5E69E2C78B3239ECFAB21649");
+
+	memset(key, 0xAA, 131);
+	hmac_sha512_key(&k, key, 131);
+	hmac_sha512(mac, &k,
+				"Test Using Larger Than Block-Size Key - Hash Key First", 54);
+	fail += rvkat_chkhex("HMAC-SHA512 #6", mac, 64,
+				   "80B24263C7C1A3EBB71493C1DD7BE8B4"
+				   "9B46D1F41B4AEEC1121B013783F8F352"
+				   "6B56D037E05F2598BD0FD2215D6A1E52"
+				   "95E64F73F63F0AEC8B915A985D786598");
+
+	//	HKDF-SHA384 with the inputs of RFC 5869 A.2
+
+	for (i = 0; i < 500; i++)
+		d[i] = i;
+	hkdf_sha384(okm, 150, d + 0x60, 80, d, 80, d + 0xB0, 80);
+	fail += rvkat_chkhex("HKDF-SHA384", okm, 150,
+				   "484CA052B8CC724FD1C4EC64D57B4E81"
+				   "8C7E25A8E0F4569ED72A6A05FE0649EE"
+				   "BF69F8D5C832856BF4E4FBC17967D549"
+				   "75324A94987F7F41835817D8994FDBD6"
+				   "F4C09C5500DCA24A56222FEA53D8967A"
+				   "8B2E2A125BBBD822A84EB77BE82DFD76"
+				   "A1C0AB1E4D793AAE639A9160B76424A9"
+				   "35B8505CAFF5FC94B713E5D4EFF44DAE"
+				   "708E1726A401F3739BC55B399CD57F9C"
+				   "0D0F17BEB8C9");
+
+	memset(key, 0x0B, 22);
+	hkdf_sha384(okm, 100, (const uint8_t *) "salt", 4, key, 22, d, 500);
+	fail += rvkat_chkhex("HKDF-SHA384 info/500", okm, 100,
+				   "1AEF6BD5C65C8EB6D1AA61C1DB6C5C9E"
+				   "37F38981EB080B080D0840B5A2084B52"
+				   "091C3E83DFD885C5C86A603CDD49DC0D"
+				   "E09D49D32165241849C0522811DAA8CF"
+				   "1A5A68884D6001EFF1A9FB7AC4DBE59C"
+				   "044E576B048D1468E9A939F3FF95C117"
+				   "0311AAC3");
+
+	//	no salt and no info, as in RFC 5869 A.3
+
+	hkdf_sha384(okm, 100, NULL, 0, key, 22, NULL, 0);
+	fail += rvkat_chkhex("HKDF-SHA384 no info", okm, 100,
+				   "C8C96E710F89B0D7990BCA68BCDEC8CF"
+				   "854062E54C73A7ABC743FADE9B242DAA"
+				   "CC1CEA5670415B52849C97C4E787C1F2"
+				   "130FDAAED2EFEE2FD43AB373B705464F"
+				   "FBC36E70CA2A61A5EBF44D1BF8217DF5"
+				   "9CBE9DCF94A5A4546503E7F9C02E97B0"
+				   "FAC5CB8F");
+
 	return fail;
 }
 
@@ -118,18 +376,24 @@ int test_sha2()
 
 	rvkat_info("=== SHA2-256 using sha2_cf256_rvk() ===");
 	sha256_compress = sha2_cf256_rvk;
+	sha256_schedule = sha2_wk256_rvk;
+	sha256_compress_wk = sha2_cf256_wk_rvk;
 	fail += test_sha2_256_tv();
+	fail += test_sha2_wk();
+	fail += test_hmac_256_tv();
 
 #ifdef RVKINTRIN_RV64
 	rvkat_info("=== SHA2-512 using sha2_cf512_rvk64() ===");
 	sha512_compress = sha2_cf512_rvk64;
 	fail += test_sha2_512_tv();
+	fail += test_hmac_512_tv();
 #endif
 
 #ifdef RVKINTRIN_RV32
 	rvkat_info("=== SHA2-512 using sha2_cf512_rvk32() ===");
 	sha512_compress = sha2_cf512_rvk32;
 	fail += test_sha2_512_tv();
+	fail += test_hmac_512_tv();
 #endif
 
 	return fail;
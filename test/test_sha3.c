@@ -2,11 +2,14 @@
 //	2020-03-09	Markku-Juhani O. Saarinen <mjos@pqshield.com>
 //	Copyright (c) 2020, PQShield Ltd. All rights reserved.
 
-//	Unit tests for FIPS 202 -- SHA-3 HASH and SHAKE XOF.
+//	Unit tests for FIPS 202 -- SHA-3 HASH and SHAKE XOF, SP 800-185, and
+//	RFC 9861 TurboSHAKE and KangarooTwelve.
 
 #include "riscv_crypto.h"
 #include "test_rvkat.h"
 #include "sha3/sha3_api.h"
+#include "sha3/sp800_185.h"
+#include "sha3/kangaroo12.h"
 
 #include <string.h>
 
@@ -71,6 +74,7 @@ int test_sha3_tv()
 
 	size_t i, mdlen, inlen;
 	uint8_t md[64], in[256];
+	struct iovec v[2];
 	int fail = 0;
 
 	for (i = 0; i < 4; i++) {
@@ -81,6 +85,14 @@ int test_sha3_tv()
 
 		sha3(md, mdlen, in, inlen);
 		fail += rvkat_chkhex(sha3_tv[i][0], md, mdlen, sha3_tv[i][2]);
+
+		v[0].iov_base = in;					//	scatter-gather
+		v[0].iov_len = inlen / 3;
+		v[1].iov_base = in + inlen / 3;
+		v[1].iov_len = inlen - inlen / 3;
+		memset(md, 0, sizeof(md));
+		sha3_v(md, mdlen, v, 2);
+		fail += rvkat_chkhex(sha3_tv[i][0], md, mdlen, sha3_tv[i][2]);
 	}
 
 	return fail;
@@ -152,6 +164,197 @@ int test_shake_tv()
 	return fail;
 }
 
+//	SP 800-185 tests. cSHAKE and KMAC samples are from the NIST examples
+//	at https://csrc.nist.gov/projects/cryptographic-standards-and-guidelines/example-values
+
+int test_sp800_185_tv()
+{
+	const uint8_t *es = (const uint8_t *) "Email Signature";
+	const uint8_t *ms = (const uint8_t *) "My Tagged Application";
+	const uint8_t *ps = (const uint8_t *) "Parallel Data";
+	const uint8_t *tv[3];
+	size_t tl[3];
+	sha3_ctx_t k, c;
+	uint8_t in[5000], key[32], md[64];
+	int i, fail = 0;
+
+	for (i = 0; i < 5000; i++)
+		in[i] = i * 7;
+	for (i = 0; i < 32; i++)
+		key[i] = 0x40 + i;
+	rvkat_gethex(in, 4, "00010203");
+
+	//	cSHAKE
+
+	cshake128(md, 32, in, 4, NULL, 0, es, 15);
+	fail += rvkat_chkhex("cSHAKE128 #1", md, 32,
+		"C1C36925B6409A04F1B504FCBCA9D82B4017277CB5ED2B2065FC1D3814D5AAF5");
+
+	//	KMAC with a cloned keyed state
+
+	kmac128_init(&k, key, 32, NULL, 0);
+	kmac(md, 32, &k, in, 4);
+	fail += rvkat_chkhex("KMAC128 #1", md, 32,
+		"E5780B0D3EA6F7D3A429C5706AA43A00FADBD7D49628839E3187243F456EE14E");
+
+	kmac128_init(&k, key, 32, ms, 21);
+	kmac(md, 32, &k, in, 4);
+	fail += rvkat_chkhex("KMAC128 #2", md, 32,
+		"3B1FBA963CD8B0B59E8C1A6D71888B7143651AF8BA0A7070C0979E2811324AA5");
+
+	for (i = 0; i < 200; i++)
+		in[i] = i;
+
+	cshake128(md, 32, in, 200, NULL, 0, es, 15);
+	fail += rvkat_chkhex("cSHAKE128 #2", md, 32,
+		"C5221D50E4F822D96A2E8881A961420F294B7B24FE3D2094BAED2C6524CC166B");
+
+	cshake256_init(&c, NULL, 0, es, 15);	//	incremental
+	sha3_update(&c, in, 100);
+	sha3_update(&c, in + 100, 100);
+	cshake_xof(&c);
+	shake_out(md, 64, &c);
+	fail += rvkat_chkhex("cSHAKE256 #4", md, 64,
+		"07DC27B11E51FBAC75BC7B3C1D983E8B4B85FB1DEFAF218912AC864302730917"
+		"27F42B17ED1DF63E8EC118F04B23633C1DFB1574C8FB55CB45DA8E25AFB092BB");
+
+	kmac128_init(&k, key, 32, ms, 21);
+	kmacxof(md, 32, &k, in, 200);
+	fail += rvkat_chkhex("KMACXOF128 #3", md, 32,
+		"47026C7CD793084AA0283C253EF658490C0DB61438B8326FE9BDDF281B83AE0F");
+
+	kmac256_init(&k, key, 32, ms, 21);
+	c = k;									//	incremental from a clone
+	sha3_update(&c, in, 200);
+	kmac_final(md, 64, &c);
+	fail += rvkat_chkhex("KMAC256 #6", md, 64,
+		"B58618F71F92E1D56C1B8C55DDD7CD188B97B4CA4D99831EB2699A837DA2E4D9"
+		"70FBACFDE50033AEA585F1A2708510C32D07880801BD182898FE476876FC8965");
+
+	//	TupleHash
+
+	tv[0] = in;
+	tl[0] = 3;
+	tv[1] = in + 16;
+	tl[1] = 6;
+	tv[2] = in + 32;
+	tl[2] = 9;
+	for (i = 0; i < 48; i++)				//	00 01 02 .. 10 11 12 ..
+		in[i] = ((i >> 4) << 4) + (i & 15);
+	tuplehash128(md, 32, tv, tl, 3,
+				 (const uint8_t *) "My Tuple App", 12);
+	fail += rvkat_chkhex("TupleHash128 #3", md, 32,
+		"E60F202C89A2631EDA8D4C588CA5FD07F39E5151998DECCF973ADB3804BB6E84");
+	tuplehash256(md, 64, tv, tl, 2, NULL, 0);
+	fail += rvkat_chkhex("TupleHash256 #4", md, 64,
+		"CFB7058CACA5E668F81A12A20A2195CE97A925F1DBA3E7449A56F82201EC6073"
+		"11AC2696B1AB5EA2352DF1423BDE7BD4BB78C9AED1A853C78672F9EB23BBE194");
+
+	//	ParallelHash
+
+	rvkat_gethex(in, 24, "000102030405060710111213141516172021222324252627");
+	parallelhash128(md, 32, in, 24, 8, NULL, 0);
+	fail += rvkat_chkhex("ParallelHash128 #1", md, 32,
+		"BA8DC1D1D979331D3F813603C67F72609AB5E44B94A0B8F9AF46514454A2B4F5");
+	parallelhash128(md, 32, in, 24, 8, ps, 13);
+	fail += rvkat_chkhex("ParallelHash128 #2", md, 32,
+		"FC484DCB3F84DCEEDC353438151BEE58157D6EFED0445A81F165E495795B7206");
+	parallelhash256(md, 64, in, 24, 8, ps, 13);
+	fail += rvkat_chkhex("ParallelHash256 #5", md, 64,
+		"CDF15289B54F6212B4BC270528B49526006DD9B54E2B6ADD1EF6900DDA3963BB"
+		"33A72491F236969CA8AFAEA29C682D47A393C065B38E29FAE651A2091C833110");
+
+	//	multi-block leaves, full groups of four and a partial leaf
+
+	for (i = 0; i < 5000; i++)
+		in[i] = i * 7;
+	parallelhash128(md, 32, in, 5000, 1000, (const uint8_t *) "big", 3);
+	fail += rvkat_chkhex("ParallelHash128 5000/1000", md, 32,
+		"6E7045ED7A2C7B9838C04CCFDEF7D8D25553A76E9179E0600282D6EC180CF7BD");
+	parallelhash256(md, 64, in, 5000, 168, NULL, 0);
+	fail += rvkat_chkhex("ParallelHash256 5000/168", md, 64,
+		"AC46360920C2306EEFF2BEF372FC688753BD0EE846E893FD1B31CCA6B2A5620D"
+		"986A8A1D8C09123F08E015FC4EFA970D713AF9FE87FD1165CA29815F3BBBBA66");
+
+	//	a zero leaf size is rejected
+	fail += rvkat_chkret("ParallelHash128 b=0", -1,
+						 parallelhash128(md, 32, in, 24, 0, NULL, 0));
+	fail += rvkat_chkret("ParallelHash256 b=0", -1,
+						 parallelhash256(md, 64, in, 0, 0, NULL, 0));
+
+	return fail;
+}
+
+//	RFC 9861 tests; ptn(n) is the pattern 00 01 .. F9 FA 00 01 .. of n bytes
+
+static uint8_t kt_in[83521];
+
+static void kt128_ptn(uint8_t *x, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++)
+		x[i] = i % 251;
+}
+
+int test_kt128_tv()
+{
+	const uint8_t ff[3] = { 0xFF, 0xFF, 0xFF };
+	uint8_t cs[41], md[32], md2[32];
+	kt128_ctx_t c;
+	size_t i, j;
+	int fail = 0;
+
+	turboshake128(md, 32, NULL, 0, 0x07);
+	fail += rvkat_chkhex("TurboSHAKE128 M=`00`^0 D=07", md, 32,
+		"5A223AD30B3B8C66A243048CFCED430F54E7529287D15150B973133ADFAC6A2F");
+
+	kt128(md, 32, NULL, 0, NULL, 0);
+	fail += rvkat_chkhex("KT128 M=`00`^0", md, 32,
+		"1AC2D450FC3B4205D19DA7BFCA1B37513C0803577AC7167F06FE2CE1F0EF39E5");
+
+	kt128_ptn(kt_in, sizeof(kt_in));
+	kt128(md, 32, kt_in, 17, NULL, 0);
+	fail += rvkat_chkhex("KT128 M=ptn(17^1)", md, 32,
+		"6BF75FA2239198DB4772E36478F8E19B0F371205F6A9A93A273F51DF37122888");
+	kt128(md, 32, kt_in, 17 * 17, NULL, 0);
+	fail += rvkat_chkhex("KT128 M=ptn(17^2)", md, 32,
+		"0C315EBCDEDBF61426DE7DCF8FB725D1E74675D7F5327A5067F367B108ECB67C");
+	kt128(md, 32, kt_in, 17 * 17 * 17, NULL, 0);
+	fail += rvkat_chkhex("KT128 M=ptn(17^3)", md, 32,
+		"CB552E2EC77D9910701D578B457DDF772C12E322E4EE7FE417F92C758F0D59D0");
+	kt128(md, 32, kt_in, 17 * 17 * 17 * 17, NULL, 0);
+	fail += rvkat_chkhex("KT128 M=ptn(17^4)", md, 32,
+		"8701045E22205345FF4DDA05555CBB5C3AF1A771C2B89BAEF37DB43D9998B9FE");
+
+	kt128_ptn(cs, sizeof(cs));
+	kt128(md, 32, NULL, 0, cs, 1);
+	fail += rvkat_chkhex("KT128 M=`00`^0 C=ptn(41^0)", md, 32,
+		"FAB658DB63E94A246188BF7AF69A133045F46EE984C56E3C3328CAAF1AA1A583");
+	kt128(md, 32, ff, 1, cs, 41);
+	fail += rvkat_chkhex("KT128 M=`FF` C=ptn(41^1)", md, 32,
+		"D848C5068CED736F4462159B9867FD4C20B808ACC3D5BC48E0B06BA0A3762EC4");
+
+	//	a 1681-byte customization string; M || C || enc(C) is still one leaf
+	kt128(md, 32, ff, 3, kt_in, 41 * 41);
+	fail += rvkat_chkhex("KT128 M=`FF FF FF` C=ptn(41^2)", md, 32,
+		"C389E5009AE57120854C2E8C64670AC01358CF4C1BAF89447A724234DC7CED74");
+
+	//	incremental in uneven pieces; partial and whole leaves mixed
+	kt128(md, 32, kt_in, sizeof(kt_in), NULL, 0);
+	kt128_init(&c);
+	for (i = 0; i < sizeof(kt_in); i += j) {
+		j = (i * 7 + 1000) % 20011;
+		if (j > sizeof(kt_in) - i)
+			j = sizeof(kt_in) - i;
+		kt128_update(&c, kt_in + i, j);
+	}
+	kt128_final(md2, 32, &c, NULL, 0);
+	fail += rvkat_chkret("KT128 incremental", 0, memcmp(md, md2, 32) != 0);
+
+	return fail;
+}
+
 //	FIPS 202: algorithm tests
 
 int test_sha3()
@@ -161,17 +364,23 @@ int test_sha3()
 #ifdef RVKINTRIN_RV32
 	rvkat_info("=== SHA3 using sha3_f1600_rvb32() ===");
 	sha3_keccakp = sha3_f1600_rvb32;
+	sha3_keccakp12 = sha3_p1600_12_rvb32;
 	fail += test_keccakp_tv();
 	fail += test_sha3_tv();
 	fail += test_shake_tv();
+	fail += test_sp800_185_tv();
+	fail += test_kt128_tv();
 #endif
 
 #ifdef RVKINTRIN_RV64
 	rvkat_info("=== SHA3 using sha3_f1600_rvb64() ===");
 	sha3_keccakp = sha3_f1600_rvb64;
+	sha3_keccakp12 = sha3_p1600_12_rvb64;
 	fail += test_keccakp_tv();
 	fail += test_sha3_tv();
 	fail += test_shake_tv();
+	fail += test_sp800_185_tv();
+	fail += test_kt128_tv();
 #endif
 
 	return fail;
@@ -0,0 +1,103 @@
+//	test_slab.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Unit tests for key objects and the slab allocator.
+
+#include <string.h>
+#include "riscv_crypto.h"
+#include "test_rvkat.h"
+
+#include "rvk_slab.h"
+#include "aes/aes_api.h"
+#include "gcm/gcm_api.h"
+#include "sm4/sm4_api.h"
+
+#define SLAB_OBJS 5
+
+int test_slab()
+{
+	static uint8_t mem[RVK_SLAB_BYTES(SLAB_OBJS, sizeof(gcm_key_t)) + 1];
+	rvk_slab_t s;
+	gcm_key_t *gk[SLAB_OBJS + 1];
+	uint8_t key[32], iv[12], pt[50], ct[50 + 16], xt[50 + 16];
+	size_t i, j, n;
+	int flag, fail = 0;
+
+	rvkat_info("=== Key objects / slab ===");
+
+	//	object sizes are whole cache lines
+	flag = sizeof(aes_key_t) != 4 * RVK_CACHE_LINE ||
+		sizeof(gcm_key_t) != 5 * RVK_CACHE_LINE ||
+		sizeof(sm4_key_t) != 2 * RVK_CACHE_LINE ||
+		offsetof(gcm_key_t, rk) != RVK_CACHE_LINE;
+	fail += rvkat_chkret("Key object layout", 0, flag);
+
+	//	misaligned memory, exhaustion
+	n = rvk_slab_init(&s, mem + 1, sizeof(mem) - 1, sizeof(gcm_key_t));
+	flag = n != SLAB_OBJS;
+	for (i = 0; i < SLAB_OBJS + 1; i++) {
+		gk[i] = (gcm_key_t *) rvk_slab_alloc(&s);
+	}
+	for (i = 0; i < SLAB_OBJS; i++) {
+		flag |= gk[i] == NULL || ((uintptr_t) gk[i]) % RVK_CACHE_LINE != 0;
+	}
+	flag |= gk[SLAB_OBJS] != NULL;
+	fail += rvkat_chkret("Slab alignment and capacity", 0, flag);
+
+	//	use a key object from the slab
+	for (i = 0; i < sizeof(key); i++)
+		key[i] = 0x3C ^ i;
+	for (i = 0; i < sizeof(pt); i++)
+		pt[i] = i;
+	memset(iv, 0xA7, sizeof(iv));
+
+	flag = aes_gcm_key_init(gk[2], key, 17) == 0;
+	for (i = 16; i <= 32; i += 8) {
+		flag |= aes_gcm_key_init(gk[2], key, i) != 0;
+		aes_enc_gcm_key(ct, pt, sizeof(pt), gk[2], iv);
+		if (i == 16)
+			aes128_enc_gcm(xt, pt, sizeof(pt), key, iv);
+		else if (i == 24)
+			aes192_enc_gcm(xt, pt, sizeof(pt), key, iv);
+		else
+			aes256_enc_gcm(xt, pt, sizeof(pt), key, iv);
+		flag |= memcmp(ct, xt, sizeof(ct)) != 0;
+		flag |= aes_dec_vfy_gcm_key(xt, ct, sizeof(ct), gk[2], iv) != 0;
+		flag |= memcmp(xt, pt, sizeof(pt)) != 0;
+	}
+	fail += rvkat_chkret("GCM key object", 0, flag);
+
+	//	free wipes the key; reuse, bad pointers
+	flag = rvk_slab_free(&s, gk[2]) != 0;
+	for (j = sizeof(void *) + 8; j < sizeof(gcm_key_t); j++)
+		flag |= ((uint8_t *) gk[2])[j] != 0;
+	flag |= rvk_slab_free(&s, ((uint8_t *) gk[3]) + 8) == 0;
+	flag |= rvk_slab_free(&s, mem) == 0;
+	flag |= rvk_slab_alloc(&s) != gk[2];
+	for (j = 0; j < sizeof(gcm_key_t); j++)
+		flag |= ((uint8_t *) gk[2])[j] != 0;
+	for (i = 0; i < SLAB_OBJS; i++)
+		flag |= rvk_slab_free(&s, gk[i]) != 0;
+	flag |= s.used != 0;
+	fail += rvkat_chkret("Slab free and zeroization", 0, flag);
+
+	//	a double free is rejected and does not hand an object out twice
+	gk[0] = (gcm_key_t *) rvk_slab_alloc(&s);
+	gk[1] = (gcm_key_t *) rvk_slab_alloc(&s);
+	flag = rvk_slab_free(&s, gk[0]) != 0;
+	flag |= rvk_slab_free(&s, gk[0]) == 0;
+	flag |= s.used != 1;
+	gk[2] = (gcm_key_t *) rvk_slab_alloc(&s);
+	gk[3] = (gcm_key_t *) rvk_slab_alloc(&s);
+	flag |= gk[2] != gk[0] || gk[3] == gk[0] || gk[3] == NULL;
+
+	//	a live object that happens to contain the magic word is freed
+	memcpy(((uint8_t *) gk[1]) + sizeof(void *),
+		   ((uint8_t *) s.free) + sizeof(void *), 8);
+	flag |= rvk_slab_free(&s, gk[1]) != 0;
+	flag |= rvk_slab_free(&s, gk[1]) == 0;
+	fail += rvkat_chkret("Slab double free", 0, flag);
+
+	return fail;
+}
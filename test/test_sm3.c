@@ -14,6 +14,7 @@
 int test_sm3()
 {
 	uint8_t md[32], in[256];
+	struct iovec v[3];
 	int fail = 0;
 
 	rvkat_info("=== SM3 ===");
@@ -30,5 +31,16 @@ int test_sm3()
 	fail += rvkat_chkhex("SM3-256", md, 32,
 		"DEBE9FF92275B8A138604889C18E5A4D6FDB70E5387E5765293DCBA39C0C5732");
 
+	//	the same in three segments
+	v[0].iov_base = in;
+	v[0].iov_len = 5;
+	v[1].iov_base = in + 5;
+	v[1].iov_len = 0;
+	v[2].iov_base = in + 5;
+	v[2].iov_len = 59;
+	sm3_256_v(md, v, 3);
+	fail += rvkat_chkhex("SM3-256 scatter-gather", md, 32,
+		"DEBE9FF92275B8A138604889C18E5A4D6FDB70E5387E5765293DCBA39C0C5732");
+
 	return fail;
 }
@@ -0,0 +1,171 @@
+//	test_xts.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Unit tests for AES-XTS (IEEE 1619, SP 800-38E). Vectors 1, 2, 4, 10, 15
+//	are from IEEE 1619 Annex B (4 and 10 truncated, with stealing).
+
+#include <string.h>
+#include "riscv_crypto.h"
+#include "test_rvkat.h"
+
+#include "aes/aes_api.h"
+#include "aes/aes_rvk32.h"
+#include "aes/aes_rvk64.h"
+#include "xts/xts_api.h"
+
+//	AES-XTS test vectors
+
+int test_xts_tv()
+{
+	uint8_t pt[4096], ct[4096], xt[4096], k[64], tw[16];
+	size_t i, len;
+	int flag, fail = 0;
+
+	//	Vector 1: all-zero key and data
+
+	memset(k, 0, 32);
+	memset(tw, 0, 16);
+	memset(pt, 0, 32);
+	aes128_enc_xts(ct, pt, 32, k, tw);
+	fail += rvkat_chkhex("XTS AES-128 #1", ct, 32,
+		"917CF69EBD68B2EC9B9FE9A3EADDA692"
+		"CD43D2F59598ED858C02C2652FBF922E");
+
+	//	Vector 2
+
+	rvkat_gethex(k, sizeof(k),
+		"11111111111111111111111111111111"
+		"22222222222222222222222222222222");
+	rvkat_gethex(tw, sizeof(tw),
+		"33333333330000000000000000000000");
+	memset(pt, 0x44, 32);
+	aes128_enc_xts(ct, pt, 32, k, tw);
+	fail += rvkat_chkhex("XTS AES-128 #2", ct, 32,
+		"C454185E6A16936E39334038ACEF838B"
+		"FB186FFF7480ADC4289382ECD6D394F0");
+
+	//	Vector 15: 17 bytes, ciphertext stealing
+
+	rvkat_gethex(k, sizeof(k),
+		"FFFEFDFCFBFAF9F8F7F6F5F4F3F2F1F0"
+		"BFBEBDBCBBBAB9B8B7B6B5B4B3B2B1B0");
+	rvkat_gethex(tw, sizeof(tw),
+		"9A785634120000000000000000000000");
+	len = rvkat_gethex(pt, sizeof(pt),
+		"000102030405060708090A0B0C0D0E0F10");
+	aes128_enc_xts(ct, pt, len, k, tw);
+	fail += rvkat_chkhex("XTS AES-128 #15", ct, len,
+		"6C1625DB4671522D3D7599601DE7CA09ED");
+	memset(xt, 0, len);
+	flag = aes128_dec_xts(xt, ct, len, k, tw) || memcmp(xt, pt, len) != 0;
+	fail += rvkat_chkret("XTS AES-128 #15 decrypt", 0, flag);
+
+	//	Vector 4 key, 200 bytes: block groups and stealing
+
+	rvkat_gethex(k, sizeof(k),
+		"27182818284590452353602874713526"
+		"31415926535897932384626433832795");
+	memset(tw, 0, 16);
+	for (i = 0; i < 200; i++)
+		pt[i] = i;
+	aes128_enc_xts(ct, pt, 200, k, tw);
+	fail += rvkat_chkhex("XTS AES-128 #4/200", ct, 200,
+		"27A7479BEFA1D476489F308CD4CFA6E2A96E4BBE3208FF25287DD3819616E89C"
+		"C78CF7F5E543445F8333D8FA7F56000005279FA5D8B5E4AD40E736DDB4D35412"
+		"328063FD2AAB53E5EA1E0A9F332500A5DF9487D07A5C92CC512C8866C7E860CE"
+		"93FDF166A24912B422976146AE20CE846BB7DC9BA94A767AAEF20C0D61AD0265"
+		"5EA92DC4C4E41A8952C651D33174BE51A10C421110E6D81588EDE82103A252D8"
+		"A750E8768DEFFFED9122810AAEB99F91EC1DD0107A926A02419669B5F41A6A6C"
+		"72AF82B604DC4B8E");
+	memcpy(xt, ct, 200);					//	in-place
+	flag = aes128_dec_xts(xt, xt, 200, k, tw) || memcmp(xt, pt, 200) != 0;
+	fail += rvkat_chkret("XTS AES-128 #4/200 decrypt", 0, flag);
+
+	//	Vector 10 (AES-256), 37 bytes
+
+	rvkat_gethex(k, sizeof(k),
+		"27182818284590452353602874713526"
+		"62497757247093699959574966967627"
+		"31415926535897932384626433832795"
+		"02884197169399375105820974944592");
+	rvkat_gethex(tw, sizeof(tw),
+		"FF000000000000000000000000000000");
+	aes256_enc_xts(ct, pt, 37, k, tw);
+	fail += rvkat_chkhex("XTS AES-256 #10/37", ct, 37,
+		"1C3B3A102F770386E4836C99E370CF9B"
+		"D500010CF8FE25A2CF7DCE0764CAF96C"
+		"EA00803F5E");
+	memset(xt, 0, 37);
+	flag = aes256_dec_xts(xt, ct, 37, k, tw) || memcmp(xt, pt, 37) != 0;
+	fail += rvkat_chkret("XTS AES-256 #10/37 decrypt", 0, flag);
+
+	//	4 KiB page of 512-byte sectors == sector-by-sector encryption
+
+	for (i = 0; i < 4096; i++)
+		pt[i] = i * 0x9E3779B9 >> 24;
+	aes256_enc_xts_sec(ct, pt, 512, 8, k, 0xFF);
+	flag = 0;
+	for (i = 0; i < 8; i++) {
+		memset(tw, 0, 16);
+		tw[0] = 0xFF + i;
+		tw[1] = (0xFF + i) >> 8;
+		aes256_enc_xts(xt, pt + 512 * i, 512, k, tw);
+		flag |= memcmp(xt, ct + 512 * i, 512) != 0;
+	}
+	flag |= aes256_dec_xts_sec(ct, ct, 512, 8, k, 0xFF) ||
+		memcmp(ct, pt, 4096) != 0;
+	fail += rvkat_chkret("XTS AES-256 4096/512 sectors", 0, flag);
+
+	//	sectors with a partial block
+
+	flag = aes128_enc_xts_sec(ct, pt, 520, 7, k, 12345) ||
+		aes128_dec_xts_sec(xt, ct, 520, 7, k, 12345) ||
+		memcmp(xt, pt, 520 * 7) != 0;
+	fail += rvkat_chkret("XTS AES-128 7 x 520 sectors", 0, flag);
+
+	return fail;
+}
+
+//	XTS implementation tests
+
+int test_xts()
+{
+	int fail = 0;
+
+#ifdef RVKINTRIN_RV32
+	rvkat_info("=== AES-XTS using aes_rvk32 ===");
+
+	aes128_enc_key = aes128_enc_key_rvk32;	//	set UUT = AES32
+	aes256_enc_key = aes256_enc_key_rvk32;
+	aes128_enc_ecb = aes128_enc_ecb_rvk32;
+	aes256_enc_ecb = aes256_enc_ecb_rvk32;
+	aes128_enc_ecbn = aes128_enc_ecbn_rvk32;
+	aes256_enc_ecbn = aes256_enc_ecbn_rvk32;
+	aes128_dec_key = aes128_dec_key_rvk32;
+	aes256_dec_key = aes256_dec_key_rvk32;
+	aes128_dec_ecbn = aes128_dec_ecbn_rvk32;
+	aes256_dec_ecbn = aes256_dec_ecbn_rvk32;
+
+	fail += test_xts_tv();
+#endif
+
+#ifdef RVKINTRIN_RV64
+	rvkat_info("=== AES-XTS using aes_rvk64 ===");
+
+	aes128_enc_key = aes128_enc_key_rvk64;	//	set UUT = AES64
+	aes256_enc_key = aes256_enc_key_rvk64;
+	aes128_enc_ecb = aes128_enc_ecb_rvk64;
+	aes256_enc_ecb = aes256_enc_ecb_rvk64;
+	aes128_enc_ecbn = aes128_enc_ecbn_rvk64;
+	aes256_enc_ecbn = aes256_enc_ecbn_rvk64;
+	aes128_dec_key = aes128_dec_key_rvk64;
+	aes256_dec_key = aes256_dec_key_rvk64;
+	aes128_dec_ecbn = aes128_dec_ecbn_rvk64;
+	aes256_dec_ecbn = aes256_dec_ecbn_rvk64;
+
+	fail += test_xts_tv();
+#endif
+
+	return fail;
+}
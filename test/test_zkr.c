@@ -9,13 +9,7 @@
 #ifdef RVKINTRIN_ZKR
 
 #include "test_rvkat.h"
-
-static inline uint32_t _rvk_asm_zkr_seed()
-{
-	uint32_t rd; 
-	__asm__ __volatile__ ("csrrw %0, 0x015, x0" : "=r"(rd));	
-	return rd; 
-}
+#include "drbg/drbg_api.h"
 
 //	simple test for the entropy source; just poll and print status print status
 
@@ -24,27 +18,35 @@ int test_zkr()
 	int fail = 0;
 	int i;
 	uint32_t seed, v[10];
+	uint8_t buf[32];
 
 	rvkat_info("=== Zkr seed ===");
 
 	//	load the seeds quick (to reveal wait states)
 	for (i = 0; i < 10; i++) {
-		v[i] = _rvk_asm_zkr_seed();
+		v[i] = es16_seed_zkr();
 	}
 
 	for (i = 0; i < 10; i++) {
 		sio_puts("[INFO] ");
 		seed = v[i];
 		switch((seed >> 30) & 3) {
-			case 0:	sio_puts("BIST"); break;
-			case 1:	sio_puts("WAIT"); break;
-			case 2:	sio_puts("ES16"); break;
-			case 3:	sio_puts("DEAD"); break;
+			case ES16_BIST:	sio_puts("BIST"); break;
+			case ES16_WAIT:	sio_puts("WAIT"); break;
+			case ES16_ES16:	sio_puts("ES16"); break;
+			case ES16_DEAD:	sio_puts("DEAD"); break;
 		}
 
 		rvkat_hexu32(seed);
 		sio_putc('\n');	
 	}
+
+	//	conditioned seed and the per-thread DRBG on the real source
+	es16_seed = es16_seed_zkr;
+	fail += rvkat_chkret("Zkr es16_get_seed()", 0, es16_get_seed(buf, 32));
+	rvkat_hexout("seed", buf, 32);
+	rvk_random_reset();
+	fail += rvkat_chkret("Zkr rvk_random()", 0, rvk_random(buf, 12));
 	
 	return fail;
 }
@@ -0,0 +1,32 @@
+//	acvp.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	ACVP test group processors for rvkacvp.
+
+#ifndef _ACVP_H_
+#define _ACVP_H_
+
+#include "acvp_json.h"
+
+//	vector set header fields
+typedef struct {
+	const char *alg;						//	"algorithm"
+	const char *mode;						//	"mode", or NULL
+} acvp_vs_t;
+
+//	Write the response tests of test group "tg" to "o", as a
+//	comma-separated list of {"tcId": .. } objects. Returns the number of
+//	tests that were skipped, or -1 if the whole group is not supported.
+typedef long (*acvp_fn_t)(json_buf_t *o, const acvp_vs_t *vs,
+						  const json_t *tg);
+
+//	acvp_sha.c: SHA2-*, SHA3-* (AFT, MCT) and SHAKE-* (AFT, VOT, MCT)
+long acvp_sha(json_buf_t *o, const acvp_vs_t *vs, const json_t *tg);
+long acvp_shake(json_buf_t *o, const acvp_vs_t *vs, const json_t *tg);
+
+//	acvp_aes.c: ACVP-AES-ECB (AFT, MCT) and ACVP-AES-GCM (AFT)
+long acvp_aes_ecb(json_buf_t *o, const acvp_vs_t *vs, const json_t *tg);
+long acvp_aes_gcm(json_buf_t *o, const acvp_vs_t *vs, const json_t *tg);
+
+#endif	//	_ACVP_H_
@@ -0,0 +1,298 @@
+//	acvp_aes.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	ACVP AES-ECB and AES-GCM test groups. GCM cases of a group go through
+//	a job/ ring in batches; the ring supports 128/192/256-bit keys and
+//	96-bit IVs only. Cases with other IV lengths are counted as skipped,
+//	so the capabilities registered for GCM should be limited to 96 bits.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "acvp.h"
+#include "aes/aes_api.h"
+#include "job/job_api.h"
+#include "rvk_mem.h"
+
+//	=== AES-ECB ===
+
+//	AESAVS Monte Carlo for ECB: 100 x 1000 chained blocks; after each
+//	1000 the key is xored with the last (up to) 32 bytes of output
+
+static int acvp_ecb_mct(json_buf_t *o, int enc, uint8_t *key, size_t klen,
+						const uint8_t *in)
+{
+	aes_key_t k;
+	uint8_t x[16], y[32];
+	size_t i;
+	int j, l;
+
+	memcpy(x, in, 16);
+	json_printf(o, ",\"resultsArray\":[");
+	for (j = 0; j < 100; j++) {
+		json_printf(o, "%s{", j > 0 ? "," : "");
+		json_put_hex(o, 0, "key", key, klen);
+		json_put_hex(o, 1, enc ? "pt" : "ct", x, 16);
+
+		if ((enc ? aes_enc_key_init(&k, key, klen) :
+			 aes_dec_key_init(&k, key, klen)) != 0)
+			return -1;
+		memset(y, 0, sizeof(y));
+		for (l = 0; l < 1000; l++) {
+			memcpy(y, y + 16, 16);			//	y = CT[j-1] || CT[j]
+			if (enc)
+				aes_enc_ecbn_key(y + 16, x, 1, &k);
+			else
+				aes_dec_ecbn_key(y + 16, x, 1, &k);
+			memcpy(x, y + 16, 16);
+		}
+		json_put_hex(o, 1, enc ? "ct" : "pt", x, 16);
+		json_printf(o, "}");
+
+		for (i = 0; i < klen; i++)
+			key[i] ^= y[32 - klen + i];
+	}
+	json_printf(o, "]");
+	rvk_memzero(&k, sizeof(k));
+
+	return 0;
+}
+
+long acvp_aes_ecb(json_buf_t *o, const acvp_vs_t *vs, const json_t *tg)
+{
+	const json_t *tc;
+	const char *dir, *tt;
+	uint8_t *key, *in, *out;
+	aes_key_t k;
+	long klen, n, skip = 0, cnt = 0;
+	size_t pos;
+	int enc, mct, err;
+
+	(void) vs;
+
+	dir = json_get_str(tg, "direction");
+	tt = json_get_str(tg, "testType");
+	if (dir == NULL || tt == NULL)
+		return -1;
+	enc = strcmp(dir, "encrypt") == 0;
+	if (!enc && strcmp(dir, "decrypt") != 0)
+		return -1;
+	mct = strcmp(tt, "MCT") == 0;
+	if (!mct && strcmp(tt, "AFT") != 0)
+		return -1;
+
+	tc = json_get(tg, "tests");
+	for (tc = tc != NULL ? tc->child : NULL; tc != NULL; tc = tc->next) {
+
+		klen = json_get_hex(tc, "key", &key);
+		n = json_get_hex(tc, enc ? "pt" : "ct", &in);
+		out = (uint8_t *) malloc(n > 0 ? n : 1);
+		err = klen < 0 || n < 0 || (n & 15) != 0 || out == NULL ||
+			(mct && n != 16);
+		if (!err && !mct)
+			err = enc ? aes_enc_key_init(&k, key, klen) :
+				aes_dec_key_init(&k, key, klen);
+
+		pos = o->len;
+		if (!err) {
+			json_printf(o, "%s{\"tcId\":%lld", cnt > 0 ? "," : "",
+						json_get_int(tc, "tcId", 0));
+			if (mct) {
+				err = acvp_ecb_mct(o, enc, key, klen, in);
+			} else {
+				if (enc)
+					aes_enc_ecbn_key(out, in, n / 16, &k);
+				else
+					aes_dec_ecbn_key(out, in, n / 16, &k);
+				json_put_hex(o, 1, enc ? "ct" : "pt", out, n);
+			}
+			json_printf(o, "}");
+		}
+		if (err) {
+			o->len = pos;
+			skip++;
+		} else {
+			cnt++;
+		}
+		free(key);
+		free(in);
+		free(out);
+	}
+	rvk_memzero(&k, sizeof(k));
+
+	return skip;
+}
+
+//	=== AES-GCM ===
+
+typedef struct {
+	rvk_job_t job;
+	long long tcid;
+	uint8_t *key, *iv, *aad, *in, *out, *chk;
+	uint8_t tag[16], tag2[16];
+	long klen, ivlen, alen, len, tlen;
+	int err;
+} acvp_gcm_tc_t;
+
+//	run "n" jobs through a ring; "j" are the first of each test case
+
+static void acvp_gcm_ring(acvp_gcm_tc_t *t, size_t n)
+{
+	rvk_ring_t r;
+	rvk_job_t *done[RVK_RING_SIZE];
+	size_t i;
+
+	rvk_ring_init(&r);
+	for (i = 0; i < n; i++) {
+		if (t[i].err == 0)
+			rvk_ring_submit(&r, &t[i].job);
+	}
+	rvk_ring_poll(&r, done, RVK_RING_SIZE);
+}
+
+static void acvp_gcm_job(acvp_gcm_tc_t *t, int op, const uint8_t *src,
+						 uint8_t *dst, uint8_t *tag)
+{
+	memset(&t->job, 0, sizeof(rvk_job_t));
+	t->job.alg = t->klen == 32 ? RVK_JOB_AES256_GCM :
+		t->klen == 24 ? RVK_JOB_AES192_GCM : RVK_JOB_AES128_GCM;
+	t->job.op = op;
+	t->job.key = t->key;
+	t->job.klen = t->klen;
+	t->job.iv = t->iv;
+	t->job.aad = t->aad;
+	t->job.alen = t->alen;
+	t->job.src = src;
+	t->job.len = t->len;
+	t->job.dst = dst;
+	t->job.tag = tag;
+}
+
+//	a batch of at most RVK_RING_SIZE test cases
+
+static void acvp_gcm_batch(json_buf_t *o, int enc, acvp_gcm_tc_t *t,
+						   size_t n, long *cnt)
+{
+	size_t i;
+	int ok;
+
+	//	first pass: encrypt, or decrypt (verify the full tags)
+	for (i = 0; i < n; i++) {
+		if (enc)
+			acvp_gcm_job(&t[i], RVK_JOB_ENC, t[i].in, t[i].out, t[i].tag);
+		else if (t[i].tlen == 16)
+			acvp_gcm_job(&t[i], RVK_JOB_DEC, t[i].in, t[i].out, t[i].tag);
+		else								//	CTR only; tag is ignored
+			acvp_gcm_job(&t[i], RVK_JOB_ENC, t[i].in, t[i].out, t[i].tag2);
+	}
+	acvp_gcm_ring(t, n);
+
+	//	second pass for truncated tags: encrypt the plaintext again
+	if (!enc) {
+		for (i = 0; i < n; i++) {
+			if (t[i].tlen != 16)
+				acvp_gcm_job(&t[i], RVK_JOB_ENC, t[i].out, t[i].chk,
+							 t[i].tag2);
+			else
+				t[i].err |= 2;				//	not in the second batch
+		}
+		acvp_gcm_ring(t, n);
+		for (i = 0; i < n; i++)
+			t[i].err &= 1;
+	}
+
+	for (i = 0; i < n; i++) {
+		if (t[i].err != 0)
+			continue;
+		json_printf(o, "%s{\"tcId\":%lld", *cnt > 0 ? "," : "", t[i].tcid);
+		if (enc) {
+			json_put_hex(o, 1, "ct", t[i].out, t[i].len);
+			json_put_hex(o, 1, "tag", t[i].tag, t[i].tlen);
+		} else {
+			if (t[i].tlen == 16)
+				ok = t[i].job.status == RVK_JOB_OK;
+			else
+				ok = rvk_memeq_ct(t[i].tag, t[i].tag2, t[i].tlen);
+			if (ok)
+				json_put_hex(o, 1, "pt", t[i].out, t[i].len);
+			else
+				json_printf(o, ",\"testPassed\":false");
+		}
+		json_printf(o, "}");
+		(*cnt)++;
+	}
+}
+
+static void acvp_gcm_free(acvp_gcm_tc_t *t)
+{
+	free(t->key);
+	free(t->iv);
+	free(t->aad);
+	free(t->in);
+	free(t->out);
+	free(t->chk);
+	memset(t, 0, sizeof(acvp_gcm_tc_t));
+}
+
+long acvp_aes_gcm(json_buf_t *o, const acvp_vs_t *vs, const json_t *tg)
+{
+	acvp_gcm_tc_t t[RVK_RING_SIZE];
+	const json_t *tc;
+	const char *dir, *ivg;
+	uint8_t *tag;
+	long skip = 0, cnt = 0, tl;
+	size_t i, n;
+	int enc;
+
+	(void) vs;
+
+	dir = json_get_str(tg, "direction");
+	ivg = json_get_str(tg, "ivGen");
+	if (dir == NULL || (ivg != NULL && strcmp(ivg, "external") != 0))
+		return -1;
+	enc = strcmp(dir, "encrypt") == 0;
+	if (!enc && strcmp(dir, "decrypt") != 0)
+		return -1;
+	tl = json_get_int(tg, "tagLen", 128);
+	if (tl < 8 || tl > 128 || (tl & 7) != 0)
+		return -1;
+
+	memset(t, 0, sizeof(t));
+	n = 0;
+	tc = json_get(tg, "tests");
+	for (tc = tc != NULL ? tc->child : NULL; tc != NULL; tc = tc->next) {
+
+		t[n].tcid = json_get_int(tc, "tcId", 0);
+		t[n].tlen = tl / 8;
+		t[n].klen = json_get_hex(tc, "key", &t[n].key);
+		t[n].ivlen = json_get_hex(tc, "iv", &t[n].iv);
+		t[n].alen = json_get_hex(tc, "aad", &t[n].aad);
+		t[n].len = json_get_hex(tc, enc ? "pt" : "ct", &t[n].in);
+		t[n].err = (t[n].klen != 16 && t[n].klen != 24 && t[n].klen != 32) ||
+			t[n].ivlen != 12 || t[n].alen < 0 || t[n].len < 0;
+		if (!enc && !t[n].err) {
+			if (json_get_hex(tc, "tag", &tag) != t[n].tlen)
+				t[n].err = 1;
+			else
+				memcpy(t[n].tag, tag, t[n].tlen);
+			free(tag);
+		}
+		if (!t[n].err) {
+			t[n].out = (uint8_t *) malloc(t[n].len > 0 ? t[n].len : 1);
+			t[n].chk = (uint8_t *) malloc(t[n].len > 0 ? t[n].len : 1);
+			t[n].err = t[n].out == NULL || t[n].chk == NULL;
+		}
+		if (t[n].err)
+			skip++;
+
+		if (++n == RVK_RING_SIZE || tc->next == NULL) {
+			acvp_gcm_batch(o, enc, t, n, &cnt);
+			for (i = 0; i < n; i++)
+				acvp_gcm_free(&t[i]);
+			n = 0;
+		}
+	}
+
+	return skip;
+}
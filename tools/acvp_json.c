@@ -0,0 +1,457 @@
+//	acvp_json.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Streaming JSON reader and a string buffer writer for ACVP.
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+#include "acvp_json.h"
+#include "test_rvkat.h"
+
+//	=== Reader ===
+
+static void json_getc(json_rd_t *r)
+{
+	r->c = fgetc(r->fp);
+	if (r->c == '\n')
+		r->line++;
+}
+
+void json_rd_init(json_rd_t *r, FILE *fp)
+{
+	r->fp = fp;
+	r->line = 1;
+	r->err = 0;
+	json_getc(r);
+}
+
+int json_peek(json_rd_t *r)
+{
+	while (r->c == ' ' || r->c == '\t' || r->c == '\n' || r->c == '\r')
+		json_getc(r);
+
+	return r->c;
+}
+
+int json_accept(json_rd_t *r, int c)
+{
+	if (json_peek(r) != c)
+		return 0;
+	json_getc(r);
+
+	return 1;
+}
+
+int json_expect(json_rd_t *r, int c)
+{
+	if (json_accept(r, c))
+		return 0;
+	if (r->err == 0)
+		fprintf(stderr, "json: line %ld: expected '%c'\n", r->line, c);
+	r->err = 1;
+
+	return -1;
+}
+
+//	growable string for tokens
+
+typedef struct {
+	char *s;
+	size_t n, cap;
+} json_tok_t;
+
+static int json_tok_add(json_tok_t *t, int c)
+{
+	char *p;
+
+	if (t->n + 1 >= t->cap) {
+		t->cap = t->cap == 0 ? 64 : 2 * t->cap;
+		p = (char *) realloc(t->s, t->cap);
+		if (p == NULL)
+			return -1;
+		t->s = p;
+	}
+	t->s[t->n++] = c;
+	t->s[t->n] = 0;
+
+	return 0;
+}
+
+static int json_hexval(int c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F')
+		return c - 'A' + 10;
+	return -1;
+}
+
+char *json_read_str(json_rd_t *r)
+{
+	json_tok_t t = { NULL, 0, 0 };
+	int c, i, h, u;
+
+	if (json_expect(r, '"') != 0)
+		return NULL;
+
+	if (json_tok_add(&t, 0) != 0)			//	empty string
+		goto fail;
+	t.n = 0;
+
+	while (r->c != '"') {
+		c = r->c;
+		if (c == EOF || c == '\n')
+			goto fail;
+		if (c == '\\') {
+			json_getc(r);
+			switch (r->c) {
+				case 'b':	c = '\b';	break;
+				case 'f':	c = '\f';	break;
+				case 'n':	c = '\n';	break;
+				case 'r':	c = '\r';	break;
+				case 't':	c = '\t';	break;
+				case 'u':					//	BMP only, as UTF-8
+					u = 0;
+					for (i = 0; i < 4; i++) {
+						json_getc(r);
+						h = json_hexval(r->c);
+						if (h < 0)
+							goto fail;
+						u = (u << 4) | h;
+					}
+					if (u >= 0x800) {
+						json_tok_add(&t, 0xE0 | (u >> 12));
+						json_tok_add(&t, 0x80 | ((u >> 6) & 0x3F));
+						c = 0x80 | (u & 0x3F);
+					} else if (u >= 0x80) {
+						json_tok_add(&t, 0xC0 | (u >> 6));
+						c = 0x80 | (u & 0x3F);
+					} else {
+						c = u;
+					}
+					break;
+				default:
+					c = r->c;				//	\" \\ \/
+			}
+		}
+		if (json_tok_add(&t, c) != 0)
+			goto fail;
+		json_getc(r);
+	}
+	json_getc(r);
+
+	return t.s;
+
+fail:
+	if (r->err == 0)
+		fprintf(stderr, "json: line %ld: bad string\n", r->line);
+	r->err = 1;
+	free(t.s);
+
+	return NULL;
+}
+
+//	number or literal: a run of [0-9a-zA-Z.+-]
+
+static char *json_read_word(json_rd_t *r)
+{
+	json_tok_t t = { NULL, 0, 0 };
+
+	while ((r->c >= '0' && r->c <= '9') || (r->c >= 'a' && r->c <= 'z') ||
+		   (r->c >= 'A' && r->c <= 'Z') || r->c == '.' || r->c == '+' ||
+		   r->c == '-') {
+		if (json_tok_add(&t, r->c) != 0) {
+			free(t.s);
+			return NULL;
+		}
+		json_getc(r);
+	}
+
+	return t.s;
+}
+
+json_t *json_read(json_rd_t *r)
+{
+	json_t *j, **pp;
+	char *key;
+	int c;
+
+	j = (json_t *) calloc(1, sizeof(json_t));
+	if (j == NULL) {
+		r->err = 1;
+		return NULL;
+	}
+	c = json_peek(r);
+
+	switch (c) {
+		case '{':
+			j->type = JSON_OBJ;
+			json_getc(r);
+			pp = &j->child;
+			if (json_accept(r, '}'))
+				break;
+			do {
+				key = json_read_str(r);
+				if (key == NULL || json_expect(r, ':') != 0) {
+					free(key);
+					goto fail;
+				}
+				*pp = json_read(r);
+				if (*pp == NULL) {
+					free(key);
+					goto fail;
+				}
+				(*pp)->key = key;
+				pp = &(*pp)->next;
+			} while (json_accept(r, ','));
+			if (json_expect(r, '}') != 0)
+				goto fail;
+			break;
+
+		case '[':
+			j->type = JSON_ARR;
+			json_getc(r);
+			pp = &j->child;
+			if (json_accept(r, ']'))
+				break;
+			do {
+				*pp = json_read(r);
+				if (*pp == NULL)
+					goto fail;
+				pp = &(*pp)->next;
+			} while (json_accept(r, ','));
+			if (json_expect(r, ']') != 0)
+				goto fail;
+			break;
+
+		case '"':
+			j->type = JSON_STR;
+			j->str = json_read_str(r);
+			if (j->str == NULL)
+				goto fail;
+			break;
+
+		default:
+			j->str = json_read_word(r);
+			if (j->str == NULL)
+				goto fail;
+			if (strcmp(j->str, "true") == 0) {
+				j->type = JSON_TRUE;
+			} else if (strcmp(j->str, "false") == 0) {
+				j->type = JSON_FALSE;
+			} else if (strcmp(j->str, "null") == 0) {
+				j->type = JSON_NULL;
+			} else if ((j->str[0] >= '0' && j->str[0] <= '9') ||
+					   j->str[0] == '-') {
+				j->type = JSON_NUM;
+			} else {
+				goto fail;
+			}
+	}
+
+	return j;
+
+fail:
+	if (r->err == 0)
+		fprintf(stderr, "json: line %ld: syntax error\n", r->line);
+	r->err = 1;
+	json_free(j);
+
+	return NULL;
+}
+
+void json_free(json_t *j)
+{
+	json_t *n;
+
+	while (j != NULL) {
+		json_free(j->child);
+		free(j->key);
+		free(j->str);
+		n = j->next;
+		free(j);
+		j = n;
+	}
+}
+
+//	=== Tree access ===
+
+const json_t *json_get(const json_t *o, const char *key)
+{
+	const json_t *j;
+
+	if (o == NULL || o->type != JSON_OBJ)
+		return NULL;
+	for (j = o->child; j != NULL; j = j->next) {
+		if (strcmp(j->key, key) == 0)
+			return j;
+	}
+
+	return NULL;
+}
+
+const char *json_get_str(const json_t *o, const char *key)
+{
+	const json_t *j = json_get(o, key);
+
+	return j != NULL && j->type == JSON_STR ? j->str : NULL;
+}
+
+long long json_get_int(const json_t *o, const char *key, long long def)
+{
+	const json_t *j = json_get(o, key);
+
+	return j != NULL && j->type == JSON_NUM ? strtoll(j->str, NULL, 10) : def;
+}
+
+int json_get_bool(const json_t *o, const char *key, int def)
+{
+	const json_t *j = json_get(o, key);
+
+	if (j == NULL)
+		return def;
+
+	return j->type == JSON_TRUE;
+}
+
+long json_get_hex(const json_t *o, const char *key, uint8_t **buf)
+{
+	const char *s = json_get_str(o, key);
+	size_t n;
+
+	*buf = NULL;
+	if (s == NULL)
+		return -1;
+	n = strlen(s);
+	if (n & 1)
+		return -1;
+	n /= 2;
+	*buf = (uint8_t *) malloc(n > 0 ? n : 1);
+	if (*buf == NULL)
+		return -1;
+	if (rvkat_gethex(*buf, n, s) != n) {	//	not all hex digits
+		free(*buf);
+		*buf = NULL;
+		return -1;
+	}
+
+	return n;
+}
+
+//	=== Writer ===
+
+void json_buf_init(json_buf_t *b)
+{
+	b->s = NULL;
+	b->len = 0;
+	b->cap = 0;
+	b->err = 0;
+}
+
+void json_buf_free(json_buf_t *b)
+{
+	free(b->s);
+	json_buf_init(b);
+}
+
+//	make room for "n" more characters and a terminating zero
+
+static int json_buf_room(json_buf_t *b, size_t n)
+{
+	char *p;
+	size_t cap;
+
+	if (b->len + n + 1 <= b->cap)
+		return 0;
+	cap = b->cap == 0 ? 256 : b->cap;
+	while (cap < b->len + n + 1)
+		cap *= 2;
+	p = (char *) realloc(b->s, cap);
+	if (p == NULL) {
+		b->err = 1;
+		return -1;
+	}
+	b->s = p;
+	b->cap = cap;
+
+	return 0;
+}
+
+void json_printf(json_buf_t *b, const char *fmt, ...)
+{
+	va_list ap;
+	int n;
+
+	va_start(ap, fmt);
+	n = vsnprintf(NULL, 0, fmt, ap);
+	va_end(ap);
+	if (n < 0 || json_buf_room(b, n) != 0)
+		return;
+
+	va_start(ap, fmt);
+	vsnprintf(b->s + b->len, n + 1, fmt, ap);
+	va_end(ap);
+	b->len += n;
+}
+
+static void json_write_str(json_buf_t *b, const char *s)
+{
+	json_printf(b, "\"");
+	for (; *s != 0; s++) {
+		if (*s == '"' || *s == '\\')
+			json_printf(b, "\\%c", *s);
+		else if ((unsigned char) *s < 0x20)
+			json_printf(b, "\\u%04x", (unsigned char) *s);
+		else
+			json_printf(b, "%c", *s);
+	}
+	json_printf(b, "\"");
+}
+
+void json_write(json_buf_t *b, const json_t *j)
+{
+	const json_t *m;
+
+	switch (j->type) {
+		case JSON_OBJ:
+		case JSON_ARR:
+			json_printf(b, j->type == JSON_OBJ ? "{" : "[");
+			for (m = j->child; m != NULL; m = m->next) {
+				if (m != j->child)
+					json_printf(b, ",");
+				if (j->type == JSON_OBJ) {
+					json_write_str(b, m->key);
+					json_printf(b, ":");
+				}
+				json_write(b, m);
+			}
+			json_printf(b, j->type == JSON_OBJ ? "}" : "]");
+			break;
+		case JSON_STR:
+			json_write_str(b, j->str);
+			break;
+		default:
+			json_printf(b, "%s", j->str);
+	}
+}
+
+void json_put_hex(json_buf_t *b, int comma, const char *key,
+				  const uint8_t *data, size_t len)
+{
+	size_t i;
+
+	json_printf(b, "%s\"%s\":\"", comma ? "," : "", key);
+	if (json_buf_room(b, 2 * len) != 0)
+		return;
+	for (i = 0; i < len; i++) {
+		b->s[b->len++] = "0123456789ABCDEF"[data[i] >> 4];
+		b->s[b->len++] = "0123456789ABCDEF"[data[i] & 0xF];
+	}
+	b->s[b->len] = 0;
+	json_printf(b, "\"");
+}
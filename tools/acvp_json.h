@@ -0,0 +1,102 @@
+//	acvp_json.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	Just enough JSON for ACVP vector sets. The reader pulls tokens from a
+//	FILE one character at a time, so the caller can walk the outer levels
+//	and only build a tree for one value (e.g. a test group) at a time.
+//	Output goes to a growable string buffer.
+
+#ifndef _ACVP_JSON_H_
+#define _ACVP_JSON_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+
+//	value types
+#define JSON_NULL	0
+#define JSON_FALSE	1
+#define JSON_TRUE	2
+#define JSON_NUM	3
+#define JSON_STR	4
+#define JSON_ARR	5
+#define JSON_OBJ	6
+
+//	a value; members of objects and arrays are a linked list
+typedef struct json_s {
+	int type;
+	char *key;								//	member name, or NULL
+	char *str;								//	JSON_STR text, JSON_NUM digits
+	struct json_s *child;					//	first element or member
+	struct json_s *next;
+} json_t;
+
+//	=== Reader ===
+
+typedef struct {
+	FILE *fp;
+	int c;									//	lookahead character
+	long line;								//	for error messages
+	int err;								//	nonzero after a syntax error
+} json_rd_t;
+
+void json_rd_init(json_rd_t *r, FILE *fp);
+
+//	skip white space and return the next character (EOF at end)
+int json_peek(json_rd_t *r);
+
+//	skip white space and consume character "c"; nonzero if it isn't there
+int json_expect(json_rd_t *r, int c);
+
+//	consume "c" if it is next; returns 1 if it was
+int json_accept(json_rd_t *r, int c);
+
+//	read a string token; the result is allocated
+char *json_read_str(json_rd_t *r);
+
+//	read a complete value as a tree; NULL on error
+json_t *json_read(json_rd_t *r);
+
+void json_free(json_t *j);
+
+//	=== Tree access ===
+
+//	object member by name, or NULL
+const json_t *json_get(const json_t *o, const char *key);
+
+//	string member, or NULL if missing or not a string
+const char *json_get_str(const json_t *o, const char *key);
+
+//	integer member, or "def" if missing
+long long json_get_int(const json_t *o, const char *key, long long def);
+
+//	boolean member, or "def" if missing
+int json_get_bool(const json_t *o, const char *key, int def);
+
+//	decode a hex string member with rvkat_gethex(); the buffer is
+//	allocated (at least one byte). Returns the byte length, -1 on error.
+long json_get_hex(const json_t *o, const char *key, uint8_t **buf);
+
+//	=== Writer ===
+
+typedef struct {
+	char *s;
+	size_t len, cap;
+	int err;								//	allocation failed
+} json_buf_t;
+
+void json_buf_init(json_buf_t *b);
+void json_buf_free(json_buf_t *b);
+
+//	append formatted text
+void json_printf(json_buf_t *b, const char *fmt, ...);
+
+//	append a value tree
+void json_write(json_buf_t *b, const json_t *j);
+
+//	append "key": "hex" (with a leading comma if "comma" is set)
+void json_put_hex(json_buf_t *b, int comma, const char *key,
+				  const uint8_t *data, size_t len);
+
+#endif	//	_ACVP_JSON_H_
@@ -0,0 +1,292 @@
+//	acvp_sha.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	ACVP SHA-2, SHA-3 and SHAKE test groups; byte-oriented messages only.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "acvp.h"
+#include "sha2/sha2_api.h"
+#include "sha3/sha3_api.h"
+
+//	=== SHA-2 and SHA-3 ===
+
+static void acvp_sha3_224(uint8_t *md, const void *m, size_t mlen)
+{
+	sha3(md, 28, m, mlen);
+}
+
+static void acvp_sha3_256(uint8_t *md, const void *m, size_t mlen)
+{
+	sha3(md, 32, m, mlen);
+}
+
+static void acvp_sha3_384(uint8_t *md, const void *m, size_t mlen)
+{
+	sha3(md, 48, m, mlen);
+}
+
+static void acvp_sha3_512(uint8_t *md, const void *m, size_t mlen)
+{
+	sha3(md, 64, m, mlen);
+}
+
+typedef struct {
+	const char *name;
+	size_t mdlen;
+	int sha3;								//	SHA-3 style Monte Carlo
+	void (*hash)(uint8_t *md, const void *m, size_t mlen);
+} acvp_sha_t;
+
+static const acvp_sha_t acvp_sha_tab[] = {
+	{ "SHA2-224", 28, 0, sha2_224 },
+	{ "SHA2-256", 32, 0, sha2_256 },
+	{ "SHA2-384", 48, 0, sha2_384 },
+	{ "SHA2-512", 64, 0, sha2_512 },
+	{ "SHA2-512/224", 28, 0, sha2_512_224 },
+	{ "SHA2-512/256", 32, 0, sha2_512_256 },
+	{ "SHA3-224", 28, 1, acvp_sha3_224 },
+	{ "SHA3-256", 32, 1, acvp_sha3_256 },
+	{ "SHA3-384", 48, 1, acvp_sha3_384 },
+	{ "SHA3-512", 64, 1, acvp_sha3_512 },
+	{ NULL, 0, 0, NULL }
+};
+
+//	the message of a test case; -1 if it isn't a whole number of bytes
+
+static long acvp_msg(const json_t *tc, uint8_t **msg)
+{
+	long n;
+	long long len;
+
+	n = json_get_hex(tc, "msg", msg);
+	if (n < 0)
+		return -1;
+	len = json_get_int(tc, "len", 8 * (long long) n);
+	if ((len & 7) != 0 || len / 8 > n) {
+		free(*msg);
+		*msg = NULL;
+		return -1;
+	}
+
+	return len / 8;							//	"00" with len = 0
+}
+
+//	SHA-2 Monte Carlo, "standard" version:
+//	MD[0] = MD[1] = MD[2] = Seed; MD[i] = H(MD[i-3] || MD[i-2] || MD[i-1])
+//	for i = 3 .. 1002; Seed = MD[1002] is output, 100 times.
+//	SHA-3: MD[i] = H(MD[i-1]) for i = 1 .. 1000; MD[0] = MD[1000] is output,
+//	100 times.
+
+static int acvp_sha_mct(json_buf_t *o, const acvp_sha_t *h,
+						const uint8_t *seed, size_t slen)
+{
+	uint8_t m[3 * 64], md[64];
+	size_t d = h->mdlen;
+	int i, j;
+
+	if (slen != d)
+		return -1;
+	memcpy(md, seed, d);
+
+	json_printf(o, ",\"resultsArray\":[");
+	for (j = 0; j < 100; j++) {
+		if (h->sha3) {
+			for (i = 1; i <= 1000; i++)
+				h->hash(md, md, d);
+		} else {
+			memcpy(m, md, d);
+			memcpy(m + d, md, d);
+			memcpy(m + 2 * d, md, d);
+			for (i = 3; i <= 1002; i++) {
+				h->hash(md, m, 3 * d);
+				memmove(m, m + d, 2 * d);
+				memcpy(m + 2 * d, md, d);
+			}
+		}
+		json_printf(o, "%s{", j > 0 ? "," : "");
+		json_put_hex(o, 0, "md", md, d);
+		json_printf(o, "}");
+	}
+	json_printf(o, "]");
+
+	return 0;
+}
+
+long acvp_sha(json_buf_t *o, const acvp_vs_t *vs, const json_t *tg)
+{
+	const acvp_sha_t *h;
+	const json_t *tc;
+	const char *tt, *mv;
+	uint8_t md[64], *msg;
+	long n, skip = 0, cnt = 0;
+	size_t pos;
+	int mct;
+
+	for (h = acvp_sha_tab; h->name != NULL; h++) {
+		if (strcmp(h->name, vs->alg) == 0)
+			break;
+	}
+	tt = json_get_str(tg, "testType");
+	mv = json_get_str(tg, "mctVersion");
+	if (h->name == NULL || tt == NULL)
+		return -1;
+	if (strcmp(tt, "AFT") == 0) {
+		mct = 0;
+	} else if (strcmp(tt, "MCT") == 0 &&
+			   (mv == NULL || strcmp(mv, "standard") == 0)) {
+		mct = 1;
+	} else {
+		return -1;							//	LDT, alternate MCT
+	}
+
+	tc = json_get(tg, "tests");
+	for (tc = tc != NULL ? tc->child : NULL; tc != NULL; tc = tc->next) {
+
+		n = acvp_msg(tc, &msg);
+		if (n < 0) {
+			skip++;
+			continue;
+		}
+		pos = o->len;
+		json_printf(o, "%s{\"tcId\":%lld", cnt > 0 ? "," : "",
+					json_get_int(tc, "tcId", 0));
+		if (mct) {
+			if (acvp_sha_mct(o, h, msg, n) != 0) {
+				o->len = pos;				//	drop it
+				skip++;
+				free(msg);
+				continue;
+			}
+		} else {
+			h->hash(md, msg, n);
+			json_put_hex(o, 1, "md", md, h->mdlen);
+		}
+		json_printf(o, "}");
+		free(msg);
+		cnt++;
+	}
+
+	return skip;
+}
+
+//	=== SHAKE ===
+
+static void acvp_shake_xof(uint8_t *out, size_t olen, int sec,
+						   const uint8_t *m, size_t mlen)
+{
+	sha3_ctx_t c;
+
+	sha3_init(&c, sec);
+	shake_update(&c, m, mlen);
+	shake_xof(&c);
+	shake_out(out, olen, &c);
+}
+
+//	SHAKE Monte Carlo with variable output length, in bytes "lo" .. "hi":
+//	Msg[i] = leftmost 128 bits of Output[i-1] (zero padded),
+//	Output[i] = SHAKE(Msg[i], len); len = lo + (rightmost 16 bits of
+//	Output[i]) mod (hi - lo + 1). Output[1000] and its length go out.
+
+static int acvp_shake_mct(json_buf_t *o, int sec, const uint8_t *seed,
+						  size_t slen, size_t lo, size_t hi)
+{
+	uint8_t m[16], *out;
+	size_t len, olen;
+	int i, j;
+
+	if (slen != 16 || hi < 2 || lo > hi)	//	need two bytes for len
+		return -1;
+	out = (uint8_t *) malloc(hi > 16 ? hi : 16);
+	if (out == NULL)
+		return -1;
+	memcpy(out, seed, 16);
+	olen = 16;
+	len = hi;
+
+	json_printf(o, ",\"resultsArray\":[");
+	for (j = 0; j < 100; j++) {
+		for (i = 1; i <= 1000; i++) {
+			memset(m, 0, 16);
+			memcpy(m, out, olen < 16 ? olen : 16);
+			acvp_shake_xof(out, len, sec, m, 16);
+			olen = len;
+			len = lo + (((out[olen - 2] << 8) | out[olen - 1]) %
+						(hi - lo + 1));
+		}
+		json_printf(o, "%s{", j > 0 ? "," : "");
+		json_put_hex(o, 0, "md", out, olen);
+		json_printf(o, ",\"outLen\":%zu}", 8 * olen);
+	}
+	json_printf(o, "]");
+	free(out);
+
+	return 0;
+}
+
+long acvp_shake(json_buf_t *o, const acvp_vs_t *vs, const json_t *tg)
+{
+	const json_t *tc;
+	const char *tt;
+	uint8_t *md, *msg;
+	long n, skip = 0, cnt = 0;
+	long long olen, lo, hi;
+	size_t pos;
+	int sec;
+
+	if (strcmp(vs->alg, "SHAKE-128") == 0)
+		sec = 16;
+	else if (strcmp(vs->alg, "SHAKE-256") == 0)
+		sec = 32;
+	else
+		return -1;
+	tt = json_get_str(tg, "testType");
+	if (tt == NULL || (strcmp(tt, "AFT") != 0 && strcmp(tt, "VOT") != 0 &&
+		strcmp(tt, "MCT") != 0))
+		return -1;
+	lo = json_get_int(tg, "minOutLen", 0);
+	hi = json_get_int(tg, "maxOutLen", 0);
+
+	tc = json_get(tg, "tests");
+	for (tc = tc != NULL ? tc->child : NULL; tc != NULL; tc = tc->next) {
+
+		n = acvp_msg(tc, &msg);
+		olen = json_get_int(tc, "outLen", 8 * sec);
+		if (n < 0 || olen <= 0 || (olen & 7) != 0) {
+			free(msg);
+			skip++;
+			continue;
+		}
+		pos = o->len;
+		json_printf(o, "%s{\"tcId\":%lld", cnt > 0 ? "," : "",
+					json_get_int(tc, "tcId", 0));
+		if (strcmp(tt, "MCT") == 0) {
+			if ((lo & 7) != 0 || (hi & 7) != 0 ||
+				acvp_shake_mct(o, sec, msg, n, lo / 8, hi / 8) != 0) {
+				o->len = pos;
+				skip++;
+				free(msg);
+				continue;
+			}
+		} else {
+			md = (uint8_t *) malloc(olen / 8);
+			if (md == NULL) {
+				o->len = pos;
+				skip++;
+				free(msg);
+				continue;
+			}
+			acvp_shake_xof(md, olen / 8, sec, msg, n);
+			json_put_hex(o, 1, "md", md, olen / 8);
+			json_printf(o, ",\"outLen\":%lld", olen);
+			free(md);
+		}
+		json_printf(o, "}");
+		free(msg);
+		cnt++;
+	}
+
+	return skip;
+}
@@ -0,0 +1,343 @@
+//	rvkacvp.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	rvkacvp: ACVP request -> response processor. The request is read as a
+//	stream: only the vector set header and a batch of test groups are in
+//	memory at any time. The groups of a batch are processed in parallel
+//	on the par/ worker pool, and the responses are written in order.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "riscv_crypto.h"
+#include "aes/aes_api.h"
+#include "aes/aes_rvk32.h"
+#include "aes/aes_rvk64.h"
+#include "gcm/gcm_api.h"
+#include "sha2/sha2_api.h"
+#include "sha3/sha3_api.h"
+#include "par/par_api.h"
+#include "acvp.h"
+
+//	test groups held in memory and processed in parallel
+#ifndef RVKACVP_BATCH
+#define RVKACVP_BATCH	256
+#endif
+
+//	supported algorithms
+
+static const struct {
+	const char *alg;
+	acvp_fn_t fn;
+} acvp_tab[] = {
+	{ "SHA2-224", acvp_sha },
+	{ "SHA2-256", acvp_sha },
+	{ "SHA2-384", acvp_sha },
+	{ "SHA2-512", acvp_sha },
+	{ "SHA2-512/224", acvp_sha },
+	{ "SHA2-512/256", acvp_sha },
+	{ "SHA3-224", acvp_sha },
+	{ "SHA3-256", acvp_sha },
+	{ "SHA3-384", acvp_sha },
+	{ "SHA3-512", acvp_sha },
+	{ "SHAKE-128", acvp_shake },
+	{ "SHAKE-256", acvp_shake },
+	{ "ACVP-AES-ECB", acvp_aes_ecb },
+	{ "ACVP-AES-GCM", acvp_aes_gcm },
+	{ NULL, NULL }
+};
+
+//	statistics
+static long acvp_groups = 0, acvp_unsup = 0, acvp_skip = 0;
+
+//	=== Test groups ===
+
+typedef struct {
+	acvp_fn_t fn;
+	const acvp_vs_t *vs;
+	json_t *tg[RVKACVP_BATCH];
+	json_buf_t rsp[RVKACVP_BATCH];
+	long skip[RVKACVP_BATCH];
+} acvp_batch_t;
+
+static void acvp_group(void *arg, size_t i)
+{
+	acvp_batch_t *b = (acvp_batch_t *) arg;
+	json_buf_t *o = &b->rsp[i];
+
+	json_buf_init(o);
+	json_printf(o, "{\"tgId\":%lld,\"tests\":[",
+				json_get_int(b->tg[i], "tgId", 0));
+	b->skip[i] = b->fn(o, b->vs, b->tg[i]);
+	json_printf(o, "]}");
+}
+
+//	process and write "n" groups; "first" is set if nothing was written
+
+static int acvp_flush(FILE *out, acvp_batch_t *b, size_t n, int first)
+{
+	size_t i;
+
+	rvk_pool_run(acvp_group, b, n);
+
+	for (i = 0; i < n; i++) {
+		acvp_groups++;
+		if (b->skip[i] < 0 || b->rsp[i].err) {
+			acvp_unsup++;
+		} else {
+			if (!first)
+				fputc(',', out);
+			fwrite(b->rsp[i].s, 1, b->rsp[i].len, out);
+			first = 0;
+			acvp_skip += b->skip[i];
+		}
+		json_buf_free(&b->rsp[i]);
+		json_free(b->tg[i]);
+		b->tg[i] = NULL;
+	}
+
+	return first;
+}
+
+//	stream the "testGroups" array
+
+static int acvp_groups_run(json_rd_t *r, FILE *out, const acvp_vs_t *vs)
+{
+	acvp_batch_t *b;
+	size_t i, n = 0;
+	int first = 1;
+
+	b = (acvp_batch_t *) calloc(1, sizeof(acvp_batch_t));
+	if (b == NULL)
+		return -1;
+	b->vs = vs;
+	b->fn = NULL;
+	for (i = 0; vs->alg != NULL && acvp_tab[i].alg != NULL; i++) {
+		if (strcmp(acvp_tab[i].alg, vs->alg) == 0)
+			b->fn = acvp_tab[i].fn;
+	}
+	if (b->fn == NULL)
+		fprintf(stderr, "rvkacvp: algorithm %s not supported\n",
+				vs->alg != NULL ? vs->alg : "(none)");
+
+	fputc('[', out);
+	if (json_expect(r, '[') == 0 && !json_accept(r, ']')) {
+		do {
+			b->tg[n] = json_read(r);
+			if (b->tg[n] == NULL)
+				break;
+			if (b->fn == NULL) {			//	just consume it
+				json_free(b->tg[n]);
+				acvp_groups++;
+				acvp_unsup++;
+				continue;
+			}
+			if (++n == RVKACVP_BATCH) {
+				first = acvp_flush(out, b, n, first);
+				n = 0;
+			}
+		} while (json_accept(r, ','));
+		json_expect(r, ']');
+	}
+	acvp_flush(out, b, n, first);
+	fputc(']', out);
+	free(b);
+
+	return r->err ? -1 : 0;
+}
+
+//	=== Vector sets ===
+
+//	one object of the request; a vector set if it has "testGroups"
+
+static int acvp_object(json_rd_t *r, FILE *out)
+{
+	json_t *m, *hdr = NULL, **pp = &hdr;
+	acvp_vs_t vs;
+	json_buf_t b;
+	char *key;
+	int ret = 0, first = 1;
+
+	if (json_expect(r, '{') != 0)
+		return -1;
+	fputc('{', out);
+	vs.alg = NULL;
+	vs.mode = NULL;
+
+	if (!json_accept(r, '}')) {
+		do {
+			key = json_read_str(r);
+			if (key == NULL || json_expect(r, ':') != 0) {
+				free(key);
+				ret = -1;
+				break;
+			}
+			fprintf(out, "%s\"%s\":", first ? "" : ",", key);
+			first = 0;
+
+			if (strcmp(key, "testGroups") == 0) {
+				free(key);
+				if (acvp_groups_run(r, out, &vs) != 0) {
+					ret = -1;
+					break;
+				}
+				continue;
+			}
+
+			m = json_read(r);				//	header member: keep it
+			if (m == NULL) {
+				free(key);
+				ret = -1;
+				break;
+			}
+			m->key = key;
+			*pp = m;
+			pp = &m->next;
+			if (m->type == JSON_STR && strcmp(key, "algorithm") == 0)
+				vs.alg = m->str;
+			if (m->type == JSON_STR && strcmp(key, "mode") == 0)
+				vs.mode = m->str;
+
+			json_buf_init(&b);
+			json_write(&b, m);
+			fwrite(b.s, 1, b.len, out);
+			json_buf_free(&b);
+		} while (json_accept(r, ','));
+	}
+	if (ret == 0 && json_expect(r, '}') != 0)
+		ret = -1;
+	fputc('}', out);
+	json_free(hdr);
+
+	return ret;
+}
+
+//	=== Main ===
+
+//	set the UUT; GHASH backend is picked (and cross-checked) by the tuner
+
+static void acvp_uut(void)
+{
+#ifdef RVKINTRIN_RV64
+	aes128_enc_key = aes128_enc_key_rvk64;
+	aes192_enc_key = aes192_enc_key_rvk64;
+	aes256_enc_key = aes256_enc_key_rvk64;
+	aes128_enc_ecb = aes128_enc_ecb_rvk64;
+	aes192_enc_ecb = aes192_enc_ecb_rvk64;
+	aes256_enc_ecb = aes256_enc_ecb_rvk64;
+	aes128_dec_key = aes128_dec_key_rvk64;
+	aes192_dec_key = aes192_dec_key_rvk64;
+	aes256_dec_key = aes256_dec_key_rvk64;
+	aes128_dec_ecb = aes128_dec_ecb_rvk64;
+	aes192_dec_ecb = aes192_dec_ecb_rvk64;
+	aes256_dec_ecb = aes256_dec_ecb_rvk64;
+	aes128_enc_ecbn = aes128_enc_ecbn_rvk64;
+	aes192_enc_ecbn = aes192_enc_ecbn_rvk64;
+	aes256_enc_ecbn = aes256_enc_ecbn_rvk64;
+	aes128_dec_ecbn = aes128_dec_ecbn_rvk64;
+	aes192_dec_ecbn = aes192_dec_ecbn_rvk64;
+	aes256_dec_ecbn = aes256_dec_ecbn_rvk64;
+	sha512_compress = sha2_cf512_rvk64;
+	sha3_keccakp = sha3_f1600_rvb64;
+#else
+	aes128_enc_key = aes128_enc_key_rvk32;
+	aes192_enc_key = aes192_enc_key_rvk32;
+	aes256_enc_key = aes256_enc_key_rvk32;
+	aes128_enc_ecb = aes128_enc_ecb_rvk32;
+	aes192_enc_ecb = aes192_enc_ecb_rvk32;
+	aes256_enc_ecb = aes256_enc_ecb_rvk32;
+	aes128_dec_key = aes128_dec_key_rvk32;
+	aes192_dec_key = aes192_dec_key_rvk32;
+	aes256_dec_key = aes256_dec_key_rvk32;
+	aes128_dec_ecb = aes128_dec_ecb_rvk32;
+	aes192_dec_ecb = aes192_dec_ecb_rvk32;
+	aes256_dec_ecb = aes256_dec_ecb_rvk32;
+	aes128_enc_ecbn = aes128_enc_ecbn_rvk32;
+	aes192_enc_ecbn = aes192_enc_ecbn_rvk32;
+	aes256_enc_ecbn = aes256_enc_ecbn_rvk32;
+	aes128_dec_ecbn = aes128_dec_ecbn_rvk32;
+	aes192_dec_ecbn = aes192_dec_ecbn_rvk32;
+	aes256_dec_ecbn = aes256_dec_ecbn_rvk32;
+	sha512_compress = sha2_cf512_rvk32;
+	sha3_keccakp = sha3_f1600_rvb32;
+#endif
+	sha256_compress = sha2_cf256_rvk;
+	sha256_schedule = sha2_wk256_rvk;
+	sha256_compress_wk = sha2_cf256_wk_rvk;
+}
+
+int main(int argc, char **argv)
+{
+	json_rd_t r;
+	FILE *in = stdin, *out = stdout;
+	int opt, thr = 1, ret = 0, first = 1;
+
+	while ((opt = getopt(argc, argv, "j:h")) != -1) {
+		switch (opt) {
+			case 'j':
+				thr = atoi(optarg);
+				break;
+			default:
+				fprintf(stderr, "Usage: rvkacvp [-j threads] "
+						"[request.json [response.json]]\n");
+				return 2;
+		}
+	}
+	if (optind < argc && strcmp(argv[optind], "-") != 0) {
+		in = fopen(argv[optind], "r");
+		if (in == NULL) {
+			perror(argv[optind]);
+			return 1;
+		}
+	}
+	if (optind + 1 < argc) {
+		out = fopen(argv[optind + 1], "w");
+		if (out == NULL) {
+			perror(argv[optind + 1]);
+			return 1;
+		}
+	}
+
+	acvp_uut();
+	if (ghash_tune(100) == NULL) {
+		fprintf(stderr, "rvkacvp: GHASH self-check failed\n");
+		return 1;
+	}
+	if (thr > 1)
+		rvk_pool_init(thr - 1);				//	the caller works too
+
+	//	either [ {"acvVersion": ..}, {vector set} .. ] or a single object
+	json_rd_init(&r, in);
+	if (json_accept(&r, '[')) {
+		fputc('[', out);
+		if (!json_accept(&r, ']')) {
+			do {
+				if (!first)
+					fputc(',', out);
+				first = 0;
+				ret |= acvp_object(&r, out);
+			} while (ret == 0 && json_accept(&r, ','));
+			if (ret == 0)
+				ret |= json_expect(&r, ']');
+		}
+		fputc(']', out);
+	} else {
+		ret |= acvp_object(&r, out);
+	}
+	fputc('\n', out);
+
+	rvk_pool_free();
+	if (in != stdin)
+		fclose(in);
+	if (out != stdout)
+		fclose(out);
+
+	fprintf(stderr, "rvkacvp: %ld groups, %ld not supported, "
+			"%ld tests skipped%s\n", acvp_groups, acvp_unsup, acvp_skip,
+			ret != 0 ? ", input error" : "");
+
+	return ret != 0 || acvp_unsup != 0 || acvp_skip != 0 ? 1 : 0;
+}
@@ -0,0 +1,663 @@
+//	rvksum.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	rvksum: hash files with SHA-2, SHA-3, SM3 or KangarooTwelve; output in
+//	the format of sha256sum. Large files are mapped and hashed in windows,
+//	with the next window prefetched; files that can't be mapped (pipes,
+//	stdin) are read into two buffers by a reader thread while the other
+//	buffer is hashed. Runs of small files are hashed in parallel on the
+//	par/ worker pool, SHA-256 through the job/ ring. With -b the total
+//	throughput is printed, so this is also an end-to-end benchmark.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include "riscv_crypto.h"
+#include "sha2/sha2_api.h"
+#include "sha3/sha3_api.h"
+#include "sha3/kangaroo12.h"
+#include "sm3/sm3_api.h"
+#include "par/par_api.h"
+#include "job/job_api.h"
+
+#ifdef RVK_PTHREAD
+#include <pthread.h>
+#endif
+
+//	files at least this large are mapped; smaller ones are read whole
+#ifndef RVKSUM_BIG
+#define RVKSUM_BIG		(1 << 20)
+#endif
+
+//	mapping window; the next one is prefetched while this one is hashed
+#define RVKSUM_WIN		(4 << 20)
+
+//	read buffer size (there are two)
+#define RVKSUM_BUF		(1 << 20)
+
+//	small files per parallel round, and per worker call
+#define RVKSUM_ROUND	1024
+#define RVKSUM_PER		16
+
+//	=== Algorithms ===
+
+typedef union {
+	sha256_t s256;
+	sha512_t s512;
+	sha3_ctx_t s3;
+	sm3_t sm3;
+	kt128_ctx_t kt;
+} sum_ctx_t;
+
+typedef struct {
+	const char *name;
+	int mdlen;
+	void (*init)(sum_ctx_t *c, int mdlen);
+	void (*update)(sum_ctx_t *c, const uint8_t *m, size_t len);
+	void (*final)(uint8_t *md, int mdlen, sum_ctx_t *c);
+} sum_alg_t;
+
+static void sum_sha224_init(sum_ctx_t *c, int mdlen)
+{
+	(void) mdlen;
+	sha224_init(&c->s256);
+}
+
+static void sum_sha256_init(sum_ctx_t *c, int mdlen)
+{
+	(void) mdlen;
+	sha256_init(&c->s256);
+}
+
+static void sum_sha256_update(sum_ctx_t *c, const uint8_t *m, size_t len)
+{
+	sha256_update(&c->s256, m, len);
+}
+
+static void sum_sha256_final(uint8_t *md, int mdlen, sum_ctx_t *c)
+{
+	sha256_final_len(&c->s256, md, mdlen);
+}
+
+static void sum_sha384_init(sum_ctx_t *c, int mdlen)
+{
+	(void) mdlen;
+	sha384_init(&c->s512);
+}
+
+static void sum_sha512_init(sum_ctx_t *c, int mdlen)
+{
+	(void) mdlen;
+	sha512_init(&c->s512);
+}
+
+static void sum_sha512_224_init(sum_ctx_t *c, int mdlen)
+{
+	(void) mdlen;
+	sha512_224_init(&c->s512);
+}
+
+static void sum_sha512_256_init(sum_ctx_t *c, int mdlen)
+{
+	(void) mdlen;
+	sha512_256_init(&c->s512);
+}
+
+static void sum_sha512_update(sum_ctx_t *c, const uint8_t *m, size_t len)
+{
+	sha512_update(&c->s512, m, len);
+}
+
+static void sum_sha512_final(uint8_t *md, int mdlen, sum_ctx_t *c)
+{
+	sha512_final_len(&c->s512, md, mdlen);
+}
+
+static void sum_sha3_init(sum_ctx_t *c, int mdlen)
+{
+	sha3_init(&c->s3, mdlen);
+}
+
+static void sum_sha3_update(sum_ctx_t *c, const uint8_t *m, size_t len)
+{
+	sha3_update(&c->s3, m, len);
+}
+
+static void sum_sha3_final(uint8_t *md, int mdlen, sum_ctx_t *c)
+{
+	(void) mdlen;
+	sha3_final(md, &c->s3);
+}
+
+static void sum_sm3_init(sum_ctx_t *c, int mdlen)
+{
+	(void) mdlen;
+	sm3_init(&c->sm3);
+}
+
+static void sum_sm3_update(sum_ctx_t *c, const uint8_t *m, size_t len)
+{
+	sm3_update(&c->sm3, m, len);
+}
+
+static void sum_sm3_final(uint8_t *md, int mdlen, sum_ctx_t *c)
+{
+	(void) mdlen;
+	sm3_final(&c->sm3, md);
+}
+
+static void sum_kt128_init(sum_ctx_t *c, int mdlen)
+{
+	(void) mdlen;
+	kt128_init(&c->kt);
+}
+
+static void sum_kt128_update(sum_ctx_t *c, const uint8_t *m, size_t len)
+{
+	kt128_update(&c->kt, m, len);
+}
+
+static void sum_kt128_final(uint8_t *md, int mdlen, sum_ctx_t *c)
+{
+	kt128_final(md, mdlen, &c->kt, NULL, 0);
+}
+
+static const sum_alg_t sum_alg[] = {
+	{ "sha224", 28, sum_sha224_init, sum_sha256_update, sum_sha256_final },
+	{ "sha256", 32, sum_sha256_init, sum_sha256_update, sum_sha256_final },
+	{ "sha384", 48, sum_sha384_init, sum_sha512_update, sum_sha512_final },
+	{ "sha512", 64, sum_sha512_init, sum_sha512_update, sum_sha512_final },
+	{ "sha512-224", 28, sum_sha512_224_init, sum_sha512_update,
+		sum_sha512_final },
+	{ "sha512-256", 32, sum_sha512_256_init, sum_sha512_update,
+		sum_sha512_final },
+	{ "sha3-224", 28, sum_sha3_init, sum_sha3_update, sum_sha3_final },
+	{ "sha3-256", 32, sum_sha3_init, sum_sha3_update, sum_sha3_final },
+	{ "sha3-384", 48, sum_sha3_init, sum_sha3_update, sum_sha3_final },
+	{ "sha3-512", 64, sum_sha3_init, sum_sha3_update, sum_sha3_final },
+	{ "sm3", 32, sum_sm3_init, sum_sm3_update, sum_sm3_final },
+	{ "kt128", 32, sum_kt128_init, sum_kt128_update, sum_kt128_final },
+	{ NULL, 0, NULL, NULL, NULL }
+};
+
+//	total bytes hashed (main thread only)
+static uint64_t sum_bytes = 0;
+
+//	=== Large files: mapped ===
+
+//	returns 0 on success, -1 if the file can't be mapped
+
+static int sum_map(uint8_t *md, const sum_alg_t *alg, int fd, size_t size)
+{
+	sum_ctx_t c;
+	uint8_t *p;
+	size_t off, l;
+
+	p = (uint8_t *) mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (p == MAP_FAILED)
+		return -1;
+	madvise(p, size, MADV_SEQUENTIAL);
+
+	alg->init(&c, alg->mdlen);
+	for (off = 0; off < size; off += l) {
+		l = size - off < RVKSUM_WIN ? size - off : RVKSUM_WIN;
+		if (off + l < size)					//	start reading the next one
+			madvise(p + off + l, size - off - l < RVKSUM_WIN ?
+					size - off - l : RVKSUM_WIN, MADV_WILLNEED);
+		alg->update(&c, p + off, l);
+	}
+	alg->final(md, alg->mdlen, &c);
+	munmap(p, size);
+	sum_bytes += size;
+
+	return 0;
+}
+
+//	=== Streams: double-buffered reads ===
+
+//	fill "buf" from "fd" with pread() at "*off" (or read() if "off" is
+//	NULL); returns bytes read, 0 at end, -1 on error
+
+static ssize_t sum_fill(int fd, uint8_t *buf, size_t len, off_t *off)
+{
+	ssize_t r;
+	size_t n = 0;
+
+	while (n < len) {
+		if (off != NULL)
+			r = pread(fd, buf + n, len - n, *off + n);
+		else
+			r = read(fd, buf + n, len - n);
+		if (r < 0 && errno == EINTR)
+			continue;
+		if (r < 0)
+			return -1;
+		if (r == 0)
+			break;
+		n += r;
+	}
+	if (off != NULL)
+		*off += n;
+
+	return n;
+}
+
+#ifdef RVK_PTHREAD
+
+//	two buffers handed between the reader thread and the hasher
+
+typedef struct {
+	int fd;
+	off_t *off;
+	uint8_t *buf[2];
+	ssize_t len[2];
+	int full[2];
+	int err;								//	errno of the reader
+	pthread_mutex_t mtx;
+	pthread_cond_t cv;
+} sum_pipe_t;
+
+static void *sum_reader(void *arg)
+{
+	sum_pipe_t *p = (sum_pipe_t *) arg;
+	ssize_t r;
+	int k = 0;
+
+	do {
+		pthread_mutex_lock(&p->mtx);
+		while (p->full[k])
+			pthread_cond_wait(&p->cv, &p->mtx);
+		pthread_mutex_unlock(&p->mtx);
+
+		r = sum_fill(p->fd, p->buf[k], RVKSUM_BUF, p->off);
+
+		pthread_mutex_lock(&p->mtx);
+		if (r < 0)
+			p->err = errno != 0 ? errno : EIO;
+		p->len[k] = r;
+		p->full[k] = 1;
+		pthread_cond_broadcast(&p->cv);
+		pthread_mutex_unlock(&p->mtx);
+		k ^= 1;
+	} while (r > 0);
+
+	return NULL;
+}
+
+#endif
+
+//	returns 0 on success, errno on error
+
+static int sum_stream(uint8_t *md, const sum_alg_t *alg, int fd, off_t *off)
+{
+	sum_ctx_t c;
+	uint8_t *buf;
+	ssize_t r;
+	int err = 0, done = 0;
+
+	buf = (uint8_t *) malloc(2 * RVKSUM_BUF);
+	if (buf == NULL)
+		return ENOMEM;
+	alg->init(&c, alg->mdlen);
+
+#ifdef RVK_PTHREAD
+	{
+		sum_pipe_t p;
+		pthread_t thr;
+		int k = 0;
+
+		p.fd = fd;
+		p.off = off;
+		p.buf[0] = buf;
+		p.buf[1] = buf + RVKSUM_BUF;
+		p.full[0] = p.full[1] = 0;
+		p.err = 0;
+		pthread_mutex_init(&p.mtx, NULL);
+		pthread_cond_init(&p.cv, NULL);
+
+		if (pthread_create(&thr, NULL, sum_reader, &p) == 0) {
+			do {
+				pthread_mutex_lock(&p.mtx);
+				while (!p.full[k])
+					pthread_cond_wait(&p.cv, &p.mtx);
+				r = p.len[k];
+				pthread_mutex_unlock(&p.mtx);
+
+				if (r > 0) {				//	the reader fills the other
+					alg->update(&c, p.buf[k], r);
+					sum_bytes += r;
+				}
+
+				pthread_mutex_lock(&p.mtx);
+				p.full[k] = 0;
+				pthread_cond_broadcast(&p.cv);
+				pthread_mutex_unlock(&p.mtx);
+				k ^= 1;
+			} while (r > 0);
+			pthread_join(thr, NULL);
+			err = p.err;
+			done = 1;
+		}
+		pthread_cond_destroy(&p.cv);
+		pthread_mutex_destroy(&p.mtx);
+	}
+#endif
+
+	//	serial: no threads, or the reader could not be started
+	while (!done) {
+		r = sum_fill(fd, buf, RVKSUM_BUF, off);
+		if (r < 0)
+			err = errno != 0 ? errno : EIO;
+		if (r <= 0)
+			break;
+		alg->update(&c, buf, r);
+		sum_bytes += r;
+	}
+
+	alg->final(md, alg->mdlen, &c);
+	free(buf);
+
+	return err;
+}
+
+//	=== Small files: read whole, hashed in parallel ===
+
+typedef struct {
+	const char *path;
+	uint8_t md[64];
+	uint8_t *buf;
+	size_t len;
+	int err;
+} sum_file_t;
+
+typedef struct {
+	const sum_alg_t *alg;
+	sum_file_t *f;
+	size_t n;
+} sum_batch_t;
+
+static int sum_read_all(sum_file_t *f)
+{
+	struct stat st;
+	off_t off = 0;
+	ssize_t r;
+	size_t cap;
+	uint8_t *p;
+	int fd;
+
+	f->buf = NULL;
+	f->len = 0;
+	fd = open(f->path, O_RDONLY);
+	if (fd < 0)
+		return errno;
+	if (fstat(fd, &st) != 0) {
+		close(fd);
+		return errno;
+	}
+
+	//	st_size is a hint; read until EOF in case the file has grown
+	cap = st.st_size + 1;
+	for (;;) {
+		p = (uint8_t *) realloc(f->buf, cap);
+		if (p == NULL) {
+			close(fd);
+			return ENOMEM;
+		}
+		f->buf = p;
+		r = sum_fill(fd, f->buf + f->len, cap - f->len, &off);
+		if (r < 0) {
+			close(fd);
+			return errno != 0 ? errno : EIO;
+		}
+		f->len += r;
+		if (f->len < cap)
+			break;
+		cap *= 2;
+	}
+	close(fd);
+
+	return 0;
+}
+
+//	files [RVKSUM_PER * i, RVKSUM_PER * (i + 1)) of the round
+
+static void sum_batch(void *arg, size_t i)
+{
+	sum_batch_t *b = (sum_batch_t *) arg;
+	sum_file_t *f = b->f + RVKSUM_PER * i;
+	size_t j, n;
+	sum_ctx_t c;
+	rvk_ring_t r;
+	rvk_job_t job[RVKSUM_PER], *done[RVKSUM_PER];
+
+	n = b->n - RVKSUM_PER * i;
+	if (n > RVKSUM_PER)
+		n = RVKSUM_PER;
+
+	for (j = 0; j < n; j++)
+		f[j].err = sum_read_all(&f[j]);
+
+	if (strcmp(b->alg->name, "sha256") == 0) {
+		rvk_ring_init(&r);					//	one batch through the ring
+		for (j = 0; j < n; j++) {
+			if (f[j].err != 0)
+				continue;
+			memset(&job[j], 0, sizeof(rvk_job_t));
+			job[j].alg = RVK_JOB_SHA256;
+			job[j].src = f[j].buf;
+			job[j].len = f[j].len;
+			job[j].dst = f[j].md;
+			rvk_ring_submit(&r, &job[j]);
+		}
+		rvk_ring_poll(&r, done, RVKSUM_PER);
+	} else {
+		for (j = 0; j < n; j++) {
+			if (f[j].err != 0)
+				continue;
+			b->alg->init(&c, b->alg->mdlen);
+			b->alg->update(&c, f[j].buf, f[j].len);
+			b->alg->final(f[j].md, b->alg->mdlen, &c);
+		}
+	}
+
+	for (j = 0; j < n; j++) {
+		free(f[j].buf);
+		f[j].buf = NULL;
+	}
+}
+
+//	=== Output ===
+
+static void sum_print(const uint8_t *md, int mdlen, const char *path)
+{
+	int i;
+
+	for (i = 0; i < mdlen; i++)
+		printf("%02x", md[i]);
+	printf("  %s\n", path);
+}
+
+static int sum_error(const char *path, int err)
+{
+	fprintf(stderr, "rvksum: %s: %s\n", path, strerror(err));
+	return 1;
+}
+
+//	hash and print a round of "n" small files; returns nonzero on errors
+
+static int sum_round(const sum_alg_t *alg, sum_file_t *f, size_t n)
+{
+	sum_batch_t b;
+	size_t i;
+	int ret = 0;
+
+	b.alg = alg;
+	b.f = f;
+	b.n = n;
+	rvk_pool_run(sum_batch, &b, (n + RVKSUM_PER - 1) / RVKSUM_PER);
+
+	for (i = 0; i < n; i++) {
+		if (f[i].err != 0) {
+			ret |= sum_error(f[i].path, f[i].err);
+		} else {
+			sum_print(f[i].md, alg->mdlen, f[i].path);
+			sum_bytes += f[i].len;
+		}
+	}
+
+	return ret;
+}
+
+//	one large file or stream
+
+static int sum_one(const sum_alg_t *alg, const char *path)
+{
+	uint8_t md[64];
+	struct stat st;
+	off_t off = 0;
+	int fd, err;
+
+	if (strcmp(path, "-") == 0) {
+		fd = STDIN_FILENO;
+	} else {
+		fd = open(path, O_RDONLY);
+		if (fd < 0)
+			return sum_error(path, errno);
+	}
+
+	err = 0;
+	if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+		if (st.st_size < RVKSUM_BIG ||
+			sum_map(md, alg, fd, st.st_size) != 0)
+			err = sum_stream(md, alg, fd, &off);
+	} else {
+		err = sum_stream(md, alg, fd, NULL);
+	}
+	if (fd != STDIN_FILENO)
+		close(fd);
+
+	if (err != 0)
+		return sum_error(path, err);
+	sum_print(md, alg->mdlen, path);
+
+	return 0;
+}
+
+//	=== Main ===
+
+static void sum_usage(void)
+{
+	int i;
+
+	fprintf(stderr, "Usage: rvksum [-a alg] [-j threads] [-b] [file ..]\n"
+			"  -a  algorithm (default sha256):");
+	for (i = 0; sum_alg[i].name != NULL; i++)
+		fprintf(stderr, " %s", sum_alg[i].name);
+	fprintf(stderr, "\n  -j  worker threads for small files (default 1)\n"
+			"  -b  print throughput to stderr\n"
+			"With no file, or when file is -, read standard input.\n");
+}
+
+int main(int argc, char **argv)
+{
+	const sum_alg_t *alg = &sum_alg[1];
+	sum_file_t *f;
+	struct stat st;
+	struct timespec t0, t1;
+	size_t n;
+	double sec;
+	int i, opt, thr = 1, bench = 0, ret = 0;
+
+	//	set UUT
+	sha256_compress = sha2_cf256_rvk;
+	sha256_schedule = sha2_wk256_rvk;
+	sha256_compress_wk = sha2_cf256_wk_rvk;
+	sm3_compress = sm3_cf256_rvk;
+#ifdef RVKINTRIN_RV64
+	sha512_compress = sha2_cf512_rvk64;
+	sha3_keccakp = sha3_f1600_rvb64;
+	sha3_keccakp12 = sha3_p1600_12_rvb64;
+#else
+	sha512_compress = sha2_cf512_rvk32;
+	sha3_keccakp = sha3_f1600_rvb32;
+	sha3_keccakp12 = sha3_p1600_12_rvb32;
+#endif
+
+	while ((opt = getopt(argc, argv, "a:j:bh")) != -1) {
+		switch (opt) {
+			case 'a':
+				for (i = 0; sum_alg[i].name != NULL &&
+					 strcmp(sum_alg[i].name, optarg) != 0; i++)
+					;
+				if (sum_alg[i].name == NULL) {
+					fprintf(stderr, "rvksum: unknown algorithm %s\n",
+							optarg);
+					return 2;
+				}
+				alg = &sum_alg[i];
+				break;
+			case 'j':
+				thr = atoi(optarg);
+				break;
+			case 'b':
+				bench = 1;
+				break;
+			default:
+				sum_usage();
+				return 2;
+		}
+	}
+
+	f = (sum_file_t *) calloc(RVKSUM_ROUND, sizeof(sum_file_t));
+	if (f == NULL)
+		return sum_error("rvksum", ENOMEM);
+	if (thr > 1)
+		rvk_pool_init(thr - 1);				//	the caller works too
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+
+	if (optind >= argc)
+		ret |= sum_one(alg, "-");
+
+	n = 0;
+	for (i = optind; i < argc; i++) {
+		//	zero size may mean "unknown" (procfs, sysfs); stream those
+		if (strcmp(argv[i], "-") != 0 && stat(argv[i], &st) == 0 &&
+			S_ISREG(st.st_mode) && st.st_size > 0 &&
+			st.st_size < RVKSUM_BIG) {
+			f[n++].path = argv[i];			//	queue a small file
+			if (n == RVKSUM_ROUND) {
+				ret |= sum_round(alg, f, n);
+				n = 0;
+			}
+			continue;
+		}
+		if (n > 0) {						//	keep the output in order
+			ret |= sum_round(alg, f, n);
+			n = 0;
+		}
+		ret |= sum_one(alg, argv[i]);
+	}
+	if (n > 0)
+		ret |= sum_round(alg, f, n);
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	rvk_pool_free();
+	free(f);
+
+	if (bench) {
+		sec = (t1.tv_sec - t0.tv_sec) + 1E-9 * (t1.tv_nsec - t0.tv_nsec);
+		fprintf(stderr, "rvksum: %s %llu bytes in %.3f s, %.1f MB/s\n",
+				alg->name, (unsigned long long) sum_bytes, sec,
+				sec > 0.0 ? 1E-6 * sum_bytes / sec : 0.0);
+	}
+
+	return ret;
+}
@@ -0,0 +1,282 @@
+//	xts_api.c
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	AES-XTS with ciphertext stealing, built on the multi-block AES pointers.
+
+#include <string.h>
+
+#include "rv_endian.h"
+#include "aes/aes_api.h"
+#include "gcm/gcm_gfmul.h"
+#include "xts_api.h"
+
+//	number of blocks given to the multi-block cipher at once
+
+#define XTS_PAR 8
+
+typedef void (*xts_ecbn_t)(uint8_t * d, const uint8_t * s, size_t n,
+						   const uint32_t * rk);
+
+//	multiply tweak by the primitive element x in GF(2^128), little-endian
+//	convention of IEEE 1619; the reduction is masked, not branched
+
+static inline void xts_mul_x(gf128_t * t)
+{
+	uint64_t t0, t1;
+
+	t0 = t->d[0];
+	t1 = t->d[1];
+	t->d[1] = (t1 << 1) | (t0 >> 63);
+	t->d[0] = (t0 << 1) ^ (-(t1 >> 63) & 0x87);
+}
+
+//	the same "body" for encryption and decryption; "tw" is the encrypted
+//	tweak and gets updated. len >= 16.
+
+static void aes_xts_body(uint8_t * dst, const uint8_t * src, size_t len,
+						 gf128_t * tw, const uint32_t rk[], xts_ecbn_t ecbn,
+						 int enc_flag)
+{
+	size_t i, j, n, r;
+	gf128_t t[XTS_PAR], b[XTS_PAR];
+
+	n = len / 16;
+	r = len % 16;
+	if (r > 0)								//	last full block is stolen
+		n--;
+
+	while (n > 0) {							//	groups of XTS_PAR blocks
+
+		j = n < XTS_PAR ? n : XTS_PAR;
+		for (i = 0; i < j; i++) {
+			t[i] = *tw;						//	tweak chain
+			xts_mul_x(tw);
+			memcpy(b[i].b, src + 16 * i, 16);
+			b[i].d[0] ^= t[i].d[0];
+			b[i].d[1] ^= t[i].d[1];
+		}
+
+		ecbn(b[0].b, b[0].b, j, rk);		//	interleaved blocks
+
+		for (i = 0; i < j; i++) {
+			b[i].d[0] ^= t[i].d[0];
+			b[i].d[1] ^= t[i].d[1];
+		}
+		memcpy(dst, b[0].b, 16 * j);
+
+		src += 16 * j;
+		dst += 16 * j;
+		n -= j;
+	}
+
+	if (r == 0)
+		return;
+
+	//	ciphertext stealing. encryption uses tweaks in order (m-1, m) and
+	//	decryption in order (m, m-1); otherwise the steps are identical.
+
+	t[0] = *tw;
+	t[1] = *tw;
+	xts_mul_x(&t[1]);
+	if (!enc_flag) {
+		t[2] = t[0];
+		t[0] = t[1];
+		t[1] = t[2];
+	}
+
+	memcpy(b[0].b, src, 16);				//	full block
+	b[0].d[0] ^= t[0].d[0];
+	b[0].d[1] ^= t[0].d[1];
+	ecbn(b[0].b, b[0].b, 1, rk);
+	b[0].d[0] ^= t[0].d[0];
+	b[0].d[1] ^= t[0].d[1];
+
+	memcpy(b[1].b, src + 16, r);			//	partial block + stolen part
+	memcpy(b[1].b + r, b[0].b + r, 16 - r);
+	memcpy(dst + 16, b[0].b, r);
+
+	b[1].d[0] ^= t[1].d[0];
+	b[1].d[1] ^= t[1].d[1];
+	ecbn(b[1].b, b[1].b, 1, rk);
+	b[1].d[0] ^= t[1].d[0];
+	b[1].d[1] ^= t[1].d[1];
+	memcpy(dst, b[1].b, 16);
+}
+
+//	multiple sectors; tweaks of up to XTS_PAR sectors encrypted at once
+
+static void aes_xts_sec(uint8_t * dst, const uint8_t * src,
+						size_t secsiz, size_t nsec, uint64_t secno,
+						const uint32_t rk1[], xts_ecbn_t ecbn,
+						const uint32_t rk2[], xts_ecbn_t tw_ecbn,
+						int enc_flag)
+{
+	size_t i, j;
+	gf128_t tw[XTS_PAR];
+
+	while (nsec > 0) {
+		j = nsec < XTS_PAR ? nsec : XTS_PAR;
+		for (i = 0; i < j; i++) {
+			put64u_le(tw[i].b, secno + i);	//	sector number
+			put64u_le(tw[i].b + 8, 0);
+		}
+		tw_ecbn(tw[0].b, tw[0].b, j, rk2);
+
+		for (i = 0; i < j; i++) {
+			aes_xts_body(dst, src, secsiz, &tw[i], rk1, ecbn, enc_flag);
+			src += secsiz;
+			dst += secsiz;
+		}
+		secno += j;
+		nsec -= j;
+	}
+}
+
+//	AES128-XTS
+
+int aes128_enc_xts(uint8_t * c, const uint8_t * m, size_t len,
+				   const uint8_t key[32], const uint8_t tw[16])
+{
+	uint32_t rk[AES128_RK_WORDS];
+	gf128_t t;
+
+	if (len < 16)
+		return -1;
+
+	aes128_enc_key(rk, key + 16);			//	encrypt tweak with K2
+	memcpy(t.b, tw, 16);
+	aes128_enc_ecb(t.b, t.b, rk);
+
+	aes128_enc_key(rk, key);				//	data key K1
+	aes_xts_body(c, m, len, &t, rk, aes128_enc_ecbn, 1);
+
+	return 0;
+}
+
+int aes128_dec_xts(uint8_t * m, const uint8_t * c, size_t len,
+				   const uint8_t key[32], const uint8_t tw[16])
+{
+	uint32_t rk[AES128_RK_WORDS];
+	gf128_t t;
+
+	if (len < 16)
+		return -1;
+
+	aes128_enc_key(rk, key + 16);
+	memcpy(t.b, tw, 16);
+	aes128_enc_ecb(t.b, t.b, rk);
+
+	aes128_dec_key(rk, key);
+	aes_xts_body(m, c, len, &t, rk, aes128_dec_ecbn, 0);
+
+	return 0;
+}
+
+int aes128_enc_xts_sec(uint8_t * c, const uint8_t * m,
+					   size_t secsiz, size_t nsec,
+					   const uint8_t key[32], uint64_t secno)
+{
+	uint32_t rk1[AES128_RK_WORDS], rk2[AES128_RK_WORDS];
+
+	if (secsiz < 16)
+		return -1;
+
+	aes128_enc_key(rk1, key);
+	aes128_enc_key(rk2, key + 16);
+	aes_xts_sec(c, m, secsiz, nsec, secno,
+				rk1, aes128_enc_ecbn, rk2, aes128_enc_ecbn, 1);
+
+	return 0;
+}
+
+int aes128_dec_xts_sec(uint8_t * m, const uint8_t * c,
+					   size_t secsiz, size_t nsec,
+					   const uint8_t key[32], uint64_t secno)
+{
+	uint32_t rk1[AES128_RK_WORDS], rk2[AES128_RK_WORDS];
+
+	if (secsiz < 16)
+		return -1;
+
+	aes128_dec_key(rk1, key);
+	aes128_enc_key(rk2, key + 16);
+	aes_xts_sec(m, c, secsiz, nsec, secno,
+				rk1, aes128_dec_ecbn, rk2, aes128_enc_ecbn, 0);
+
+	return 0;
+}
+
+//	AES256-XTS
+
+int aes256_enc_xts(uint8_t * c, const uint8_t * m, size_t len,
+				   const uint8_t key[64], const uint8_t tw[16])
+{
+	uint32_t rk[AES256_RK_WORDS];
+	gf128_t t;
+
+	if (len < 16)
+		return -1;
+
+	aes256_enc_key(rk, key + 32);
+	memcpy(t.b, tw, 16);
+	aes256_enc_ecb(t.b, t.b, rk);
+
+	aes256_enc_key(rk, key);
+	aes_xts_body(c, m, len, &t, rk, aes256_enc_ecbn, 1);
+
+	return 0;
+}
+
+int aes256_dec_xts(uint8_t * m, const uint8_t * c, size_t len,
+				   const uint8_t key[64], const uint8_t tw[16])
+{
+	uint32_t rk[AES256_RK_WORDS];
+	gf128_t t;
+
+	if (len < 16)
+		return -1;
+
+	aes256_enc_key(rk, key + 32);
+	memcpy(t.b, tw, 16);
+	aes256_enc_ecb(t.b, t.b, rk);
+
+	aes256_dec_key(rk, key);
+	aes_xts_body(m, c, len, &t, rk, aes256_dec_ecbn, 0);
+
+	return 0;
+}
+
+int aes256_enc_xts_sec(uint8_t * c, const uint8_t * m,
+					   size_t secsiz, size_t nsec,
+					   const uint8_t key[64], uint64_t secno)
+{
+	uint32_t rk1[AES256_RK_WORDS], rk2[AES256_RK_WORDS];
+
+	if (secsiz < 16)
+		return -1;
+
+	aes256_enc_key(rk1, key);
+	aes256_enc_key(rk2, key + 32);
+	aes_xts_sec(c, m, secsiz, nsec, secno,
+				rk1, aes256_enc_ecbn, rk2, aes256_enc_ecbn, 1);
+
+	return 0;
+}
+
+int aes256_dec_xts_sec(uint8_t * m, const uint8_t * c,
+					   size_t secsiz, size_t nsec,
+					   const uint8_t key[64], uint64_t secno)
+{
+	uint32_t rk1[AES256_RK_WORDS], rk2[AES256_RK_WORDS];
+
+	if (secsiz < 16)
+		return -1;
+
+	aes256_dec_key(rk1, key);
+	aes256_enc_key(rk2, key + 32);
+	aes_xts_sec(m, c, secsiz, nsec, secno,
+				rk1, aes256_dec_ecbn, rk2, aes256_enc_ecbn, 0);
+
+	return 0;
+}
@@ -0,0 +1,57 @@
+//	xts_api.h
+//	2026-10-19	Markku-Juhani O. Saarinen <mjos@pqshield.com>
+//	Copyright (c) 2026, PQShield Ltd. All rights reserved.
+
+//	AES-XTS (IEEE 1619-2018, SP 800-38E) for block storage encryption.
+//	The key is the data key K1 followed by the tweak key K2 (2 x 16 or
+//	2 x 32 bytes). Lengths of 16 bytes or more are supported; a partial
+//	final block is handled with ciphertext stealing. Routines return
+//	nonzero if the length is not valid.
+
+#ifndef _XTS_API_H_
+#define _XTS_API_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+//	AES-XTS-128: single data unit with a given 128-bit tweak
+
+int aes128_enc_xts(uint8_t * c, const uint8_t * m, size_t len,
+				   const uint8_t key[32], const uint8_t tw[16]);
+int aes128_dec_xts(uint8_t * m, const uint8_t * c, size_t len,
+				   const uint8_t key[32], const uint8_t tw[16]);
+
+//	AES-XTS-256: single data unit with a given 128-bit tweak
+
+int aes256_enc_xts(uint8_t * c, const uint8_t * m, size_t len,
+				   const uint8_t key[64], const uint8_t tw[16]);
+int aes256_dec_xts(uint8_t * m, const uint8_t * c, size_t len,
+				   const uint8_t key[64], const uint8_t tw[16]);
+
+//	Process "nsec" consecutive sectors of "secsiz" bytes each in one call
+//	(e.g. a 4 KiB page of 512-byte sectors). The tweak of each sector is
+//	its sector number as a 128-bit little-endian value, starting at "secno".
+
+int aes128_enc_xts_sec(uint8_t * c, const uint8_t * m,
+					   size_t secsiz, size_t nsec,
+					   const uint8_t key[32], uint64_t secno);
+int aes128_dec_xts_sec(uint8_t * m, const uint8_t * c,
+					   size_t secsiz, size_t nsec,
+					   const uint8_t key[32], uint64_t secno);
+
+int aes256_enc_xts_sec(uint8_t * c, const uint8_t * m,
+					   size_t secsiz, size_t nsec,
+					   const uint8_t key[64], uint64_t secno);
+int aes256_dec_xts_sec(uint8_t * m, const uint8_t * c,
+					   size_t secsiz, size_t nsec,
+					   const uint8_t key[64], uint64_t secno);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	//	_XTS_API_H_